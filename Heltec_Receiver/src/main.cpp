@@ -12,6 +12,15 @@
 #include <SPI.h>
 #include <U8g2lib.h>
 #include <RadioLib.h>
+#include <PitchCommProtocol.h>
+#include <PitchCommRxEvent.h>
+#include <PitchCommDirtyTiles.h>
+#include <PitchCommScene.h>
+#include <PitchCommLink.h>
+#include <PitchCommRadio.h>
+#if __has_include("CallBitmaps.h")
+#include "CallBitmaps.h"            // generated by Host_Bench font_compiler
+#endif
 
 // =============================================================================
 // Heltec WiFi LoRa 32 V3 Pin Definitions
@@ -30,6 +39,7 @@
 #define LORA_RST        12
 #define LORA_DIO1       14
 #define LORA_BUSY       13
+#define LORA_TCXO_V     1.6   // RadioLib default
 
 // Vext control (powers OLED and external peripherals)
 #define VEXT_CTRL       36
@@ -49,24 +59,19 @@ SPIClass radioSPI(FSPI);
 SX1262 radio = new Module(LORA_CS, LORA_DIO1, LORA_RST, LORA_BUSY, radioSPI);
 
 // =============================================================================
-// Signal Structure (must match T-Deck transmitter)
+// Signal Packet (layout defined in PitchCommProtocol.h)
 // =============================================================================
-typedef struct {
-  uint8_t type;       // 0=pitch, 1=reset
-  uint8_t pitch;      // 0=FB, 1=CB, 2=CH, 3=SL, 4=PO, 255=none
-  uint8_t zone;       // 1-9
-  uint8_t pickoff;    // 0=none, 1-3=base
-  uint8_t thirdSign;  // 0=none, 1-4=A/B/C/D
-  uint16_t number;    // signal count
-} PitchSignal;
+using pitchcomm::SignalView;
 
 // Pitch names
 const char* pitchNames[] = {"FB", "CB", "CH", "SL", "PO"};
 
 bool loraReady = false;
-PitchSignal lastSignal;
+uint8_t rxBuf[pitchcomm::MAX_PACKET_LENGTH];
 unsigned long lastReceived = 0;
-volatile bool receivedFlag = false;
+pitchcomm::RxEvent rxEvent;            // DIO1 ISR -> loop() wakeup
+const uint32_t IDLE_TICK_MS = 100;     // loop() idle work runs at least this often
+pitchcomm::DirtyTiles<16, 8> tiles;    // 128x64 OLED as 16 x 8 tiles; flush sends changed ones
 
 // =============================================================================
 // Display Functions (optimized for 128x64 OLED)
@@ -85,100 +90,92 @@ void drawStartup() {
   } else {
     display.drawStr(28, 60, "LoRa: FAILED");
   }
-  display.sendBuffer();
+  tiles.flush(display);
 }
 
 void drawWaiting() {
   display.clearBuffer();
   display.setFont(u8g2_font_helvR12_tr);
   display.drawStr(20, 38, "Waiting...");
-  display.sendBuffer();
+  tiles.flush(display);
 }
 
-void drawSignal(PitchSignal &sig) {
-  display.clearBuffer();
-
-  // Signal number in top-left corner
-  display.setFont(u8g2_font_5x7_tr);
-  char numStr[8];
-  snprintf(numStr, sizeof(numStr), "#%d", sig.number);
-  display.drawStr(0, 7, numStr);
-
-  if (sig.type == 1) {
-    // Reset signal - large centered text
-    display.setFont(u8g2_font_helvB24_tr);
-    display.drawStr(12, 45, "RESET");
-    display.sendBuffer();
-    return;
-  }
-
-  bool hasPitch = (sig.pitch < 5);
-
-  // Pickoff-only signal
-  if (sig.pickoff > 0 && !hasPitch) {
-    display.setFont(u8g2_font_helvB24_tr);
-    char pkStr[5];
-    snprintf(pkStr, sizeof(pkStr), "PK%d", sig.pickoff);
-    display.drawStr(25, 45, pkStr);
-    display.sendBuffer();
-    return;
-  }
-
-  // Third sign only
-  if (sig.thirdSign > 0 && !hasPitch) {
-    display.setFont(u8g2_font_helvB24_tr);
-    const char* thirdNames[] = {"", "3A", "3B", "3C", "3D"};
-    if (sig.thirdSign <= 4) {
-      display.drawStr(40, 45, thirdNames[sig.thirdSign]);
-    } else {
-      display.drawStr(40, 45, "3?");
-    }
-    display.sendBuffer();
-    return;
-  }
+// Signal screen layout (pitchcomm::Scene slots; font_compiler mirrors the
+// large ones). Once Host_Bench font_compiler has generated CallBitmaps.h the
+// pitch, zone and large PK / 3rd / RESET strings are prebuilt art and
+// helvB24 and helvB18 drop out of the image; the badges stay text.
+enum { FONT_CALL, FONT_ZONE, FONT_ROW, FONT_NUMBER };
+
+const uint8_t* const sceneFonts[] = {
+#ifdef PITCHCOMM_CALL_BITMAPS
+  NULL, NULL,
+#else
+  u8g2_font_helvB24_tr, u8g2_font_helvB18_tr,
+#endif
+  u8g2_font_6x10_tr, u8g2_font_5x7_tr
+};
+
+const pitchcomm::SceneStyle signalStyles[pitchcomm::SCENE_STYLES] = {
+  // SCENE_PITCH: shifted left with the zone to its right, centred alone
+  { { FONT_CALL, pitchcomm::SCENE_CENTER, 49, 35 },
+    { FONT_CALL, pitchcomm::SCENE_CENTER, 64, 40 },
+    { FONT_ZONE, pitchcomm::SCENE_AFTER,  20, 35 } },
+  // SCENE_RESET, SCENE_PICKOFF, SCENE_THIRD
+  { pitchcomm::SCENE_NO_SLOT, { FONT_CALL, pitchcomm::SCENE_LEFT, 12, 45 }, pitchcomm::SCENE_NO_SLOT },
+  { pitchcomm::SCENE_NO_SLOT, { FONT_CALL, pitchcomm::SCENE_LEFT, 25, 45 }, pitchcomm::SCENE_NO_SLOT },
+  { pitchcomm::SCENE_NO_SLOT, { FONT_CALL, pitchcomm::SCENE_LEFT, 40, 45 }, pitchcomm::SCENE_NO_SLOT },
+};
+
+// "#n" top-left, then PK and 3rd packed into a bottom row
+const pitchcomm::SceneLayout signalLayout = {
+  signalStyles, pitchcomm::SCENE_STYLES, true,
+  { { FONT_NUMBER, pitchcomm::SCENE_LEFT, 0, 7 },
+    { FONT_ROW,    pitchcomm::SCENE_LEFT, 0, 60 },
+    { FONT_ROW,    pitchcomm::SCENE_LEFT, 30, 60 } }
+};
+
+pitchcomm::SceneBackend<U8G2> panel(display, sceneFonts);
+
+#ifdef PITCHCOMM_CALL_BITMAPS
+void drawArt(const pitchcomm::PackedBitmap &art) {
+  display.setBitmapMode(1);             // clear bits leave the frame alone
+  if (!art.empty()) display.drawBitmap(art.x, art.y, art.stride(), art.h, art.bits);
+}
 
-  // Main pitch display
-  if (hasPitch) {
-    // Large pitch name centered
-    display.setFont(u8g2_font_helvB24_tr);
-    int pitchWidth = display.getStrWidth(pitchNames[sig.pitch]);
-    int xPos = (128 - pitchWidth) / 2;
-
-    if (sig.zone > 0) {
-      // Pitch + Zone layout
-      display.drawStr(xPos - 15, 35, pitchNames[sig.pitch]);
-
-      // Zone number to the right
-      display.setFont(u8g2_font_helvB18_tr);
-      char zoneStr[3];
-      snprintf(zoneStr, sizeof(zoneStr), "%d", sig.zone);
-      display.drawStr(xPos + pitchWidth + 5, 35, zoneStr);
-    } else {
-      // Pitch only - centered
-      display.drawStr(xPos, 40, pitchNames[sig.pitch]);
+void drawSignalArt(const SignalView &sig) {
+  if (sig.isReset()) {
+    drawArt(resetBitmap);
+  } else if (!sig.hasPitch()) {
+    if (sig.pickoff() > 0) {
+      if (sig.pickoff() <= pitchcomm::PICKOFF_MAX) drawArt(pickoffOnlyBitmaps[sig.pickoff()]);
+    } else if (sig.thirdSign() > 0) {
+      drawArt(thirdOnlyBitmaps[sig.thirdSign() <= 4 ? sig.thirdSign() : pitchcomm::THIRD_MAX + 1]);
     }
+  } else if (sig.zone() > 0) {
+    drawArt(pitchZonedBitmaps[sig.pitch()]);
+    if (sig.zone() <= pitchcomm::ZONE_MAX) drawArt(zoneBitmaps[sig.pitch()][sig.zone()]);
+  } else {
+    drawArt(pitchBitmaps[sig.pitch()]);
   }
+}
+#endif
 
-  // Bottom row: pickoff and/or third sign indicators
-  display.setFont(u8g2_font_6x10_tr);
-  int bottomY = 60;
-  int xOffset = 0;
-
-  if (sig.pickoff > 0 && hasPitch) {
-    char pkStr[5];
-    snprintf(pkStr, sizeof(pkStr), "PK%d", sig.pickoff);
-    display.drawStr(xOffset, bottomY, pkStr);
-    xOffset += 30;
-  }
-
-  if (sig.thirdSign > 0 && hasPitch) {
-    const char* thirdNames[] = {"", "3A", "3B", "3C", "3D"};
-    if (sig.thirdSign <= 4) {
-      display.drawStr(xOffset, bottomY, thirdNames[sig.thirdSign]);
-    }
-  }
+// What this receiver shows for a signal (Host_Bench scene_bench renders it too)
+void buildScene(const SignalView &sig, pitchcomm::Scene &scene) {
+  pitchcomm::signalScene(sig, pitchNames, NULL, scene);
+}
 
-  display.sendBuffer();
+void drawSignal(const SignalView &sig) {
+  pitchcomm::Scene scene;
+  buildScene(sig, scene);
+#ifdef PITCHCOMM_CALL_BITMAPS
+  scene.primary.text[0] = scene.detail.text[0] = '\0';    // prebuilt art below
+#endif
+  pitchcomm::renderScene(panel, scene, signalLayout);
+#ifdef PITCHCOMM_CALL_BITMAPS
+  drawSignalArt(sig);
+#endif
+  tiles.flush(display);
 }
 
 // =============================================================================
@@ -188,7 +185,52 @@ void drawSignal(PitchSignal &sig) {
   ICACHE_RAM_ATTR
 #endif
 void setFlag(void) {
-  receivedFlag = true;
+  rxEvent.notifyFromIsr();
+}
+
+// =============================================================================
+// Link Adaptation (PitchCommLink.h)
+// =============================================================================
+// Answers the coach's link commands with the SNR it saw and follows its SF
+// steps; back to SF10 (home) if the coach goes quiet. LINK_NODE is this
+// receiver's report slot and must be unique among the signal receivers.
+#ifndef LINK_NODE
+#define LINK_NODE 0
+#endif
+
+pitchcomm::LinkFollower adr(pitchcomm::LINK_SIGNAL, LINK_NODE);
+
+void serviceLink() {
+  if (pitchcomm::sendLinkReport(radio, adr, millis(), setFlag)) {
+    Serial.printf("[LINK] report step=%u\n", adr.step());
+  }
+  if (adr.fallback(millis())) {
+    pitchcomm::tuneLink(radio, adr);
+    Serial.printf("[LINK] Coach silent, back to SF%u\n", adr.current().sf);
+  }
+}
+
+// =============================================================================
+// Radio Profile (PitchCommRadio.h)
+// =============================================================================
+// RADIO_PROFILE is the factory setting; "profile <name>" on USB serial
+// replaces it in NVS and retunes at once. Must match the coach's profile.
+#ifndef RADIO_PROFILE
+#define RADIO_PROFILE pitchcomm::PROFILE_LONG_RANGE
+#endif
+
+pitchcomm::ProfileStore profileStore;
+pitchcomm::ProfileConsole profileConsole;
+
+void serviceProfile() {
+  uint8_t id;
+  if (!profileConsole.poll(Serial, id)) return;
+  const pitchcomm::RadioProfile& p = pitchcomm::radioProfile(id);
+  if (!profileStore.save(id)) Serial.println("[LoRa] Profile not saved");
+  int state = pitchcomm::applyProfile(radio, p);
+  adr.setFamily(pitchcomm::linkFamily(p));
+  radio.startReceive();
+  Serial.printf("[LoRa] Profile %s SF%u sync 0x%02X: %d\n", p.name, p.modem.sf, p.syncWord, state);
 }
 
 // =============================================================================
@@ -198,21 +240,18 @@ void setupLoRa() {
   Serial.println("[LoRa] Initializing SPI...");
   radioSPI.begin(LORA_SCK, LORA_MISO, LORA_MOSI, LORA_CS);
 
-  Serial.println("[LoRa] Initializing SX1262...");
-  int state = radio.begin(915.0);  // 915 MHz for Americas
+  // Stored profile, else the factory one; must match the T-Deck's
+  const pitchcomm::RadioProfile& profile =
+      pitchcomm::radioProfile(profileStore.load(RADIO_PROFILE));
+  Serial.printf("[LoRa] Initializing SX1262, profile %s...\n", profile.name);
+  int state = pitchcomm::beginProfile(radio, profile, LORA_TCXO_V);
 
   if (state == RADIOLIB_ERR_NONE) {
     Serial.println("[LoRa] SX1262 init OK");
-
-    // Match T-Deck transmitter settings exactly
-    radio.setSpreadingFactor(10);
-    radio.setBandwidth(125.0);
-    radio.setCodingRate(8);
-    radio.setSyncWord(0x12);
-    radio.setOutputPower(22);
-    radio.setPreambleLength(8);
+    adr.setFamily(pitchcomm::linkFamily(profile));
 
     // Set up interrupt on DIO1
+    rxEvent.begin();
     radio.setDio1Action(setFlag);
 
     // Start receiving
@@ -280,40 +319,58 @@ void loop() {
     return;
   }
 
-  // Check if packet received via interrupt
-  if (receivedFlag) {
-    receivedFlag = false;
-
+  // Sleep until DIO1 fires or the idle tick passes
+  if (rxEvent.wait(IDLE_TICK_MS)) {
     // Flash LED on receive
     digitalWrite(LED_PIN, LOW);
 
-    // Read received data
-    int state = radio.readData((uint8_t*)&lastSignal, sizeof(lastSignal));
+    // Read received data straight into the packet buffer
+    size_t len = radio.getPacketLength();
+    if (len > sizeof(rxBuf)) len = sizeof(rxBuf);
+    int state = radio.readData(rxBuf, len);
+    float rssi = radio.getRSSI();
+    float snr = radio.getSNR();
 
-    if (state == RADIOLIB_ERR_NONE) {
+    // Restart receive mode before drawing; the frame is already in rxBuf
+    radio.startReceive();
+    uint32_t deafUs = micros() - rxEvent.isrUs();
+    SignalView sig(rxBuf, len);
+    pitchcomm::LinkCommandView cmd(rxBuf, len);
+
+    if (state == RADIOLIB_ERR_NONE && cmd.valid()) {
+      if (adr.onCommand(cmd, (int16_t)(snr * 4), (int16_t)rssi, millis())) {
+        pitchcomm::tuneLink(radio, adr);
+      }
+      Serial.printf("[LINK] step=%u SF%u SNR=%.1f\n", adr.step(), adr.current().sf, snr);
+    } else if (state == RADIOLIB_ERR_NONE && sig.valid()) {
       // Got a valid packet!
-      Serial.printf("RX: type=%d pitch=%d zone=%d pick=%d 3rd=%d #%d  RSSI=%.1f SNR=%.1f\n",
-        lastSignal.type, lastSignal.pitch, lastSignal.zone,
-        lastSignal.pickoff, lastSignal.thirdSign, lastSignal.number,
-        radio.getRSSI(), radio.getSNR());
-
-      drawSignal(lastSignal);
+      adr.onTraffic(millis());
+      drawSignal(sig);
       lastReceived = millis();
+
+      Serial.printf("RX: type=%d pitch=%d zone=%d pick=%d 3rd=%d #%d  RSSI=%.1f SNR=%.1f wake=%luus (max %lu) deaf=%luus bus=%uB/%u tiles\n",
+        sig.type(), sig.pitch(), sig.zone(),
+        sig.pickoff(), sig.thirdSign(), sig.number(),
+        rssi, snr,
+        (unsigned long)rxEvent.lastUs(), (unsigned long)rxEvent.maxUs(),
+        (unsigned long)deafUs, tiles.lastBytes(), tiles.lastTiles());
+    } else if (state == RADIOLIB_ERR_NONE && pitchcomm::LinkReportView(rxBuf, len).valid()) {
+      // another receiver's report to the coach
+    } else if (state == RADIOLIB_ERR_NONE) {
+      Serial.printf("RX bad packet: %u bytes\n", (unsigned)len);
     } else {
       Serial.printf("RX error: %d\n", state);
     }
 
-    // Restart receive mode
-    radio.startReceive();
-
     digitalWrite(LED_PIN, HIGH);
   }
 
+  serviceLink();
+  serviceProfile();
+
   // Show waiting screen if no signal for 30 seconds
   if (lastReceived > 0 && millis() - lastReceived > 30000) {
     drawWaiting();
     lastReceived = 0;
   }
-
-  delay(10);
 }
@@ -12,6 +12,15 @@
 #include <SPI.h>
 #include <U8g2lib.h>
 #include <RadioLib.h>
+#include <PitchCommProtocol.h>
+#include <PitchCommRxEvent.h>
+#include <PitchCommDirtyTiles.h>
+#include <PitchCommScene.h>
+#include <PitchCommLink.h>
+#include <PitchCommRadio.h>
+#if __has_include("CallBitmaps.h")
+#include "CallBitmaps.h"            // generated by Host_Bench font_compiler
+#endif
 
 // =============================================================================
 // Pin Definitions - Heltec Wireless Stick Lite V3
@@ -30,6 +39,7 @@
 #define LORA_RST        12
 #define LORA_DIO1       14
 #define LORA_BUSY       13
+#define LORA_TCXO_V     1.6   // RadioLib default
 
 // LED (built-in)
 #define LED_PIN         35
@@ -46,23 +56,18 @@ SPIClass radioSPI(FSPI);
 SX1262 radio = new Module(LORA_CS, LORA_DIO1, LORA_RST, LORA_BUSY, radioSPI);
 
 // =============================================================================
-// Signal Structure (must match T-Deck transmitter)
+// Signal Packet (layout defined in PitchCommProtocol.h)
 // =============================================================================
-typedef struct {
-  uint8_t type;       // 0=pitch, 1=reset
-  uint8_t pitch;      // 0=FB, 1=CB, 2=CH, 3=SL, 4=PO, 255=none
-  uint8_t zone;       // 1-9
-  uint8_t pickoff;    // 0=none, 1-3=base
-  uint8_t thirdSign;  // 0=none, 1-4=A/B/C/D
-  uint16_t number;    // signal count
-} PitchSignal;
+using pitchcomm::SignalView;
 
 const char* pitchNames[] = {"FB", "CB", "CH", "SL", "PO"};
 
 bool loraReady = false;
-PitchSignal lastSignal;
+uint8_t rxBuf[pitchcomm::MAX_PACKET_LENGTH];
 unsigned long lastReceived = 0;
-volatile bool receivedFlag = false;
+pitchcomm::RxEvent rxEvent;            // DIO1 ISR -> loop() wakeup
+const uint32_t IDLE_TICK_MS = 100;     // loop() idle work runs at least this often
+pitchcomm::DirtyTiles<8, 4> tiles;     // 64x32 OLED as 8 x 4 tiles; flush sends changed ones
 
 // =============================================================================
 // Display Functions (optimized for tiny 64x32 OLED)
@@ -74,82 +79,91 @@ void drawStartup() {
   display.drawStr(4, 12, "PitchComm");
   display.setFont(u8g2_font_5x7_tr);
   display.drawStr(8, 28, loraReady ? "LoRa OK" : "LoRa FAIL");
-  display.sendBuffer();
+  tiles.flush(display);
 }
 
 void drawWaiting() {
   display.clearBuffer();
   display.setFont(u8g2_font_helvB08_tr);
   display.drawStr(4, 20, "Waiting");
-  display.sendBuffer();
+  tiles.flush(display);
 }
 
-void drawSignal(PitchSignal &sig) {
-  display.clearBuffer();
-
-  if (sig.type == 1) {
-    // Reset signal
-    display.setFont(u8g2_font_helvB12_tr);
-    display.drawStr(2, 22, "RESET");
-    display.sendBuffer();
-    return;
-  }
-
-  bool hasPitch = (sig.pitch < 5);
-
-  // Pickoff-only signal
-  if (sig.pickoff > 0 && !hasPitch) {
-    display.setFont(u8g2_font_helvB18_tr);
-    char pkStr[5];
-    snprintf(pkStr, sizeof(pkStr), "PK%d", sig.pickoff);
-    display.drawStr(4, 26, pkStr);
-    display.sendBuffer();
-    return;
-  }
+// Signal screen layout (pitchcomm::Scene slots; font_compiler mirrors the
+// large ones). Once Host_Bench font_compiler has generated CallBitmaps.h the
+// large strings are prebuilt art and helvB18, helvB14 and helvB12 drop out
+// of the image; the corner badges stay text.
+enum { FONT_CALL, FONT_ZONE, FONT_RESET, FONT_BADGE };
+
+const uint8_t* const sceneFonts[] = {
+#ifdef PITCHCOMM_CALL_BITMAPS
+  NULL, NULL, NULL,
+#else
+  u8g2_font_helvB18_tr, u8g2_font_helvB14_tr, u8g2_font_helvB12_tr,
+#endif
+  u8g2_font_4x6_tr
+};
+
+const pitchcomm::SceneStyle signalStyles[pitchcomm::SCENE_STYLES] = {
+  // SCENE_PITCH: pitch on the left, zone on the right
+  { { FONT_CALL, pitchcomm::SCENE_LEFT, 0, 26 },
+    { FONT_CALL, pitchcomm::SCENE_LEFT, 0, 26 },
+    { FONT_ZONE, pitchcomm::SCENE_LEFT, 50, 24 } },
+  // SCENE_RESET, SCENE_PICKOFF, SCENE_THIRD
+  { pitchcomm::SCENE_NO_SLOT, { FONT_RESET, pitchcomm::SCENE_LEFT, 2, 22 }, pitchcomm::SCENE_NO_SLOT },
+  { pitchcomm::SCENE_NO_SLOT, { FONT_CALL,  pitchcomm::SCENE_LEFT, 4, 26 }, pitchcomm::SCENE_NO_SLOT },
+  { pitchcomm::SCENE_NO_SLOT, { FONT_CALL,  pitchcomm::SCENE_LEFT, 14, 26 }, pitchcomm::SCENE_NO_SLOT },
+};
+
+// No "#n" on this panel; PK top-right, 3rd bottom-right
+const pitchcomm::SceneLayout signalLayout = {
+  signalStyles, pitchcomm::SCENE_STYLES, false,
+  { pitchcomm::SCENE_NO_SLOT,
+    { FONT_BADGE, pitchcomm::SCENE_LEFT, 50, 6 },
+    { FONT_BADGE, pitchcomm::SCENE_LEFT, 50, 32 } }
+};
+
+pitchcomm::SceneBackend<U8G2> panel(display, sceneFonts);
+
+#ifdef PITCHCOMM_CALL_BITMAPS
+void drawArt(const pitchcomm::PackedBitmap &art) {
+  display.setBitmapMode(1);             // clear bits leave the frame alone
+  if (!art.empty()) display.drawBitmap(art.x, art.y, art.stride(), art.h, art.bits);
+}
 
-  // Third sign only
-  if (sig.thirdSign > 0 && !hasPitch) {
-    display.setFont(u8g2_font_helvB18_tr);
-    const char* thirdNames[] = {"", "3A", "3B", "3C", "3D"};
-    if (sig.thirdSign <= 4) {
-      display.drawStr(14, 26, thirdNames[sig.thirdSign]);
+void drawSignalArt(const SignalView &sig) {
+  if (sig.isReset()) {
+    drawArt(resetBitmap);
+  } else if (!sig.hasPitch()) {
+    if (sig.pickoff() > 0) {
+      if (sig.pickoff() <= pitchcomm::PICKOFF_MAX) drawArt(pickoffOnlyBitmaps[sig.pickoff()]);
+    } else if (sig.thirdSign() > 0 && sig.thirdSign() <= 4) {
+      drawArt(thirdOnlyBitmaps[sig.thirdSign()]);
     }
-    display.sendBuffer();
-    return;
+  } else {
+    drawArt(pitchBitmaps[sig.pitch()]);
+    if (sig.zone() > 0 && sig.zone() <= 9) drawArt(zoneBitmaps[sig.zone()]);
   }
+}
+#endif
 
-  // Main pitch display
-  if (hasPitch) {
-    // Large pitch name on left side
-    display.setFont(u8g2_font_helvB18_tr);
-    display.drawStr(0, 26, pitchNames[sig.pitch]);
-
-    // Zone number on right side (if present)
-    if (sig.zone > 0 && sig.zone <= 9) {
-      display.setFont(u8g2_font_helvB14_tr);
-      char zoneStr[2];
-      snprintf(zoneStr, sizeof(zoneStr), "%d", sig.zone);
-      display.drawStr(50, 24, zoneStr);
-    }
-
-    // Small pickoff indicator at top-right
-    if (sig.pickoff > 0) {
-      display.setFont(u8g2_font_4x6_tr);
-      char pkStr[3];
-      snprintf(pkStr, sizeof(pkStr), "P%d", sig.pickoff);
-      display.drawStr(50, 6, pkStr);
-    }
-
-    // Small third sign indicator
-    if (sig.thirdSign > 0 && sig.thirdSign <= 4) {
-      display.setFont(u8g2_font_4x6_tr);
-      char tsStr[3];
-      snprintf(tsStr, sizeof(tsStr), "3%c", 'A' + sig.thirdSign - 1);
-      display.drawStr(50, 32, tsStr);
-    }
-  }
+// What this receiver shows for a signal (Host_Bench scene_bench renders it too)
+void buildScene(const SignalView &sig, pitchcomm::Scene &scene) {
+  pitchcomm::signalScene(sig, pitchNames, NULL, scene);
+  if (!scene.badge[1].empty()) scene.badge[1].number("P", sig.pickoff());   // fits the corner
+}
 
-  display.sendBuffer();
+void drawSignal(const SignalView &sig) {
+  pitchcomm::Scene scene;
+  buildScene(sig, scene);
+#ifdef PITCHCOMM_CALL_BITMAPS
+  scene.primary.text[0] = scene.detail.text[0] = '\0';    // prebuilt art below
+#endif
+  pitchcomm::renderScene(panel, scene, signalLayout);
+#ifdef PITCHCOMM_CALL_BITMAPS
+  drawSignalArt(sig);
+#endif
+  tiles.flush(display);
 }
 
 // =============================================================================
@@ -159,7 +173,51 @@ void drawSignal(PitchSignal &sig) {
   ICACHE_RAM_ATTR
 #endif
 void setFlag(void) {
-  receivedFlag = true;
+  rxEvent.notifyFromIsr();
+}
+
+// =============================================================================
+// Link Adaptation (PitchCommLink.h)
+// =============================================================================
+// Reports SNR to the coach and follows its SF steps; SF10 again if the
+// coach goes quiet. Report slot, unique among the signal receivers.
+#ifndef LINK_NODE
+#define LINK_NODE 1
+#endif
+
+pitchcomm::LinkFollower adr(pitchcomm::LINK_SIGNAL, LINK_NODE);
+
+void serviceLink() {
+  if (pitchcomm::sendLinkReport(radio, adr, millis(), setFlag)) {
+    Serial.printf("[LINK] report step=%u\n", adr.step());
+  }
+  if (adr.fallback(millis())) {
+    pitchcomm::tuneLink(radio, adr);
+    Serial.printf("[LINK] Coach silent, back to SF%u\n", adr.current().sf);
+  }
+}
+
+// =============================================================================
+// Radio Profile (PitchCommRadio.h)
+// =============================================================================
+// Factory profile; "profile <name>" on USB serial stores another and
+// retunes. Must match the coach.
+#ifndef RADIO_PROFILE
+#define RADIO_PROFILE pitchcomm::PROFILE_LONG_RANGE
+#endif
+
+pitchcomm::ProfileStore profileStore;
+pitchcomm::ProfileConsole profileConsole;
+
+void serviceProfile() {
+  uint8_t id;
+  if (!profileConsole.poll(Serial, id)) return;
+  const pitchcomm::RadioProfile& p = pitchcomm::radioProfile(id);
+  if (!profileStore.save(id)) Serial.println("[LoRa] Profile not saved");
+  int state = pitchcomm::applyProfile(radio, p);
+  adr.setFamily(pitchcomm::linkFamily(p));
+  radio.startReceive();
+  Serial.printf("[LoRa] Profile %s: %d\n", p.name, state);
 }
 
 // =============================================================================
@@ -169,20 +227,17 @@ void setupLoRa() {
   Serial.println("[LoRa] Init SPI...");
   radioSPI.begin(LORA_SCK, LORA_MISO, LORA_MOSI, LORA_CS);
 
-  Serial.println("[LoRa] Init SX1262...");
-  int state = radio.begin(915.0);
+  // Stored profile, else the factory one; must match the T-Deck's
+  const pitchcomm::RadioProfile& profile =
+      pitchcomm::radioProfile(profileStore.load(RADIO_PROFILE));
+  Serial.printf("[LoRa] Init SX1262, %s...\n", profile.name);
+  int state = pitchcomm::beginProfile(radio, profile, LORA_TCXO_V);
 
   if (state == RADIOLIB_ERR_NONE) {
     Serial.println("[LoRa] OK");
+    adr.setFamily(pitchcomm::linkFamily(profile));
 
-    // Match T-Deck transmitter settings
-    radio.setSpreadingFactor(10);
-    radio.setBandwidth(125.0);
-    radio.setCodingRate(8);
-    radio.setSyncWord(0x12);
-    radio.setOutputPower(22);
-    radio.setPreambleLength(8);
-
+    rxEvent.begin();
     radio.setDio1Action(setFlag);
 
     state = radio.startReceive();
@@ -247,31 +302,47 @@ void loop() {
     return;
   }
 
-  if (receivedFlag) {
-    receivedFlag = false;
+  if (rxEvent.wait(IDLE_TICK_MS)) {
     digitalWrite(LED_PIN, LOW);
 
-    int state = radio.readData((uint8_t*)&lastSignal, sizeof(lastSignal));
-
-    if (state == RADIOLIB_ERR_NONE) {
-      Serial.printf("RX: p=%d z=%d pk=%d 3rd=%d RSSI=%.0f\n",
-        lastSignal.pitch, lastSignal.zone,
-        lastSignal.pickoff, lastSignal.thirdSign,
-        radio.getRSSI());
+    size_t len = radio.getPacketLength();
+    if (len > sizeof(rxBuf)) len = sizeof(rxBuf);
+    int state = radio.readData(rxBuf, len);
+    float rssi = radio.getRSSI();
+    float snr = radio.getSNR();
 
-      drawSignal(lastSignal);
+    // Re-arm before drawing; the frame is already in rxBuf
+    radio.startReceive();
+    uint32_t deafUs = micros() - rxEvent.isrUs();
+    SignalView sig(rxBuf, len);
+    pitchcomm::LinkCommandView cmd(rxBuf, len);
+
+    if (state == RADIOLIB_ERR_NONE && cmd.valid()) {
+      if (adr.onCommand(cmd, (int16_t)(snr * 4), (int16_t)rssi, millis())) {
+        pitchcomm::tuneLink(radio, adr);
+      }
+      Serial.printf("[LINK] step=%u SF%u SNR=%.1f\n", adr.step(), adr.current().sf, snr);
+    } else if (state == RADIOLIB_ERR_NONE && sig.valid()) {
+      adr.onTraffic(millis());
+      drawSignal(sig);
       lastReceived = millis();
+
+      Serial.printf("RX: p=%d z=%d pk=%d 3rd=%d RSSI=%.0f wake=%luus deaf=%luus bus=%uB\n",
+        sig.pitch(), sig.zone(),
+        sig.pickoff(), sig.thirdSign(),
+        rssi, (unsigned long)rxEvent.lastUs(), (unsigned long)deafUs,
+        tiles.lastBytes());
     }
 
-    radio.startReceive();
     digitalWrite(LED_PIN, HIGH);
   }
 
+  serviceLink();
+  serviceProfile();
+
   // Return to waiting after 30s
   if (lastReceived > 0 && millis() - lastReceived > 30000) {
     drawWaiting();
     lastReceived = 0;
   }
-
-  delay(10);
 }
@@ -0,0 +1,82 @@
+# PlatformIO pre-build script: CallBitmaps.h from Host_Bench font_compiler
+#
+# Builds font_compiler with the host C++ compiler, runs it against the fonts
+# this env installed, and puts the generated header on the include path, so
+# every image carries the prebuilt call bitmaps instead of the large fonts.
+# Nothing is written into the source tree.
+#
+#   extra_scripts = pre:../Host_Bench/call_bitmaps.py
+#   custom_call_bitmaps = Heltec_Receiver/src    ; receiver header dir, or
+#                                                ; "all" (sim), or "no"
+#   custom_call_bitmaps_fonts = sim/font_fixture ; optional, default: this
+#                                                ; env's libdeps folder
+#
+# HOST_CXX picks the compiler (default c++, g++ or clang++ on PATH). The
+# build stops when the header cannot be generated; set custom_call_bitmaps
+# = no to build with runtime fonts instead.
+
+import os
+import shutil
+import subprocess
+import sys
+
+Import("env")
+
+
+def fail(msg):
+    sys.stderr.write("call_bitmaps: %s\n" % msg)
+    sys.stderr.write("call_bitmaps: set custom_call_bitmaps = no to build with runtime fonts\n")
+    env.Exit(1)
+
+
+def host_cxx():
+    cxx = os.environ.get("HOST_CXX")
+    if cxx:
+        return cxx
+    for name in ("c++", "g++", "clang++"):
+        if shutil.which(name):
+            return name
+    return None
+
+
+def stale(target, sources):
+    if not os.path.isfile(target):
+        return True
+    built = os.path.getmtime(target)
+    return any(os.path.getmtime(s) > built for s in sources)
+
+
+target = env.GetProjectOption("custom_call_bitmaps", "").strip()
+if target and target != "no":
+    project = env.subst("$PROJECT_DIR")
+    root = os.path.dirname(project)
+    build = env.subst("$BUILD_DIR")
+    out = os.path.join(build, "call_bitmaps")
+    fonts = env.GetProjectOption("custom_call_bitmaps_fonts", "").strip()
+    fonts = os.path.join(project, fonts) if fonts else env.subst("$PROJECT_LIBDEPS_DIR/$PIOENV")
+
+    tool = os.path.join(build, "font_compiler" + (".exe" if sys.platform == "win32" else ""))
+    source = os.path.join(root, "Host_Bench", "src", "font_compiler.cpp")
+    protocol = os.path.join(root, "src", "PitchCommProtocol.h")
+    if stale(tool, [source, protocol]):
+        cxx = host_cxx()
+        if not cxx:
+            fail("no host C++ compiler (set HOST_CXX)")
+        if not os.path.isdir(build):
+            os.makedirs(build)
+        cmd = [cxx, "-std=gnu++11", "-O2", "-I" + os.path.join(root, "src"), source, "-o", tool]
+        if subprocess.call(cmd) != 0:
+            fail("building font_compiler failed")
+
+    cmd = [tool, "--root", root, "--libdeps", fonts, "--out", out]
+    if target != "all":
+        cmd += ["--only", target]
+    if subprocess.call(cmd) != 0:
+        fail("font_compiler could not generate %s (fonts from %s)" % (target, fonts))
+
+    # "CallBitmaps.h" is looked up next to the source before CPPPATH
+    local = os.path.join(root, target, "CallBitmaps.h")
+    if target != "all" and os.path.isfile(local):
+        sys.stderr.write("call_bitmaps: warning: %s shadows the generated header; delete it\n" % local)
+
+    env.Prepend(CPPPATH=[out if target == "all" else os.path.join(out, target)])
@@ -0,0 +1,131 @@
+/*
+ * ============================================================================
+ * ADAFRUIT GFX SIM — drawing base class and GFXcanvas1
+ * ============================================================================
+ * The Adafruit_GFX subset the armband draws with. Subclasses provide
+ * drawPixel(); everything else (rects, bitmaps, metric-only text) is built
+ * on it, as in the real library. GFXcanvas1 is the 1 bpp offscreen canvas:
+ * rows MSB first, padded to whole bytes, set bit = nonzero color.
+ *
+ * Fonts are metric-only stand-ins ({advance, cap height}); glyphs render as
+ * a deterministic bit pattern per character.
+ * ============================================================================
+ */
+
+#ifndef ADAFRUIT_GFX_SIM_H
+#define ADAFRUIT_GFX_SIM_H
+#define _ADAFRUIT_GFX_H   // the real header's guard; PitchCommScene.h keys on it
+
+#include <Arduino.h>
+#include <stdlib.h>
+
+// Metric-only stand-in for Adafruit_GFX GFXfont
+struct GFXfont {
+  uint8_t xAdvance;
+  uint8_t height;
+};
+
+class Adafruit_GFX {
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+  virtual ~Adafruit_GFX() {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void setRotation(uint8_t r) {
+    rotation = r & 3;
+    _width  = (rotation & 1) ? HEIGHT : WIDTH;
+    _height = (rotation & 1) ? WIDTH : HEIGHT;
+  }
+  int16_t width() const  { return _width; }
+  int16_t height() const { return _height; }
+
+  virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t yy = y; yy < y + h; yy++)
+      for (int16_t xx = x; xx < x + w; xx++) drawPixel(xx, yy, color);
+  }
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    fillRect(x, y, w, 1, color);
+    fillRect(x, y + h - 1, w, 1, color);
+    fillRect(x, y, 1, h, color);
+    fillRect(x + w - 1, y, 1, h, color);
+  }
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+    int16_t stride = (w + 7) / 8;
+    for (int16_t yy = 0; yy < h; yy++)
+      for (int16_t xx = 0; xx < w; xx++)
+        if ((bitmap[yy * stride + xx / 8] >> (7 - (xx & 7))) & 1) drawPixel(x + xx, y + yy, color);
+  }
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg) {
+    int16_t stride = (w + 7) / 8;
+    for (int16_t yy = 0; yy < h; yy++)
+      for (int16_t xx = 0; xx < w; xx++)
+        drawPixel(x + xx, y + yy,
+                  ((bitmap[yy * stride + xx / 8] >> (7 - (xx & 7))) & 1) ? color : bg);
+  }
+
+  void setFont(const GFXfont* f) { _font = f; }
+  void setTextColor(uint16_t c)  { _fg = c; }
+  void setCursor(int16_t x, int16_t y) { _cx = x; _cy = y; }
+
+  void getTextBounds(const char* s, int16_t x, int16_t y,
+                     int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    uint8_t adv = _font ? _font->xAdvance : 6;
+    uint8_t ht  = _font ? _font->height : 8;
+    *x1 = x;
+    *y1 = _font ? (int16_t)(y - ht) : y;
+    *w  = (uint16_t)(strlen(s) * adv);
+    *h  = ht;
+  }
+
+  size_t print(const char* s) {
+    uint8_t adv = _font ? _font->xAdvance : 6;
+    uint8_t ht  = _font ? _font->height : 8;
+    int16_t top = _font ? (int16_t)(_cy - ht) : _cy;   // GFX fonts sit on baseline
+    for (const char* p = s; *p; p++) {
+      uint32_t seed = (uint8_t)*p * 2654435761u;
+      for (int gx = 0; gx < adv - 1; gx++)
+        for (int gy = 0; gy < ht; gy++)
+          if ((seed >> ((gx * 7 + gy) & 31)) & 1) drawPixel(_cx + gx, top + gy, _fg);
+      _cx += adv;
+    }
+    return strlen(s);
+  }
+  size_t print(const String& s) { return print(s.c_str()); }
+
+protected:
+  const int16_t WIDTH, HEIGHT;          // raw size, before rotation
+  int16_t  _width, _height;
+  uint8_t  rotation = 0;
+  const GFXfont* _font = NULL;
+  uint16_t _fg = 0;
+  int16_t  _cx = 0, _cy = 0;
+};
+
+class GFXcanvas1 : public Adafruit_GFX {
+public:
+  GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+    _buffer = (uint8_t*)calloc((size_t)((w + 7) / 8) * h, 1);
+  }
+  ~GFXcanvas1() { free(_buffer); }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (!_buffer || x < 0 || y < 0 || x >= _width || y >= _height) return;
+    uint8_t* b = &_buffer[y * ((WIDTH + 7) / 8) + x / 8];
+    if (color) *b |= (uint8_t)(0x80 >> (x & 7));
+    else       *b &= (uint8_t)~(0x80 >> (x & 7));
+  }
+
+  uint8_t* getBuffer() const { return _buffer; }
+
+private:
+  uint8_t* _buffer;
+};
+
+#endif // ADAFRUIT_GFX_SIM_H
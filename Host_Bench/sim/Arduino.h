@@ -0,0 +1,209 @@
+/*
+ * ============================================================================
+ * ARDUINO SIM — host stand-in for the Arduino core
+ * ============================================================================
+ * Just enough of the ESP32 / nRF52 Arduino API for the receiver sketches to
+ * compile unmodified on Linux. Time is virtual: millis()/micros() read a
+ * simulated clock that only moves when the firmware calls delay() or the
+ * harness calls sim::advanceMs(). sim::delayHook(), when set, runs after
+ * every delay() so a harness can deliver packets mid-wait. Serial output is formatted (so its CPU
+ * cost is kept) but only echoed when sim::serialEcho() is set. Serial input
+ * is whatever the harness has typed with Serial.feed().
+ *
+ * Header-only; the sim harness is a single translation unit.
+ * ============================================================================
+ */
+
+#ifndef ARDUINO_SIM_H
+#define ARDUINO_SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+// ============================================================================
+// VIRTUAL CLOCK
+// ============================================================================
+namespace sim {
+
+inline uint64_t& clockUs() {
+  static uint64_t us = 0;
+  return us;
+}
+
+inline void advanceUs(uint64_t us) { clockUs() += us; }
+inline void advanceMs(uint32_t ms) { clockUs() += (uint64_t)ms * 1000; }
+
+typedef void (*Hook)();
+inline Hook& delayHook() {
+  static Hook hook = NULL;
+  return hook;
+}
+
+inline bool& serialEcho() {
+  static bool echo = false;
+  return echo;
+}
+
+} // namespace sim
+
+inline unsigned long millis() { return (unsigned long)(sim::clockUs() / 1000); }
+inline unsigned long micros() { return (unsigned long)sim::clockUs(); }
+inline void delay(unsigned long ms) {
+  sim::advanceMs(ms);
+  if (sim::delayHook()) sim::delayHook()();
+}
+inline void delayMicroseconds(unsigned int us) { sim::advanceUs(us); }
+inline void yield() {}
+
+// ============================================================================
+// GPIO
+// ============================================================================
+#define HIGH    1
+#define LOW     0
+#define INPUT   0
+#define OUTPUT  1
+#define INPUT_PULLUP 2
+
+#define HEX 16
+#define DEC 10
+
+// XIAO nRF52840 pin names
+#define D0  0
+#define D1  1
+#define D2  2
+#define D3  3
+#define D4  4
+#define D5  5
+#define D6  6
+#define D7  7
+#define D8  8
+#define D9  9
+#define D10 10
+
+namespace sim {
+const int PIN_COUNT = 64;
+inline uint8_t* pinLevels() {
+  static uint8_t levels[PIN_COUNT];
+  return levels;
+}
+}
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int pin, int v) {
+  if (pin >= 0 && pin < sim::PIN_COUNT) sim::pinLevels()[pin] = (uint8_t)(v != 0);
+}
+inline int digitalRead(int pin) {
+  return (pin >= 0 && pin < sim::PIN_COUNT) ? sim::pinLevels()[pin] : 0;
+}
+
+// ============================================================================
+// STRING
+// ============================================================================
+class String {
+public:
+  String() {}
+  String(const char* s) : _s(s ? s : "") {}
+  String(const std::string& s) : _s(s) {}
+  String(int v)           { char b[16]; snprintf(b, sizeof(b), "%d", v);  _s = b; }
+  String(unsigned int v)  { char b[16]; snprintf(b, sizeof(b), "%u", v);  _s = b; }
+  String(long v)          { char b[24]; snprintf(b, sizeof(b), "%ld", v); _s = b; }
+  String(unsigned long v) { char b[24]; snprintf(b, sizeof(b), "%lu", v); _s = b; }
+
+  const char* c_str() const { return _s.c_str(); }
+  unsigned int length() const { return (unsigned int)_s.size(); }
+
+  String& operator+=(const String& o) { _s += o._s; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+  friend String operator+(const char* a, const String& b)   { return String(std::string(a) + b._s); }
+  friend String operator+(const String& a, const char* b)   { return String(a._s + b); }
+
+private:
+  std::string _s;
+};
+
+// ============================================================================
+// ESP-IDF HEAP CAPS
+// ============================================================================
+// One host heap serves every capability.
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+
+inline void* heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+inline void  heap_caps_free(void* p) { free(p); }
+
+// ============================================================================
+// SERIAL
+// ============================================================================
+class HardwareSerial {
+public:
+  void begin(unsigned long) {}
+  operator bool() const { return true; }
+
+  size_t printf(const char* fmt, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    emit(buf);
+    return n < 0 ? 0 : (size_t)n;
+  }
+
+  size_t print(const char* s)    { emit(s); return strlen(s); }
+  size_t print(const String& s)  { return print(s.c_str()); }
+  size_t print(char c)           { char b[2] = { c, 0 }; return print(b); }
+  size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+  size_t print(int v, int base = DEC)           { return printNumber((long)v, base); }
+  size_t print(unsigned int v, int base = DEC)  { return printNumber((unsigned long)v, base); }
+  size_t print(long v, int base = DEC)          { return printNumber(v, base); }
+  size_t print(unsigned long v, int base = DEC) { return printNumber(v, base); }
+
+  size_t println()                  { return print("\n"); }
+  template <typename T>
+  size_t println(const T& v)        { size_t n = print(v); return n + println(); }
+  template <typename T>
+  size_t println(const T& v, int b) { size_t n = print(v, b); return n + println(); }
+
+  int available() { return (int)(_in.size() - _inPos); }
+  int read()      { return _inPos < _in.size() ? (unsigned char)_in[_inPos++] : -1; }
+
+  // Harness side: text the firmware will read()
+  void feed(const char* text) {
+    _in.erase(0, _inPos);
+    _inPos = 0;
+    _in += text;
+  }
+
+  // Bytes the firmware tried to log — a cheap proxy for USB/UART cost
+  unsigned long bytesLogged = 0;
+
+  // Optional harness hook, sees every chunk the firmware prints
+  void (*tap)(const char* text) = NULL;
+
+private:
+  size_t printNumber(long v, int base) {
+    return base == HEX ? printf("%lX", (unsigned long)v) : printf("%ld", v);
+  }
+  size_t printNumber(unsigned long v, int base) {
+    return base == HEX ? printf("%lX", v) : printf("%lu", v);
+  }
+  void emit(const char* s) {
+    bytesLogged += strlen(s);
+    if (tap) tap(s);
+    if (sim::serialEcho()) fputs(s, stdout);
+  }
+
+  std::string _in;
+  size_t      _inPos = 0;
+};
+
+static HardwareSerial Serial;
+
+#endif // ARDUINO_SIM_H
@@ -0,0 +1,6 @@
+// Metric-only stand-in for the Adafruit_GFX font (advance, cap height)
+#ifndef SIM_FONT_FreeSans9pt7b
+#define SIM_FONT_FreeSans9pt7b
+#include <Adafruit_GFX.h>
+static const GFXfont FreeSans9pt7b = { 10, 13 };
+#endif
@@ -0,0 +1,6 @@
+// Metric-only stand-in for the Adafruit_GFX font (advance, cap height)
+#ifndef SIM_FONT_FreeSansBold12pt7b
+#define SIM_FONT_FreeSansBold12pt7b
+#include <Adafruit_GFX.h>
+static const GFXfont FreeSansBold12pt7b = { 15, 17 };
+#endif
@@ -0,0 +1,6 @@
+// Metric-only stand-in for the Adafruit_GFX font (advance, cap height)
+#ifndef SIM_FONT_FreeSansBold24pt7b
+#define SIM_FONT_FreeSansBold24pt7b
+#include <Adafruit_GFX.h>
+static const GFXfont FreeSansBold24pt7b = { 30, 34 };
+#endif
@@ -0,0 +1,6 @@
+// Metric-only stand-in for the Adafruit_GFX font (advance, cap height)
+#ifndef SIM_FONT_FreeSansBold9pt7b
+#define SIM_FONT_FreeSansBold9pt7b
+#include <Adafruit_GFX.h>
+static const GFXfont FreeSansBold9pt7b = { 11, 13 };
+#endif
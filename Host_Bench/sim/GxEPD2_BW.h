@@ -0,0 +1,203 @@
+/*
+ * ============================================================================
+ * GxEPD2 SIM — SSD1680 2.13" BW panel with paged drawing and BUSY time
+ * ============================================================================
+ * Implements the GxEPD2_BW subset the armband uses on top of the
+ * Adafruit_GFX fake. The page buffer covers the full panel
+ * (page_height == HEIGHT), so firstPage() / nextPage() run a single pass.
+ * Partial windows are rotated to panel coordinates and widened to whole
+ * bytes as GxEPD2 does. The final nextPage() "sends" the window (counted in
+ * bytesSent) and calls epd2.refresh(), which blocks for the refresh by
+ * advancing the virtual clock like the BUSY wait. A busy callback set on
+ * epd2 runs in place of each 1 ms delay() of that wait, as in
+ * GxEPD2_EPD::_waitWhileBusy().
+ * ============================================================================
+ */
+
+#ifndef GXEPD2_BW_SIM_H
+#define GXEPD2_BW_SIM_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+// Driver side: refresh() issues the SSD1680 update commands and waits on
+// BUSY. The wait is decoded from what was written: 0x22 with the "load LUT"
+// bit set runs the OTP waveform (partialRefreshMs in display mode 2,
+// fullRefreshMs in mode 1); without it, the RAM LUT from 0x32 runs for its
+// frame count at 50 Hz.
+class GxEPD2_213_BN {
+public:
+  static const uint16_t WIDTH  = 122;
+  static const uint16_t HEIGHT = 250;
+  static const uint16_t full_refresh_time    = 2500;
+  static const uint16_t partial_refresh_time = 400;
+
+  GxEPD2_213_BN(int16_t cs, int16_t dc, int16_t rst, int16_t busy)
+    : cs(cs), dc(dc), rst(rst), busy(busy) { memset(_lut, 0, sizeof(_lut)); }
+
+  void setBusyCallback(void (*cb)(const void*), const void* param = 0) {
+    busyCallback = cb;
+    busyCallbackParam = param;
+  }
+
+  void refresh(bool partial_update_mode = false) {
+    if (partial_update_mode) { refresh(0, 0, WIDTH, HEIGHT); return; }
+    _writeCommand(0x22);
+    _writeData(0xF7);
+    _writeCommand(0x20);
+    _waitWhileBusy("_Update_Full", full_refresh_time);
+    _initial_refresh = false;
+    _using_partial_mode = false;
+  }
+
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+    (void)x; (void)y; (void)w; (void)h;
+    if (_initial_refresh) { refresh(false); return; }
+    _using_partial_mode = true;
+    _writeCommand(0x22);
+    _writeData(0xFC);
+    _writeCommand(0x20);
+    _waitWhileBusy("_Update_Part", partial_refresh_time);
+  }
+
+  int16_t cs, dc, rst, busy;
+  void (*busyCallback)(const void*) = NULL;
+  const void* busyCallbackParam = NULL;
+
+  // ---- sim inspection ----
+  uint32_t      partialRefreshMs = partial_refresh_time;
+  uint32_t      fullRefreshMs    = full_refresh_time;
+  unsigned long busyMs = 0;
+  unsigned long partialRefreshes = 0, fullRefreshes = 0, lutRefreshes = 0;
+
+protected:
+  void _writeCommand(uint8_t c) {
+    _cmd = c;
+    _dataIndex = 0;
+    if (c == 0x20) activate();
+  }
+
+  void _writeData(uint8_t d) {
+    if (_cmd == 0x22) _update = d;
+    if (_cmd == 0x32 && _dataIndex < sizeof(_lut)) _lut[_dataIndex] = d;
+    _dataIndex++;
+  }
+
+  // A busy callback runs in place of each 1 ms delay(), as in
+  // GxEPD2_EPD::_waitWhileBusy()
+  void _waitWhileBusy(const char* = 0, uint16_t = 5000) {
+    uint32_t ms = _busyFor;
+    _busyFor = 0;
+    busyMs += ms;
+    if (!busyCallback) { delay(ms); return; }
+    uint64_t end = sim::clockUs() + (uint64_t)ms * 1000;
+    while (sim::clockUs() < end) {
+      uint64_t t = sim::clockUs();
+      busyCallback(busyCallbackParam);
+      if (sim::clockUs() == t) delay(1);          // virtual time must move
+    }
+  }
+
+  bool _initial_refresh = true;
+  bool _using_partial_mode = false;
+
+private:
+  // Master activation: BUSY time for the waveform selected by 0x22
+  void activate() {
+    if (_update & 0x10) {
+      bool mode2 = (_update & 0x08) != 0;
+      _busyFor = mode2 ? partialRefreshMs : fullRefreshMs;
+      if (mode2) partialRefreshes++; else fullRefreshes++;
+      return;
+    }
+    uint32_t frames = 0;
+    for (int g = 0; g < 12; g++) {
+      const uint8_t* tp = &_lut[60 + g * 7];     // TPA TPB SR TPC TPD SR RP
+      frames += (uint32_t)(tp[0] + tp[1] + tp[3] + tp[4]) * (tp[6] + 1);
+    }
+    _busyFor = frames * 20;
+    lutRefreshes++;
+  }
+
+  uint8_t  _cmd = 0, _update = 0;
+  size_t   _dataIndex = 0;
+  uint8_t  _lut[153];
+  uint32_t _busyFor = 0;
+};
+
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_BW : public Adafruit_GFX {
+public:
+  GxEPD2_Type epd2;
+
+  explicit GxEPD2_BW(GxEPD2_Type epd)
+    : Adafruit_GFX(GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT), epd2(epd) {
+    memset(_buf, 0xFF, sizeof(_buf));
+  }
+
+  void init(uint32_t = 0) {}
+
+  void setFullWindow() {
+    _partial = false;
+    _pwX = 0; _pwY = 0; _pwW = GxEPD2_Type::WIDTH; _pwH = GxEPD2_Type::HEIGHT;
+    alignWindow();
+  }
+
+  // Screen rect -> panel rect, x widened to whole bytes (GxEPD2_BW::_rotate)
+  void setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    _partial = true;
+    int16_t t;
+    switch (rotation) {
+      case 1: t = x; x = y; y = t; t = w; w = h; h = t; x = GxEPD2_Type::WIDTH - x - w; break;
+      case 2: x = GxEPD2_Type::WIDTH - x - w; y = GxEPD2_Type::HEIGHT - y - h; break;
+      case 3: t = x; x = y; y = t; t = w; w = h; h = t; y = GxEPD2_Type::HEIGHT - y - h; break;
+    }
+    _pwX = x < 0 ? 0 : x;
+    _pwY = y < 0 ? 0 : y;
+    _pwW = w < (int16_t)GxEPD2_Type::WIDTH - _pwX ? w : GxEPD2_Type::WIDTH - _pwX;
+    _pwH = h < (int16_t)GxEPD2_Type::HEIGHT - _pwY ? h : GxEPD2_Type::HEIGHT - _pwY;
+    alignWindow();
+  }
+
+  void firstPage() { _pageActive = true; }
+
+  bool nextPage() {
+    if (!_pageActive) return false;
+    _pageActive = false;
+    unsigned long bytes = (unsigned long)(_pwW / 8) * _pwH;
+    bytesSent += _partial ? 2 * bytes : bytes;     // partial also writes "previous"
+    if (_partial) epd2.refresh(_pwX, _pwY, _pwW, _pwH);
+    else          epd2.refresh(false);
+    return false;
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+    size_t i = (size_t)y * _width + x;
+    if (color == GxEPD_BLACK) _buf[i / 8] &= (uint8_t)~(0x80 >> (i & 7));
+    else                      _buf[i / 8] |= (uint8_t)(0x80 >> (i & 7));
+  }
+
+  // ---- sim inspection ----
+  const uint8_t* buffer() const { return _buf; }
+  bool partialMode() const { return _partial; }
+
+  unsigned long bytesSent = 0;
+
+private:
+  void alignWindow() {
+    _pwW += _pwX % 8;
+    if (_pwW % 8 > 0) _pwW += 8 - _pwW % 8;
+    _pwX -= _pwX % 8;
+  }
+
+  bool     _partial = false, _pageActive = false;
+  int16_t  _pwX = 0, _pwY = 0, _pwW = 0, _pwH = 0;   // panel coordinates
+  uint8_t  _buf[GxEPD2_Type::WIDTH * GxEPD2_Type::HEIGHT / 8 + 1];
+};
+
+#endif // GXEPD2_BW_SIM_H
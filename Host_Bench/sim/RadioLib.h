@@ -0,0 +1,224 @@
+/*
+ * ============================================================================
+ * RADIOLIB SIM — fake SX1262 driven by the harness
+ * ============================================================================
+ * Implements the calls the receivers make (begin, the PitchCommRadio.h
+ * profile setters, setDio1Action, startReceive, readData, getPacketLength,
+ * getRSSI, getSNR, ...). The
+ * harness delivers packets with injectPacket(), which fires the DIO1
+ * callback exactly like a real RX-done interrupt.
+ *
+ * An optional tag rides along with each packet; onRead(tag, crcOk) fires
+ * on every readData() so a harness can tell which packet the firmware saw.
+ *
+ * transmit() takes the packet's time on air (PitchCommAirtime.h, current
+ * settings) in virtual time with the receiver off, so packets injected
+ * meanwhile are missed; onTransmit(radio, data, len) fires first so a
+ * harness can play the far end.
+ *
+ * A packet injected while the previous one is still unread overwrites it
+ * (the SX1262 has one RX buffer) and is counted in `overwritten`. The time
+ * from RX done to the firmware's next startReceive() is the deaf window
+ * (deafUsTotal / deafUsMax).
+ *
+ * startReceiveDutyCycle() sniffs: windows of rxPeriod from the call on,
+ * sleepPeriod apart. A packet is heard only if one whole window falls
+ * inside its preamble, sent with peerPreamble symbols at the current
+ * settings; otherwise it counts in `missed` and `sniffMissed`. After a
+ * sniffed packet the radio stays off until the firmware re-arms it.
+ * listenUs() is the time the receiver was listening, in either mode.
+ * ============================================================================
+ */
+
+#ifndef RADIOLIB_SIM_H
+#define RADIOLIB_SIM_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <PitchCommAirtime.h>
+
+#define RADIOLIB_ERR_NONE               0
+#define RADIOLIB_ERR_UNKNOWN           -1
+#define RADIOLIB_ERR_CHIP_NOT_FOUND    -2
+#define RADIOLIB_ERR_PACKET_TOO_LONG   -4
+#define RADIOLIB_ERR_RX_TIMEOUT        -6
+#define RADIOLIB_ERR_CRC_MISMATCH      -7
+
+class Module {
+public:
+  Module(int cs, int irq, int rst, int gpio, SPIClass& spi = SPI)
+    : cs(cs), irq(irq), rst(rst), gpio(gpio), spi(&spi) {}
+  int cs, irq, rst, gpio;
+  SPIClass* spi;
+};
+
+class SX1262 {
+public:
+  SX1262(Module* mod) : _mod(mod) {}
+
+  // ---- configuration ----
+  int16_t begin(float freq = 434.0, float bw = 125.0, uint8_t sf = 9, uint8_t cr = 7,
+                uint8_t syncWord = 0x12, int8_t power = 10, uint16_t preamble = 8,
+                float tcxo = 1.6) {
+    this->freq = freq; this->bw = bw; this->sf = sf; this->cr = cr;
+    this->syncWord = syncWord; this->power = power; this->preamble = preamble;
+    (void)tcxo;
+    return beginResult;
+  }
+  int16_t setFrequency(float v)        { freq = v;     return RADIOLIB_ERR_NONE; }
+  int16_t setSpreadingFactor(uint8_t v){ sf = v;       return RADIOLIB_ERR_NONE; }
+  int16_t setBandwidth(float v)        { bw = v;       return RADIOLIB_ERR_NONE; }
+  int16_t setCodingRate(uint8_t v)     { cr = v;       return RADIOLIB_ERR_NONE; }
+  int16_t setSyncWord(uint8_t v, uint8_t = 0x44) { syncWord = v; return RADIOLIB_ERR_NONE; }
+  int16_t setOutputPower(int8_t v)     { power = v;    return RADIOLIB_ERR_NONE; }
+  int16_t setPreambleLength(uint16_t v){ preamble = v; return RADIOLIB_ERR_NONE; }
+  int16_t setCRC(uint8_t len, uint16_t = 0x1D0F, uint16_t = 0x1021, bool = true) {
+    crc = len;
+    return RADIOLIB_ERR_NONE;
+  }
+  int16_t forceLDRO(bool v)            { ldro = v;     return RADIOLIB_ERR_NONE; }
+  int16_t implicitHeader(size_t len)   { implicit = true;  implicitLen = len; return RADIOLIB_ERR_NONE; }
+  int16_t explicitHeader()             { implicit = false; return RADIOLIB_ERR_NONE; }
+  int16_t setDio2AsRfSwitch(bool = true) { return RADIOLIB_ERR_NONE; }
+  int16_t setCurrentLimit(float)         { return RADIOLIB_ERR_NONE; }
+
+  void setDio1Action(void (*func)(void))           { _isr = func; }
+  void setPacketReceivedAction(void (*func)(void)) { _isr = func; }
+  void clearDio1Action()                           { _isr = NULL; }
+
+  // ---- receive path ----
+  int16_t startReceive() {
+    settle();
+    _sniffRxUs = _sniffSleepUs = 0;
+    rxArmed = true;
+    startReceiveCalls++;
+    if (_deaf) {                           // deaf window: RX done -> re-armed
+      uint64_t us = sim::clockUs() - _rxDoneUs;
+      deafUsTotal += us;
+      if (us > deafUsMax) deafUsMax = us;
+      _deaf = false;
+    }
+    return RADIOLIB_ERR_NONE;
+  }
+
+  int16_t startReceiveDutyCycle(uint32_t rxPeriod, uint32_t sleepPeriod) {
+    startReceive();
+    _sniffRxUs    = rxPeriod;
+    _sniffSleepUs = sleepPeriod;
+    _sniffFromUs  = sim::clockUs();
+    dutyCycleCalls++;
+    return RADIOLIB_ERR_NONE;
+  }
+
+  size_t getPacketLength(bool = true) { return _len; }
+
+  int16_t readData(uint8_t* data, size_t len) {
+    size_t n = _len;
+    if (len != 0 && len < n) n = len;
+    memcpy(data, _buf, n);
+    _unread = false;
+    reads++;
+    if (onRead) onRead(_tag, _crcOk);
+    return _crcOk ? RADIOLIB_ERR_NONE : RADIOLIB_ERR_CRC_MISMATCH;
+  }
+
+  // ---- transmit path ----
+  int16_t transmit(const uint8_t* data, size_t len, uint8_t = 0) {
+    settle();
+    rxArmed = false;
+    transmitted++;
+    if (onTransmit) onTransmit(*this, data, len);
+    uint32_t us = getTimeOnAir(len);
+    delay(us / 1000);
+    sim::advanceUs(us % 1000);
+    return RADIOLIB_ERR_NONE;
+  }
+
+  uint32_t getTimeOnAir(size_t len) {
+    pitchcomm::LoRaModem m = { sf, (uint32_t)(bw * 1000.0f + 0.5f), cr, preamble, crc != 0, implicit };
+    return pitchcomm::timeOnAirUs(m, (uint8_t)len);
+  }
+
+  uint64_t listenUs() {
+    settle();
+    return _listenUs;
+  }
+
+  float getRSSI(bool = true) { return _rssi; }
+  float getSNR()             { return _snr; }
+
+  // ---- sim control ----
+  // Returns false when the radio was not listening (packet lost)
+  bool injectPacket(const uint8_t* data, size_t len, float rssi = -60.0f,
+                    float snr = 9.5f, bool crcOk = true, int tag = -1) {
+    if (!rxArmed) { missed++; return false; }
+    if (_sniffRxUs) {
+      if (!sniffHeard(len)) { missed++; sniffMissed++; return false; }
+      settle();
+      rxArmed = false;                     // RX done ends the duty cycle
+    }
+    if (len > sizeof(_buf)) len = sizeof(_buf);
+    if (_unread) overwritten++;
+    memcpy(_buf, data, len);
+    _len = len; _rssi = rssi; _snr = snr; _crcOk = crcOk; _tag = tag;
+    _unread = true;
+    injected++;
+    if (!_deaf) { _deaf = true; _rxDoneUs = sim::clockUs(); }
+    if (_isr) _isr();
+    return true;
+  }
+
+  float    freq = 0, bw = 0;
+  uint8_t  sf = 0, cr = 0, syncWord = 0, crc = 2;
+  int8_t   power = 0;
+  uint16_t preamble = 0;
+  bool     ldro = false, implicit = false;
+  size_t   implicitLen = 0;
+  uint16_t peerPreamble = 8;
+  int16_t  beginResult = RADIOLIB_ERR_NONE;
+
+  bool          rxArmed = false;
+  unsigned long injected = 0, missed = 0, overwritten = 0, reads = 0;
+  unsigned long startReceiveCalls = 0, dutyCycleCalls = 0, transmitted = 0;
+  unsigned long sniffMissed = 0;
+  uint64_t      deafUsTotal = 0, deafUsMax = 0;
+  void        (*onRead)(int tag, bool crcOk) = NULL;
+  void        (*onTransmit)(const SX1262& radio, const uint8_t* data, size_t len) = NULL;
+
+private:
+  // Listening time since the last call, at the duty cycle's share if sniffing
+  void settle() {
+    uint64_t now = sim::clockUs();
+    if (rxArmed) {
+      uint64_t us = now - _settledUs;
+      _listenUs += _sniffRxUs ? us * _sniffRxUs / (_sniffRxUs + _sniffSleepUs) : us;
+    }
+    _settledUs = now;
+  }
+
+  // A packet ending now: did a whole window fall inside its preamble?
+  bool sniffHeard(size_t len) {
+    pitchcomm::LoRaModem m = { sf, (uint32_t)(bw * 1000.0f + 0.5f), cr, peerPreamble, crc != 0, implicit };
+    uint64_t now = sim::clockUs();
+    uint64_t preStart = now - pitchcomm::timeOnAirUs(m, (uint8_t)len);
+    uint64_t preEnd   = preStart + (uint64_t)peerPreamble * pitchcomm::symbolTimeNs(sf, m.bwHz) / 1000;
+    uint64_t period   = _sniffRxUs + _sniffSleepUs;
+    uint64_t k = preStart > _sniffFromUs ? (preStart - _sniffFromUs + period - 1) / period : 0;
+    return _sniffFromUs + k * period + _sniffRxUs <= preEnd;
+  }
+
+  Module*  _mod;
+  void   (*_isr)(void) = NULL;
+  uint8_t  _buf[256];
+  size_t   _len = 0;
+  float    _rssi = 0, _snr = 0;
+  bool     _crcOk = true;
+  int      _tag = -1;
+  bool     _unread = false;
+  bool     _deaf = false;
+  uint64_t _rxDoneUs = 0;
+  uint32_t _sniffRxUs = 0, _sniffSleepUs = 0;
+  uint64_t _sniffFromUs = 0, _settledUs = 0, _listenUs = 0;
+};
+
+#endif // RADIOLIB_SIM_H
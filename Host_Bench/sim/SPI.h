@@ -0,0 +1,27 @@
+/*
+ * SPI SIM — bus objects only; device traffic is modelled by the fakes
+ */
+
+#ifndef SPI_SIM_H
+#define SPI_SIM_H
+
+#include <Arduino.h>
+
+#define FSPI 0
+#define HSPI 1
+
+class SPIClass {
+public:
+  explicit SPIClass(int bus = FSPI) : _bus(bus) {}
+  void begin() {}
+  void begin(int, int, int, int = -1) {}
+  void end() {}
+  int bus() const { return _bus; }
+
+private:
+  int _bus;
+};
+
+static SPIClass SPI;
+
+#endif // SPI_SIM_H
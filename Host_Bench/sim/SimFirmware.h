@@ -0,0 +1,101 @@
+/*
+ * ============================================================================
+ * SIM FIRMWARE — every receiver sketch compiled into one host program
+ * ============================================================================
+ * The fakes in this directory stand in for the Arduino core, SPI/Wire,
+ * RadioLib, U8g2, TFT_eSPI, Adafruit GFX, GxEPD2 and XPowersLib. Each
+ * receiver's unmodified source is then included inside its own namespace so
+ * the five sketches can share one process:
+ *
+ *   heltec::   Heltec_Receiver        (128x64 OLED, SF10 signal frames)
+ *   stick::    Heltec_Stick_Receiver  (64x32 OLED,  SF10 signal frames)
+ *   twatch::   TWatch_Receiver        (240x240 TFT, SF10 signal frames)
+ *   hud::      XIAO_Catcher_HUD       (64x32 OLED,  SF7 call frames)
+ *   armband::  XIAO_Armband_ePaper    (2.13" ePaper, SF7 call frames)
+ *
+ * All fake headers are included first at global scope; their include guards
+ * turn the sketches' own #includes into no-ops. Neither ESP32 nor NRF52 is
+ * defined, so platform-guarded code takes its portable path.
+ *
+ * Global fakes (Serial, Wire, SPI, the virtual clock) are shared by all
+ * five; radios and displays are per-namespace objects.
+ *
+ * With -DSIM_CALL_BITMAPS every receiver gets the CallBitmaps.h that
+ * font_compiler wrote under the include root (--out DIR, then -IDIR), so
+ * the prebuilt-bitmap branches are compiled and run instead of the fonts.
+ * The sim_bitmaps env generates them from sim/font_fixture.
+ * ============================================================================
+ */
+
+#ifndef SIM_FIRMWARE_H
+#define SIM_FIRMWARE_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <RadioLib.h>
+#include <U8g2lib.h>
+#include <TFT_eSPI.h>
+#include <GxEPD2_BW.h>
+#include <XPowersLib.h>
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+#include <Fonts/FreeSansBold12pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <PitchCommProtocol.h>
+#include <PitchCommFec.h>
+#include <PitchCommRxEvent.h>
+#include <PitchCommSpscRing.h>
+#include <PitchCommDirtyTiles.h>
+#include <PitchCommTwimOled.h>
+#include <PitchCommBitmaps.h>
+#include <PitchCommFastLut.h>
+#include <PitchCommScene.h>
+#include <PitchCommHeapProbe.h>
+#include <PitchCommReply.h>
+#include <PitchCommLink.h>
+#include <PitchCommArq.h>
+#include <PitchCommSniff.h>
+#include <PitchCommRadio.h>
+
+namespace heltec {
+#ifdef SIM_CALL_BITMAPS
+#include <Heltec_Receiver/src/CallBitmaps.h>
+#endif
+#include "../../Heltec_Receiver/src/main.cpp"
+}
+#include "SimUndefPins.h"
+
+namespace stick {
+#ifdef SIM_CALL_BITMAPS
+#include <Heltec_Stick_Receiver/src/CallBitmaps.h>
+#endif
+#include "../../Heltec_Stick_Receiver/src/main.cpp"
+}
+#include "SimUndefPins.h"
+
+namespace twatch {
+#ifdef SIM_CALL_BITMAPS
+#include <TWatch_Receiver/src/CallBitmaps.h>
+#endif
+#include "../../TWatch_Receiver/src/main.cpp"
+}
+#include "SimUndefPins.h"
+
+namespace hud {
+#ifdef SIM_CALL_BITMAPS
+#include <XIAO_Catcher_HUD/CallBitmaps.h>
+#endif
+#include "../../XIAO_Catcher_HUD/Catcher_HUD_Receiver_v2.ino"
+}
+#include "SimUndefPins.h"
+
+namespace armband {
+#ifdef SIM_CALL_BITMAPS
+#include <XIAO_Armband_ePaper/CallBitmaps.h>
+#endif
+#include "../../XIAO_Armband_ePaper/Catcher_Armband_ePaper_v1.ino"
+}
+
+#endif // SIM_FIRMWARE_H
@@ -0,0 +1,29 @@
+/*
+ * Sketch-local pin macros would leak into the next sketch's namespace.
+ * No include guard: SimFirmware.h includes this after every sketch.
+ */
+#undef LORA_MISO
+#undef LORA_MOSI
+#undef LORA_SCK
+#undef LORA_CS
+#undef LORA_RST
+#undef LORA_DIO1
+#undef LORA_BUSY
+#undef LORA_TCXO_V
+#undef OLED_SDA
+#undef OLED_SCL
+#undef LED_PIN
+
+// Set by a sketch's generated CallBitmaps.h (Host_Bench font_compiler)
+#undef PITCHCOMM_CALL_BITMAPS
+
+// Per-receiver link adaptation report slot (PitchCommLink.h)
+#undef LINK_NODE
+#undef LINK_TICK_MS
+// Call addressing (PitchCommProtocol.h)
+#undef CALL_DEVICE
+#undef CALL_GROUPS
+// RX duty cycle (PitchCommSniff.h)
+#undef RX_SNIFF_PREAMBLE
+// Factory radio profile (PitchCommRadio.h)
+#undef RADIO_PROFILE
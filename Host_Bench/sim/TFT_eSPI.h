@@ -0,0 +1,176 @@
+/*
+ * ============================================================================
+ * TFT_eSPI SIM — immediate-mode ST7789 with an RGB565 framebuffer
+ * ============================================================================
+ * Every draw call writes straight into the "panel" and counts the pixel
+ * bytes that would cross SPI, like the real library without sprites.
+ * Text uses the GLCD metric (6x8 per char, times text size) with a
+ * deterministic per-character bit pattern.
+ *
+ * TFT_eSprite draws the same way into its own heap buffer without touching
+ * the bus; pushImageDMA() copies a buffer to the panel and counts it as one
+ * SPI burst (completes immediately, so dmaWait() is a no-op).
+ * ============================================================================
+ */
+
+#ifndef TFT_ESPI_SIM_H
+#define TFT_ESPI_SIM_H
+#define _TFT_eSPIH_   // the real header's guard; PitchCommScene.h keys on it
+
+#include <Arduino.h>
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH  240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 240
+#endif
+
+class TFT_eSPI {
+public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT)
+    : _w(w), _h(h), _fb(new uint16_t[(size_t)w * h]()) {}
+  virtual ~TFT_eSPI() { delete[] _fb; }
+
+  void init() {}
+  void begin() {}
+  void setRotation(uint8_t r) { _rotation = r; }
+  int16_t width() const  { return _w; }
+  int16_t height() const { return _h; }
+
+  void fillScreen(uint16_t color) { fillRect(0, 0, _w, _h, color); }
+
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _w) w = _w - x;
+    if (y + h > _h) h = _h - y;
+    if (w <= 0 || h <= 0) return;
+    for (int32_t yy = y; yy < y + h; yy++)
+      for (int32_t xx = x; xx < x + w; xx++) _fb[yy * _w + xx] = color;
+    if (_onBus) {
+      spiBytes += (unsigned long)w * h * 2 + 11;   // + CASET/RASET/RAMWR
+      spiBursts++;
+    }
+  }
+
+  void drawPixel(int32_t x, int32_t y, uint16_t color) { fillRect(x, y, 1, 1, color); }
+
+  // 1 bpp, rows MSB first and padded to bytes; clear bits untouched
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+    int16_t stride = (w + 7) / 8;
+    for (int16_t yy = 0; yy < h; yy++)
+      for (int16_t xx = 0; xx < w; xx++)
+        if ((bitmap[yy * stride + xx / 8] >> (7 - (xx & 7))) & 1) drawPixel(x + xx, y + yy, color);
+  }
+
+  void setTextDatum(uint8_t d)        { _datum = d; }
+  void setTextColor(uint16_t c)       { _fg = c; _bg = c; _bgFill = false; }
+  void setTextColor(uint16_t c, uint16_t bg, bool fill = false) { _fg = c; _bg = bg; _bgFill = fill; }
+  void setTextSize(uint8_t s)         { _size = s ? s : 1; }
+
+  int16_t textWidth(const char* s) const { return (int16_t)(strlen(s) * 6 * _size); }
+  int16_t fontHeight() const             { return (int16_t)(8 * _size); }
+
+  int16_t drawString(const String& s, int32_t x, int32_t y) { return drawString(s.c_str(), x, y); }
+
+  int16_t drawString(const char* s, int32_t x, int32_t y) {
+    int16_t w = textWidth(s), h = fontHeight();
+    int hAlign = _datum % 3, vAlign = _datum / 3;
+    x -= hAlign * w / 2;
+    y -= vAlign * h / 2;
+    for (const char* p = s; *p; p++) {
+      uint32_t seed = (uint8_t)*p * 2654435761u;
+      if (_bgFill) fillRect(x, y, 6 * _size, 8 * _size, _bg);
+      // GLCD renders each set pixel as a size x size block
+      for (int gx = 0; gx < 5; gx++) {
+        for (int gy = 0; gy < 7; gy++) {
+          if ((seed >> ((gx * 5 + gy) & 31)) & 1) {
+            fillRect(x + gx * _size, y + gy * _size, _size, _size, _fg);
+          }
+        }
+      }
+      x += 6 * _size;
+    }
+    return w;
+  }
+
+  // ---- DMA ----
+  bool initDMA(bool = false) { return true; }
+  void startWrite() {}
+  void endWrite()   {}
+  void dmaWait()    {}
+  bool dmaBusy()    { return false; }
+
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    if (x < 0 || y < 0 || x + w > _w || y + h > _h) return;
+    for (int32_t yy = 0; yy < h; yy++)
+      memcpy(&_fb[(y + yy) * _w + x], &data[yy * w], (size_t)w * 2);
+    spiBytes += (unsigned long)w * h * 2 + 11;
+    spiBursts++;
+    dmaPushes++;
+  }
+
+  // ---- sim inspection ----
+  const uint16_t* framebuffer() const { return _fb; }
+
+  unsigned long spiBytes  = 0;
+  unsigned long spiBursts = 0;
+  unsigned long dmaPushes = 0;
+
+protected:
+  int16_t  _w, _h;
+  uint8_t  _rotation = 0;
+  uint8_t  _datum = TL_DATUM;
+  uint16_t _fg = TFT_WHITE, _bg = TFT_BLACK;
+  bool     _bgFill = false;
+  uint8_t  _size = 1;
+  uint16_t* _fb;
+  bool     _onBus = true;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI*) : TFT_eSPI(0, 0) {
+    delete[] _fb;
+    _fb = NULL;
+    _onBus = false;
+  }
+
+  void* createSprite(int16_t w, int16_t h) {
+    deleteSprite();
+    _fb = new uint16_t[(size_t)w * h]();
+    _w = w;
+    _h = h;
+    return _fb;
+  }
+  void deleteSprite() {
+    delete[] _fb;
+    _fb = NULL;
+    _w = _h = 0;
+  }
+  bool created() const { return _fb != NULL; }
+  void setColorDepth(int8_t) {}
+  void fillSprite(uint16_t color) { fillScreen(color); }
+  uint16_t* getPointer() { return _fb; }
+};
+
+#endif // TFT_ESPI_SIM_H
@@ -0,0 +1,164 @@
+/*
+ * ============================================================================
+ * U8G2 SIM — full-buffer SSD1306 with U8g2's tile memory layout
+ * ============================================================================
+ * The buffer uses the real U8g2 page layout: byte (ty * tileWidth * 8 + x)
+ * holds the vertical 8-pixel column x of tile row ty, LSB on top.
+ *
+ * Fonts are metric-only stand-ins ({advance, height}); glyphs render as a
+ * deterministic bit pattern per character so different strings produce
+ * different pixels. sendBuffer() copies the frame to a "panel" buffer and
+ * counts bytes on the bus.
+ * ============================================================================
+ */
+
+#ifndef U8G2LIB_SIM_H
+#define U8G2LIB_SIM_H
+#define U8G2LIB_HH   // the real header's guard; PitchCommScene.h keys on it
+
+#include <Arduino.h>
+
+#define U8X8_PIN_NONE 255
+
+struct u8g2_cb_t { uint8_t rotation; };
+struct u8x8_t    { uint8_t x_offset; };
+static const u8g2_cb_t u8g2_cb_r0 = { 0 };
+#define U8G2_R0 (&u8g2_cb_r0)
+
+// {advance, height}
+static const uint8_t u8g2_font_helvB24_tr[] = { 18, 24 };
+static const uint8_t u8g2_font_helvB18_tr[] = { 14, 18 };
+static const uint8_t u8g2_font_helvB14_tr[] = { 11, 14 };
+static const uint8_t u8g2_font_helvB12_tr[] = {  9, 12 };
+static const uint8_t u8g2_font_helvB10_tr[] = {  8, 10 };
+static const uint8_t u8g2_font_helvB08_tr[] = {  6,  8 };
+static const uint8_t u8g2_font_helvR12_tr[] = {  8, 12 };
+static const uint8_t u8g2_font_helvR10_tr[] = {  7, 10 };
+static const uint8_t u8g2_font_6x10_tr[]    = {  6, 10 };
+static const uint8_t u8g2_font_5x7_tr[]     = {  5,  7 };
+static const uint8_t u8g2_font_4x6_tr[]     = {  4,  6 };
+
+class U8G2 {
+public:
+  U8G2(uint16_t w, uint16_t h) : _w(w), _h(h) {
+    _u8x8.x_offset = w < 128 ? (uint8_t)((128 - w) / 2) : 0;   // SSD1306 is 128 columns
+    memset(_buf, 0, sizeof(_buf));
+    memset(_panel, 0, sizeof(_panel));
+  }
+
+  bool begin() { return true; }
+  void setContrast(uint8_t) {}
+  void setBusClock(uint32_t hz) { busClockHz = hz; }
+
+  void clearBuffer() { memset(_buf, 0, bufferSize()); }
+
+  void sendBuffer() {
+    memcpy(_panel, _buf, bufferSize());
+    bytesSent += bufferSize();
+    frames++;
+  }
+
+  void setFont(const uint8_t* font) { _font = font; }
+  void setDrawColor(uint8_t c) { _color = c; }
+
+  uint16_t getStrWidth(const char* s) const {
+    return _font ? (uint16_t)(strlen(s) * _font[0]) : 0;
+  }
+
+  uint16_t drawStr(int x, int y, const char* s) {
+    if (!_font) return 0;
+    uint8_t adv = _font[0], h = _font[1];
+    int x0 = x;
+    for (const char* p = s; *p; p++) {
+      uint32_t seed = (uint8_t)*p * 2654435761u;
+      for (int gx = 0; gx < adv - 1; gx++) {
+        for (int gy = 0; gy < h; gy++) {
+          if ((seed >> ((gx * 3 + gy) & 31)) & 1) setPixel(x + gx, y - h + gy);
+        }
+      }
+      x += adv;
+    }
+    return (uint16_t)(x - x0);
+  }
+
+  void drawBox(int x, int y, int w, int h) {
+    for (int yy = y; yy < y + h; yy++)
+      for (int xx = x; xx < x + w; xx++) setPixel(xx, yy);
+  }
+
+  // cnt bytes per row, MSB first; clear bits untouched in bitmap mode 1
+  void setBitmapMode(uint8_t transparent) { _bitmapTransparent = transparent; }
+  void drawBitmap(int x, int y, int cnt, int h, const uint8_t* bitmap) {
+    for (int yy = 0; yy < h; yy++)
+      for (int xx = 0; xx < cnt * 8; xx++) {
+        bool ink = (bitmap[yy * cnt + xx / 8] >> (7 - (xx & 7))) & 1;
+        if (ink) setPixel(x + xx, y + yy);
+        else if (!_bitmapTransparent) { _color ^= 1; setPixel(x + xx, y + yy); _color ^= 1; }
+      }
+  }
+
+  uint8_t* getBufferPtr() { return _buf; }
+  u8x8_t*  getU8x8() { return &_u8x8; }
+  uint8_t  getBufferTileWidth() const  { return (uint8_t)(_w / 8); }
+  uint8_t  getBufferTileHeight() const { return (uint8_t)(_h / 8); }
+  uint16_t getDisplayWidth() const  { return _w; }
+  uint16_t getDisplayHeight() const { return _h; }
+
+  // Tile-area flush, as u8g2_UpdateDisplayArea()
+  void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+    for (uint8_t r = ty; r < ty + th && r < getBufferTileHeight(); r++) {
+      size_t off = (size_t)r * _w + tx * 8;
+      size_t n   = (size_t)tw * 8;
+      memcpy(_panel + off, _buf + off, n);
+      bytesSent += n;
+    }
+    frames++;
+  }
+
+  // ---- sim inspection ----
+  const uint8_t* panel() const { return _panel; }
+  size_t bufferSize() const { return (size_t)_w * _h / 8; }
+
+  unsigned long bytesSent = 0;
+  unsigned long frames    = 0;
+  uint32_t      busClockHz = 400000;
+
+private:
+  void setPixel(int x, int y) {
+    if (x < 0 || y < 0 || x >= _w || y >= _h) return;
+    uint8_t& b = _buf[(y / 8) * _w + x];
+    uint8_t  m = (uint8_t)(1 << (y & 7));
+    if (_color) b |= m; else b &= (uint8_t)~m;
+  }
+
+  uint16_t _w, _h;
+  u8x8_t   _u8x8;
+  const uint8_t* _font = NULL;
+  uint8_t _color = 1;
+  uint8_t _bitmapTransparent = 0;
+  uint8_t _buf[128 * 64 / 8];
+  uint8_t _panel[128 * 64 / 8];
+};
+
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2 {
+public:
+  U8G2_SSD1306_128X64_NONAME_F_HW_I2C(const u8g2_cb_t*, uint8_t = U8X8_PIN_NONE,
+                                      uint8_t = U8X8_PIN_NONE, uint8_t = U8X8_PIN_NONE)
+    : U8G2(128, 64) {}
+};
+
+class U8G2_SSD1306_64X32_1F_F_HW_I2C : public U8G2 {
+public:
+  U8G2_SSD1306_64X32_1F_F_HW_I2C(const u8g2_cb_t*, uint8_t = U8X8_PIN_NONE,
+                                 uint8_t = U8X8_PIN_NONE, uint8_t = U8X8_PIN_NONE)
+    : U8G2(64, 32) {}
+};
+
+class U8G2_SSD1306_64X32_1F_F_SW_I2C : public U8G2 {
+public:
+  U8G2_SSD1306_64X32_1F_F_SW_I2C(const u8g2_cb_t*, uint8_t clock, uint8_t data,
+                                 uint8_t reset = U8X8_PIN_NONE)
+    : U8G2(64, 32) { (void)clock; (void)data; (void)reset; }
+};
+
+#endif // U8G2LIB_SIM_H
@@ -0,0 +1,88 @@
+/*
+ * ============================================================================
+ * WIRE SIM — I2C bus with a register file per 7-bit address
+ * ============================================================================
+ * A write transaction [reg][v0][v1]... stores v0.. at reg, reg+1, ...
+ * A read after endTransmission(false) returns bytes from the last register
+ * pointer. Every address ACKs unless marked absent. Bytes on the bus are
+ * counted so the harness can report I2C traffic per call.
+ * ============================================================================
+ */
+
+#ifndef WIRE_SIM_H
+#define WIRE_SIM_H
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  TwoWire() { memset(_absent, 0, sizeof(_absent)); memset(_regs, 0, sizeof(_regs)); }
+
+  bool begin() { return true; }
+  bool begin(int, int, uint32_t = 0) { return true; }
+  void setClock(uint32_t hz) { clockHz = hz; }
+
+  void beginTransmission(uint8_t addr) {
+    _addr = addr & 0x7F;
+    _txLen = 0;
+  }
+
+  size_t write(uint8_t v) {
+    if (_txLen < sizeof(_tx)) _tx[_txLen++] = v;
+    return 1;
+  }
+
+  uint8_t endTransmission(bool stop = true) {
+    (void)stop;
+    bytesOnBus += 1 + _txLen;
+    transactions++;
+    if (_absent[_addr]) return 2;           // NACK on address
+    if (_txLen > 0) {
+      _ptr[_addr] = _tx[0];
+      for (size_t i = 1; i < _txLen; i++) {
+        _regs[_addr][(uint8_t)(_tx[0] + i - 1)] = _tx[i];
+        if (onWrite) onWrite(_addr, (uint8_t)(_tx[0] + i - 1), _tx[i]);
+      }
+    }
+    return 0;
+  }
+
+  uint8_t requestFrom(uint8_t addr, uint8_t count) {
+    _addr = addr & 0x7F;
+    _rxLeft = _absent[_addr] ? 0 : count;
+    bytesOnBus += 1 + _rxLeft;
+    transactions++;
+    return _rxLeft;
+  }
+
+  int available() { return _rxLeft; }
+
+  int read() {
+    if (_rxLeft == 0) return -1;
+    _rxLeft--;
+    return _regs[_addr][_ptr[_addr]++];
+  }
+
+  // ---- sim control ----
+  void setPresent(uint8_t addr, bool present) { _absent[addr & 0x7F] = !present; }
+  uint8_t reg(uint8_t addr, uint8_t r) const { return _regs[addr & 0x7F][r]; }
+  void setReg(uint8_t addr, uint8_t r, uint8_t v) { _regs[addr & 0x7F][r] = v; }
+
+  unsigned long bytesOnBus   = 0;
+  unsigned long transactions = 0;
+  uint32_t      clockHz      = 100000;
+  void (*onWrite)(uint8_t addr, uint8_t reg, uint8_t value) = NULL;
+
+private:
+  uint8_t _addr = 0;
+  uint8_t _tx[64];
+  size_t  _txLen = 0;
+  uint8_t _rxLeft = 0;
+  bool    _absent[128];
+  uint8_t _ptr[128] = {};
+  uint8_t _regs[128][256];
+};
+
+static TwoWire Wire;
+
+#endif // WIRE_SIM_H
@@ -0,0 +1,30 @@
+/*
+ * XPOWERSLIB SIM — AXP2101 rails always come up
+ */
+
+#ifndef XPOWERSLIB_SIM_H
+#define XPOWERSLIB_SIM_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define AXP2101_SLAVE_ADDRESS 0x34
+
+class XPowersAXP2101 {
+public:
+  bool begin(TwoWire&, uint8_t, int, int) { return true; }
+  bool setALDO1Voltage(uint16_t) { return true; }
+  bool setALDO2Voltage(uint16_t) { return true; }
+  bool setALDO3Voltage(uint16_t) { return true; }
+  bool setALDO4Voltage(uint16_t) { return true; }
+  bool setBLDO1Voltage(uint16_t) { return true; }
+  bool setBLDO2Voltage(uint16_t) { return true; }
+  bool enableALDO1() { return true; }
+  bool enableALDO2() { return true; }
+  bool enableALDO3() { return true; }
+  bool enableALDO4() { return true; }
+  bool enableBLDO1() { return true; }
+  bool enableBLDO2() { return true; }
+};
+
+#endif // XPOWERSLIB_SIM_H
@@ -0,0 +1,115 @@
+/*
+ * Font fixture for Host_Bench sim_bitmaps: the real file format with
+ * solid block glyphs (width steps with the character code), not the real
+ * letterforms. Only font_compiler reads it.
+ */
+const uint8_t FreeSansBold12pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8 };
+
+const GFXglyph FreeSansBold12pt7bGlyphs[] PROGMEM = {
+  {      0,   0,   0,  16,    0,    1 },   // 0x20
+  {     50,  13,  17,  16,    1,  -17 },   // 0x21
+  {     24,  12,  17,  16,    1,  -17 },   // 0x22
+  {      0,  11,  17,  16,    1,  -17 },   // 0x23
+  {     50,  13,  17,  16,    1,  -17 },   // 0x24
+  {     24,  12,  17,  16,    1,  -17 },   // 0x25
+  {      0,  11,  17,  16,    1,  -17 },   // 0x26
+  {     50,  13,  17,  16,    1,  -17 },   // 0x27
+  {     24,  12,  17,  16,    1,  -17 },   // 0x28
+  {      0,  11,  17,  16,    1,  -17 },   // 0x29
+  {     50,  13,  17,  16,    1,  -17 },   // 0x2A
+  {     24,  12,  17,  16,    1,  -17 },   // 0x2B
+  {      0,  11,  17,  16,    1,  -17 },   // 0x2C
+  {     50,  13,  17,  16,    1,  -17 },   // 0x2D
+  {     24,  12,  17,  16,    1,  -17 },   // 0x2E
+  {      0,  11,  17,  16,    1,  -17 },   // 0x2F
+  {     50,  13,  17,  16,    1,  -17 },   // 0x30
+  {     24,  12,  17,  16,    1,  -17 },   // 0x31
+  {      0,  11,  17,  16,    1,  -17 },   // 0x32
+  {     50,  13,  17,  16,    1,  -17 },   // 0x33
+  {     24,  12,  17,  16,    1,  -17 },   // 0x34
+  {      0,  11,  17,  16,    1,  -17 },   // 0x35
+  {     50,  13,  17,  16,    1,  -17 },   // 0x36
+  {     24,  12,  17,  16,    1,  -17 },   // 0x37
+  {      0,  11,  17,  16,    1,  -17 },   // 0x38
+  {     50,  13,  17,  16,    1,  -17 },   // 0x39
+  {     24,  12,  17,  16,    1,  -17 },   // 0x3A
+  {      0,  11,  17,  16,    1,  -17 },   // 0x3B
+  {     50,  13,  17,  16,    1,  -17 },   // 0x3C
+  {     24,  12,  17,  16,    1,  -17 },   // 0x3D
+  {      0,  11,  17,  16,    1,  -17 },   // 0x3E
+  {     50,  13,  17,  16,    1,  -17 },   // 0x3F
+  {     24,  12,  17,  16,    1,  -17 },   // 0x40
+  {      0,  11,  17,  16,    1,  -17 },   // 0x41
+  {     50,  13,  17,  16,    1,  -17 },   // 0x42
+  {     24,  12,  17,  16,    1,  -17 },   // 0x43
+  {      0,  11,  17,  16,    1,  -17 },   // 0x44
+  {     50,  13,  17,  16,    1,  -17 },   // 0x45
+  {     24,  12,  17,  16,    1,  -17 },   // 0x46
+  {      0,  11,  17,  16,    1,  -17 },   // 0x47
+  {     50,  13,  17,  16,    1,  -17 },   // 0x48
+  {     24,  12,  17,  16,    1,  -17 },   // 0x49
+  {      0,  11,  17,  16,    1,  -17 },   // 0x4A
+  {     50,  13,  17,  16,    1,  -17 },   // 0x4B
+  {     24,  12,  17,  16,    1,  -17 },   // 0x4C
+  {      0,  11,  17,  16,    1,  -17 },   // 0x4D
+  {     50,  13,  17,  16,    1,  -17 },   // 0x4E
+  {     24,  12,  17,  16,    1,  -17 },   // 0x4F
+  {      0,  11,  17,  16,    1,  -17 },   // 0x50
+  {     50,  13,  17,  16,    1,  -17 },   // 0x51
+  {     24,  12,  17,  16,    1,  -17 },   // 0x52
+  {      0,  11,  17,  16,    1,  -17 },   // 0x53
+  {     50,  13,  17,  16,    1,  -17 },   // 0x54
+  {     24,  12,  17,  16,    1,  -17 },   // 0x55
+  {      0,  11,  17,  16,    1,  -17 },   // 0x56
+  {     50,  13,  17,  16,    1,  -17 },   // 0x57
+  {     24,  12,  17,  16,    1,  -17 },   // 0x58
+  {      0,  11,  17,  16,    1,  -17 },   // 0x59
+  {     50,  13,  17,  16,    1,  -17 },   // 0x5A
+  {     24,  12,  17,  16,    1,  -17 },   // 0x5B
+  {      0,  11,  17,  16,    1,  -17 },   // 0x5C
+  {     50,  13,  17,  16,    1,  -17 },   // 0x5D
+  {     24,  12,  17,  16,    1,  -17 },   // 0x5E
+  {      0,  11,  17,  16,    1,  -17 },   // 0x5F
+  {     50,  13,  17,  16,    1,  -17 },   // 0x60
+  {     24,  12,  17,  16,    1,  -17 },   // 0x61
+  {      0,  11,  17,  16,    1,  -17 },   // 0x62
+  {     50,  13,  17,  16,    1,  -17 },   // 0x63
+  {     24,  12,  17,  16,    1,  -17 },   // 0x64
+  {      0,  11,  17,  16,    1,  -17 },   // 0x65
+  {     50,  13,  17,  16,    1,  -17 },   // 0x66
+  {     24,  12,  17,  16,    1,  -17 },   // 0x67
+  {      0,  11,  17,  16,    1,  -17 },   // 0x68
+  {     50,  13,  17,  16,    1,  -17 },   // 0x69
+  {     24,  12,  17,  16,    1,  -17 },   // 0x6A
+  {      0,  11,  17,  16,    1,  -17 },   // 0x6B
+  {     50,  13,  17,  16,    1,  -17 },   // 0x6C
+  {     24,  12,  17,  16,    1,  -17 },   // 0x6D
+  {      0,  11,  17,  16,    1,  -17 },   // 0x6E
+  {     50,  13,  17,  16,    1,  -17 },   // 0x6F
+  {     24,  12,  17,  16,    1,  -17 },   // 0x70
+  {      0,  11,  17,  16,    1,  -17 },   // 0x71
+  {     50,  13,  17,  16,    1,  -17 },   // 0x72
+  {     24,  12,  17,  16,    1,  -17 },   // 0x73
+  {      0,  11,  17,  16,    1,  -17 },   // 0x74
+  {     50,  13,  17,  16,    1,  -17 },   // 0x75
+  {     24,  12,  17,  16,    1,  -17 },   // 0x76
+  {      0,  11,  17,  16,    1,  -17 },   // 0x77
+  {     50,  13,  17,  16,    1,  -17 },   // 0x78
+  {     24,  12,  17,  16,    1,  -17 },   // 0x79
+  {      0,  11,  17,  16,    1,  -17 },   // 0x7A
+  {     50,  13,  17,  16,    1,  -17 },   // 0x7B
+  {     24,  12,  17,  16,    1,  -17 },   // 0x7C
+  {      0,  11,  17,  16,    1,  -17 },   // 0x7D
+  {     50,  13,  17,  16,    1,  -17 } };   // 0x7E
+
+const GFXfont FreeSansBold12pt7b PROGMEM = {
+  (uint8_t  *)FreeSansBold12pt7bBitmaps,
+  (GFXglyph *)FreeSansBold12pt7bGlyphs,
+  0x20, 0x7E, 25 };
@@ -0,0 +1,131 @@
+/*
+ * Font fixture for Host_Bench sim_bitmaps: the real file format with
+ * solid block glyphs (width steps with the character code), not the real
+ * letterforms. Only font_compiler reads it.
+ */
+const uint8_t FreeSansBold24pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0 };
+
+const GFXglyph FreeSansBold24pt7bGlyphs[] PROGMEM = {
+  {      0,   0,   0,  25,    0,    1 },   // 0x20
+  {    175,  22,  34,  25,    1,  -34 },   // 0x21
+  {     85,  21,  34,  25,    1,  -34 },   // 0x22
+  {      0,  20,  34,  25,    1,  -34 },   // 0x23
+  {    175,  22,  34,  25,    1,  -34 },   // 0x24
+  {     85,  21,  34,  25,    1,  -34 },   // 0x25
+  {      0,  20,  34,  25,    1,  -34 },   // 0x26
+  {    175,  22,  34,  25,    1,  -34 },   // 0x27
+  {     85,  21,  34,  25,    1,  -34 },   // 0x28
+  {      0,  20,  34,  25,    1,  -34 },   // 0x29
+  {    175,  22,  34,  25,    1,  -34 },   // 0x2A
+  {     85,  21,  34,  25,    1,  -34 },   // 0x2B
+  {      0,  20,  34,  25,    1,  -34 },   // 0x2C
+  {    175,  22,  34,  25,    1,  -34 },   // 0x2D
+  {     85,  21,  34,  25,    1,  -34 },   // 0x2E
+  {      0,  20,  34,  25,    1,  -34 },   // 0x2F
+  {    175,  22,  34,  25,    1,  -34 },   // 0x30
+  {     85,  21,  34,  25,    1,  -34 },   // 0x31
+  {      0,  20,  34,  25,    1,  -34 },   // 0x32
+  {    175,  22,  34,  25,    1,  -34 },   // 0x33
+  {     85,  21,  34,  25,    1,  -34 },   // 0x34
+  {      0,  20,  34,  25,    1,  -34 },   // 0x35
+  {    175,  22,  34,  25,    1,  -34 },   // 0x36
+  {     85,  21,  34,  25,    1,  -34 },   // 0x37
+  {      0,  20,  34,  25,    1,  -34 },   // 0x38
+  {    175,  22,  34,  25,    1,  -34 },   // 0x39
+  {     85,  21,  34,  25,    1,  -34 },   // 0x3A
+  {      0,  20,  34,  25,    1,  -34 },   // 0x3B
+  {    175,  22,  34,  25,    1,  -34 },   // 0x3C
+  {     85,  21,  34,  25,    1,  -34 },   // 0x3D
+  {      0,  20,  34,  25,    1,  -34 },   // 0x3E
+  {    175,  22,  34,  25,    1,  -34 },   // 0x3F
+  {     85,  21,  34,  25,    1,  -34 },   // 0x40
+  {      0,  20,  34,  25,    1,  -34 },   // 0x41
+  {    175,  22,  34,  25,    1,  -34 },   // 0x42
+  {     85,  21,  34,  25,    1,  -34 },   // 0x43
+  {      0,  20,  34,  25,    1,  -34 },   // 0x44
+  {    175,  22,  34,  25,    1,  -34 },   // 0x45
+  {     85,  21,  34,  25,    1,  -34 },   // 0x46
+  {      0,  20,  34,  25,    1,  -34 },   // 0x47
+  {    175,  22,  34,  25,    1,  -34 },   // 0x48
+  {     85,  21,  34,  25,    1,  -34 },   // 0x49
+  {      0,  20,  34,  25,    1,  -34 },   // 0x4A
+  {    175,  22,  34,  25,    1,  -34 },   // 0x4B
+  {     85,  21,  34,  25,    1,  -34 },   // 0x4C
+  {      0,  20,  34,  25,    1,  -34 },   // 0x4D
+  {    175,  22,  34,  25,    1,  -34 },   // 0x4E
+  {     85,  21,  34,  25,    1,  -34 },   // 0x4F
+  {      0,  20,  34,  25,    1,  -34 },   // 0x50
+  {    175,  22,  34,  25,    1,  -34 },   // 0x51
+  {     85,  21,  34,  25,    1,  -34 },   // 0x52
+  {      0,  20,  34,  25,    1,  -34 },   // 0x53
+  {    175,  22,  34,  25,    1,  -34 },   // 0x54
+  {     85,  21,  34,  25,    1,  -34 },   // 0x55
+  {      0,  20,  34,  25,    1,  -34 },   // 0x56
+  {    175,  22,  34,  25,    1,  -34 },   // 0x57
+  {     85,  21,  34,  25,    1,  -34 },   // 0x58
+  {      0,  20,  34,  25,    1,  -34 },   // 0x59
+  {    175,  22,  34,  25,    1,  -34 },   // 0x5A
+  {     85,  21,  34,  25,    1,  -34 },   // 0x5B
+  {      0,  20,  34,  25,    1,  -34 },   // 0x5C
+  {    175,  22,  34,  25,    1,  -34 },   // 0x5D
+  {     85,  21,  34,  25,    1,  -34 },   // 0x5E
+  {      0,  20,  34,  25,    1,  -34 },   // 0x5F
+  {    175,  22,  34,  25,    1,  -34 },   // 0x60
+  {     85,  21,  34,  25,    1,  -34 },   // 0x61
+  {      0,  20,  34,  25,    1,  -34 },   // 0x62
+  {    175,  22,  34,  25,    1,  -34 },   // 0x63
+  {     85,  21,  34,  25,    1,  -34 },   // 0x64
+  {      0,  20,  34,  25,    1,  -34 },   // 0x65
+  {    175,  22,  34,  25,    1,  -34 },   // 0x66
+  {     85,  21,  34,  25,    1,  -34 },   // 0x67
+  {      0,  20,  34,  25,    1,  -34 },   // 0x68
+  {    175,  22,  34,  25,    1,  -34 },   // 0x69
+  {     85,  21,  34,  25,    1,  -34 },   // 0x6A
+  {      0,  20,  34,  25,    1,  -34 },   // 0x6B
+  {    175,  22,  34,  25,    1,  -34 },   // 0x6C
+  {     85,  21,  34,  25,    1,  -34 },   // 0x6D
+  {      0,  20,  34,  25,    1,  -34 },   // 0x6E
+  {    175,  22,  34,  25,    1,  -34 },   // 0x6F
+  {     85,  21,  34,  25,    1,  -34 },   // 0x70
+  {      0,  20,  34,  25,    1,  -34 },   // 0x71
+  {    175,  22,  34,  25,    1,  -34 },   // 0x72
+  {     85,  21,  34,  25,    1,  -34 },   // 0x73
+  {      0,  20,  34,  25,    1,  -34 },   // 0x74
+  {    175,  22,  34,  25,    1,  -34 },   // 0x75
+  {     85,  21,  34,  25,    1,  -34 },   // 0x76
+  {      0,  20,  34,  25,    1,  -34 },   // 0x77
+  {    175,  22,  34,  25,    1,  -34 },   // 0x78
+  {     85,  21,  34,  25,    1,  -34 },   // 0x79
+  {      0,  20,  34,  25,    1,  -34 },   // 0x7A
+  {    175,  22,  34,  25,    1,  -34 },   // 0x7B
+  {     85,  21,  34,  25,    1,  -34 },   // 0x7C
+  {      0,  20,  34,  25,    1,  -34 },   // 0x7D
+  {    175,  22,  34,  25,    1,  -34 } };   // 0x7E
+
+const GFXfont FreeSansBold24pt7b PROGMEM = {
+  (uint8_t  *)FreeSansBold24pt7bBitmaps,
+  (GFXglyph *)FreeSansBold24pt7bGlyphs,
+  0x20, 0x7E, 42 };
@@ -0,0 +1,163 @@
+/*
+ * Font fixture for Host_Bench sim_bitmaps: the real file format with
+ * solid block glyphs (width steps with the character code), not the real
+ * letterforms. Only font_compiler reads it.
+ */
+#include "u8g2.h"
+
+const uint8_t u8g2_font_helvB24_tr[877] U8G2_FONT_SECTION("u8g2_font_helvB24_tr") = 
+  "\137\0\2\5\5\6\2\2\6\16\30\0\0\30\0\30\0\1\45\2\105\0\0\40\5\0\320\27\41\11\16\323"
+  "\27\367\377\377\7\42\11\15\323\227\366\377\377\7\43\11\14\323\27\366\377\377\7\44\11\16\323\27\367\377\377\7"
+  "\45\11\15\323\227\366\377\377\7\46\11\14\323\27\366\377\377\7\47\11\16\323\27\367\377\377\7\50\11\15\323\227"
+  "\366\377\377\7\51\11\14\323\27\366\377\377\7\52\11\16\323\27\367\377\377\7\53\11\15\323\227\366\377\377\7\54"
+  "\11\14\323\27\366\377\377\7\55\11\16\323\27\367\377\377\7\56\11\15\323\227\366\377\377\7\57\11\14\323\27\366"
+  "\377\377\7\60\11\16\323\27\367\377\377\7\61\11\15\323\227\366\377\377\7\62\11\14\323\27\366\377\377\7\63\11"
+  "\16\323\27\367\377\377\7\64\11\15\323\227\366\377\377\7\65\11\14\323\27\366\377\377\7\66\11\16\323\27\367\377"
+  "\377\7\67\11\15\323\227\366\377\377\7\70\11\14\323\27\366\377\377\7\71\11\16\323\27\367\377\377\7\72\11\15"
+  "\323\227\366\377\377\7\73\11\14\323\27\366\377\377\7\74\11\16\323\27\367\377\377\7\75\11\15\323\227\366\377\377"
+  "\7\76\11\14\323\27\366\377\377\7\77\11\16\323\27\367\377\377\7\100\11\15\323\227\366\377\377\7\101\11\14\323"
+  "\27\366\377\377\7\102\11\16\323\27\367\377\377\7\103\11\15\323\227\366\377\377\7\104\11\14\323\27\366\377\377\7"
+  "\105\11\16\323\27\367\377\377\7\106\11\15\323\227\366\377\377\7\107\11\14\323\27\366\377\377\7\110\11\16\323\27"
+  "\367\377\377\7\111\11\15\323\227\366\377\377\7\112\11\14\323\27\366\377\377\7\113\11\16\323\27\367\377\377\7\114"
+  "\11\15\323\227\366\377\377\7\115\11\14\323\27\366\377\377\7\116\11\16\323\27\367\377\377\7\117\11\15\323\227\366"
+  "\377\377\7\120\11\14\323\27\366\377\377\7\121\11\16\323\27\367\377\377\7\122\11\15\323\227\366\377\377\7\123\11"
+  "\14\323\27\366\377\377\7\124\11\16\323\27\367\377\377\7\125\11\15\323\227\366\377\377\7\126\11\14\323\27\366\377"
+  "\377\7\127\11\16\323\27\367\377\377\7\130\11\15\323\227\366\377\377\7\131\11\14\323\27\366\377\377\7\132\11\16"
+  "\323\27\367\377\377\7\133\11\15\323\227\366\377\377\7\134\11\14\323\27\366\377\377\7\135\11\16\323\27\367\377\377"
+  "\7\136\11\15\323\227\366\377\377\7\137\11\14\323\27\366\377\377\7\140\11\16\323\27\367\377\377\7\141\11\15\323"
+  "\227\366\377\377\7\142\11\14\323\27\366\377\377\7\143\11\16\323\27\367\377\377\7\144\11\15\323\227\366\377\377\7"
+  "\145\11\14\323\27\366\377\377\7\146\11\16\323\27\367\377\377\7\147\11\15\323\227\366\377\377\7\150\11\14\323\27"
+  "\366\377\377\7\151\11\16\323\27\367\377\377\7\152\11\15\323\227\366\377\377\7\153\11\14\323\27\366\377\377\7\154"
+  "\11\16\323\27\367\377\377\7\155\11\15\323\227\366\377\377\7\156\11\14\323\27\366\377\377\7\157\11\16\323\27\367"
+  "\377\377\7\160\11\15\323\227\366\377\377\7\161\11\14\323\27\366\377\377\7\162\11\16\323\27\367\377\377\7\163\11"
+  "\15\323\227\366\377\377\7\164\11\14\323\27\366\377\377\7\165\11\16\323\27\367\377\377\7\166\11\15\323\227\366\377"
+  "\377\7\167\11\14\323\27\366\377\377\7\170\11\16\323\27\367\377\377\7\171\11\15\323\227\366\377\377\7\172\11\14"
+  "\323\27\366\377\377\7\173\11\16\323\27\367\377\377\7\174\11\15\323\227\366\377\377\7\175\11\14\323\27\366\377\377"
+  "\7\176\11\16\323\27\367\377\377\7\0\0";
+
+const uint8_t u8g2_font_helvB18_tr[783] U8G2_FONT_SECTION("u8g2_font_helvB18_tr") = 
+  "\137\0\2\5\5\6\2\2\6\13\22\0\0\22\0\22\0\1\5\2\5\0\0\40\5\0\120\26\41\10\113\122"
+  "\226\365\377\37\42\10\112\122\26\365\377\37\43\10\111\122\226\364\377\37\44\10\113\122\226\365\377\37\45\10\112\122"
+  "\26\365\377\37\46\10\111\122\226\364\377\37\47\10\113\122\226\365\377\37\50\10\112\122\26\365\377\37\51\10\111\122"
+  "\226\364\377\37\52\10\113\122\226\365\377\37\53\10\112\122\26\365\377\37\54\10\111\122\226\364\377\37\55\10\113\122"
+  "\226\365\377\37\56\10\112\122\26\365\377\37\57\10\111\122\226\364\377\37\60\10\113\122\226\365\377\37\61\10\112\122"
+  "\26\365\377\37\62\10\111\122\226\364\377\37\63\10\113\122\226\365\377\37\64\10\112\122\26\365\377\37\65\10\111\122"
+  "\226\364\377\37\66\10\113\122\226\365\377\37\67\10\112\122\26\365\377\37\70\10\111\122\226\364\377\37\71\10\113\122"
+  "\226\365\377\37\72\10\112\122\26\365\377\37\73\10\111\122\226\364\377\37\74\10\113\122\226\365\377\37\75\10\112\122"
+  "\26\365\377\37\76\10\111\122\226\364\377\37\77\10\113\122\226\365\377\37\100\10\112\122\26\365\377\37\101\10\111\122"
+  "\226\364\377\37\102\10\113\122\226\365\377\37\103\10\112\122\26\365\377\37\104\10\111\122\226\364\377\37\105\10\113\122"
+  "\226\365\377\37\106\10\112\122\26\365\377\37\107\10\111\122\226\364\377\37\110\10\113\122\226\365\377\37\111\10\112\122"
+  "\26\365\377\37\112\10\111\122\226\364\377\37\113\10\113\122\226\365\377\37\114\10\112\122\26\365\377\37\115\10\111\122"
+  "\226\364\377\37\116\10\113\122\226\365\377\37\117\10\112\122\26\365\377\37\120\10\111\122\226\364\377\37\121\10\113\122"
+  "\226\365\377\37\122\10\112\122\26\365\377\37\123\10\111\122\226\364\377\37\124\10\113\122\226\365\377\37\125\10\112\122"
+  "\26\365\377\37\126\10\111\122\226\364\377\37\127\10\113\122\226\365\377\37\130\10\112\122\26\365\377\37\131\10\111\122"
+  "\226\364\377\37\132\10\113\122\226\365\377\37\133\10\112\122\26\365\377\37\134\10\111\122\226\364\377\37\135\10\113\122"
+  "\226\365\377\37\136\10\112\122\26\365\377\37\137\10\111\122\226\364\377\37\140\10\113\122\226\365\377\37\141\10\112\122"
+  "\26\365\377\37\142\10\111\122\226\364\377\37\143\10\113\122\226\365\377\37\144\10\112\122\26\365\377\37\145\10\111\122"
+  "\226\364\377\37\146\10\113\122\226\365\377\37\147\10\112\122\26\365\377\37\150\10\111\122\226\364\377\37\151\10\113\122"
+  "\226\365\377\37\152\10\112\122\26\365\377\37\153\10\111\122\226\364\377\37\154\10\113\122\226\365\377\37\155\10\112\122"
+  "\26\365\377\37\156\10\111\122\226\364\377\37\157\10\113\122\226\365\377\37\160\10\112\122\26\365\377\37\161\10\111\122"
+  "\226\364\377\37\162\10\113\122\226\365\377\37\163\10\112\122\26\365\377\37\164\10\111\122\226\364\377\37\165\10\113\122"
+  "\226\365\377\37\166\10\112\122\26\365\377\37\167\10\111\122\226\364\377\37\170\10\113\122\226\365\377\37\171\10\112\122"
+  "\26\365\377\37\172\10\111\122\226\364\377\37\173\10\113\122\226\365\377\37\174\10\112\122\26\365\377\37\175\10\111\122"
+  "\226\364\377\37\176\10\113\122\226\365\377\37\0\0";
+
+const uint8_t u8g2_font_helvB14_tr[783] U8G2_FONT_SECTION("u8g2_font_helvB14_tr") = 
+  "\137\0\2\5\5\6\2\2\6\11\16\0\0\16\0\16\0\1\5\2\5\0\0\40\5\0\120\25\41\10\311\121"
+  "\225\364\377\1\42\10\310\121\25\364\377\1\43\10\307\121\225\363\377\1\44\10\311\121\225\364\377\1\45\10\310\121"
+  "\25\364\377\1\46\10\307\121\225\363\377\1\47\10\311\121\225\364\377\1\50\10\310\121\25\364\377\1\51\10\307\121"
+  "\225\363\377\1\52\10\311\121\225\364\377\1\53\10\310\121\25\364\377\1\54\10\307\121\225\363\377\1\55\10\311\121"
+  "\225\364\377\1\56\10\310\121\25\364\377\1\57\10\307\121\225\363\377\1\60\10\311\121\225\364\377\1\61\10\310\121"
+  "\25\364\377\1\62\10\307\121\225\363\377\1\63\10\311\121\225\364\377\1\64\10\310\121\25\364\377\1\65\10\307\121"
+  "\225\363\377\1\66\10\311\121\225\364\377\1\67\10\310\121\25\364\377\1\70\10\307\121\225\363\377\1\71\10\311\121"
+  "\225\364\377\1\72\10\310\121\25\364\377\1\73\10\307\121\225\363\377\1\74\10\311\121\225\364\377\1\75\10\310\121"
+  "\25\364\377\1\76\10\307\121\225\363\377\1\77\10\311\121\225\364\377\1\100\10\310\121\25\364\377\1\101\10\307\121"
+  "\225\363\377\1\102\10\311\121\225\364\377\1\103\10\310\121\25\364\377\1\104\10\307\121\225\363\377\1\105\10\311\121"
+  "\225\364\377\1\106\10\310\121\25\364\377\1\107\10\307\121\225\363\377\1\110\10\311\121\225\364\377\1\111\10\310\121"
+  "\25\364\377\1\112\10\307\121\225\363\377\1\113\10\311\121\225\364\377\1\114\10\310\121\25\364\377\1\115\10\307\121"
+  "\225\363\377\1\116\10\311\121\225\364\377\1\117\10\310\121\25\364\377\1\120\10\307\121\225\363\377\1\121\10\311\121"
+  "\225\364\377\1\122\10\310\121\25\364\377\1\123\10\307\121\225\363\377\1\124\10\311\121\225\364\377\1\125\10\310\121"
+  "\25\364\377\1\126\10\307\121\225\363\377\1\127\10\311\121\225\364\377\1\130\10\310\121\25\364\377\1\131\10\307\121"
+  "\225\363\377\1\132\10\311\121\225\364\377\1\133\10\310\121\25\364\377\1\134\10\307\121\225\363\377\1\135\10\311\121"
+  "\225\364\377\1\136\10\310\121\25\364\377\1\137\10\307\121\225\363\377\1\140\10\311\121\225\364\377\1\141\10\310\121"
+  "\25\364\377\1\142\10\307\121\225\363\377\1\143\10\311\121\225\364\377\1\144\10\310\121\25\364\377\1\145\10\307\121"
+  "\225\363\377\1\146\10\311\121\225\364\377\1\147\10\310\121\25\364\377\1\150\10\307\121\225\363\377\1\151\10\311\121"
+  "\225\364\377\1\152\10\310\121\25\364\377\1\153\10\307\121\225\363\377\1\154\10\311\121\225\364\377\1\155\10\310\121"
+  "\25\364\377\1\156\10\307\121\225\363\377\1\157\10\311\121\225\364\377\1\160\10\310\121\25\364\377\1\161\10\307\121"
+  "\225\363\377\1\162\10\311\121\225\364\377\1\163\10\310\121\25\364\377\1\164\10\307\121\225\363\377\1\165\10\311\121"
+  "\225\364\377\1\166\10\310\121\25\364\377\1\167\10\307\121\225\363\377\1\170\10\311\121\225\364\377\1\171\10\310\121"
+  "\25\364\377\1\172\10\307\121\225\363\377\1\173\10\311\121\225\364\377\1\174\10\310\121\25\364\377\1\175\10\307\121"
+  "\225\363\377\1\176\10\311\121\225\364\377\1\0\0";
+
+const uint8_t u8g2_font_helvB12_tr[689] U8G2_FONT_SECTION("u8g2_font_helvB12_tr") = 
+  "\137\0\2\5\5\6\2\2\6\10\14\0\0\14\0\14\0\0\345\1\305\0\0\40\5\0\320\24\41\7\210\321"
+  "\24\364\177\42\7\207\321\224\363\177\43\7\206\321\24\363\177\44\7\210\321\24\364\177\45\7\207\321\224\363\177\46"
+  "\7\206\321\24\363\177\47\7\210\321\24\364\177\50\7\207\321\224\363\177\51\7\206\321\24\363\177\52\7\210\321\24"
+  "\364\177\53\7\207\321\224\363\177\54\7\206\321\24\363\177\55\7\210\321\24\364\177\56\7\207\321\224\363\177\57\7"
+  "\206\321\24\363\177\60\7\210\321\24\364\177\61\7\207\321\224\363\177\62\7\206\321\24\363\177\63\7\210\321\24\364"
+  "\177\64\7\207\321\224\363\177\65\7\206\321\24\363\177\66\7\210\321\24\364\177\67\7\207\321\224\363\177\70\7\206"
+  "\321\24\363\177\71\7\210\321\24\364\177\72\7\207\321\224\363\177\73\7\206\321\24\363\177\74\7\210\321\24\364\177"
+  "\75\7\207\321\224\363\177\76\7\206\321\24\363\177\77\7\210\321\24\364\177\100\7\207\321\224\363\177\101\7\206\321"
+  "\24\363\177\102\7\210\321\24\364\177\103\7\207\321\224\363\177\104\7\206\321\24\363\177\105\7\210\321\24\364\177\106"
+  "\7\207\321\224\363\177\107\7\206\321\24\363\177\110\7\210\321\24\364\177\111\7\207\321\224\363\177\112\7\206\321\24"
+  "\363\177\113\7\210\321\24\364\177\114\7\207\321\224\363\177\115\7\206\321\24\363\177\116\7\210\321\24\364\177\117\7"
+  "\207\321\224\363\177\120\7\206\321\24\363\177\121\7\210\321\24\364\177\122\7\207\321\224\363\177\123\7\206\321\24\363"
+  "\177\124\7\210\321\24\364\177\125\7\207\321\224\363\177\126\7\206\321\24\363\177\127\7\210\321\24\364\177\130\7\207"
+  "\321\224\363\177\131\7\206\321\24\363\177\132\7\210\321\24\364\177\133\7\207\321\224\363\177\134\7\206\321\24\363\177"
+  "\135\7\210\321\24\364\177\136\7\207\321\224\363\177\137\7\206\321\24\363\177\140\7\210\321\24\364\177\141\7\207\321"
+  "\224\363\177\142\7\206\321\24\363\177\143\7\210\321\24\364\177\144\7\207\321\224\363\177\145\7\206\321\24\363\177\146"
+  "\7\210\321\24\364\177\147\7\207\321\224\363\177\150\7\206\321\24\363\177\151\7\210\321\24\364\177\152\7\207\321\224"
+  "\363\177\153\7\206\321\24\363\177\154\7\210\321\24\364\177\155\7\207\321\224\363\177\156\7\206\321\24\363\177\157\7"
+  "\210\321\24\364\177\160\7\207\321\224\363\177\161\7\206\321\24\363\177\162\7\210\321\24\364\177\163\7\207\321\224\363"
+  "\177\164\7\206\321\24\363\177\165\7\210\321\24\364\177\166\7\207\321\224\363\177\167\7\206\321\24\363\177\170\7\210"
+  "\321\24\364\177\171\7\207\321\224\363\177\172\7\206\321\24\363\177\173\7\210\321\24\364\177\174\7\207\321\224\363\177"
+  "\175\7\206\321\24\363\177\176\7\210\321\24\364\177\0\0";
+
+const uint8_t u8g2_font_helvB10_tr[689] U8G2_FONT_SECTION("u8g2_font_helvB10_tr") = 
+  "\137\0\2\5\5\6\2\2\6\7\12\0\0\12\0\12\0\0\345\1\305\0\0\40\5\0\120\24\41\7\107\121"
+  "\224\363\37\42\7\106\121\24\363\37\43\7\105\121\224\362\37\44\7\107\121\224\363\37\45\7\106\121\24\363\37\46"
+  "\7\105\121\224\362\37\47\7\107\121\224\363\37\50\7\106\121\24\363\37\51\7\105\121\224\362\37\52\7\107\121\224"
+  "\363\37\53\7\106\121\24\363\37\54\7\105\121\224\362\37\55\7\107\121\224\363\37\56\7\106\121\24\363\37\57\7"
+  "\105\121\224\362\37\60\7\107\121\224\363\37\61\7\106\121\24\363\37\62\7\105\121\224\362\37\63\7\107\121\224\363"
+  "\37\64\7\106\121\24\363\37\65\7\105\121\224\362\37\66\7\107\121\224\363\37\67\7\106\121\24\363\37\70\7\105"
+  "\121\224\362\37\71\7\107\121\224\363\37\72\7\106\121\24\363\37\73\7\105\121\224\362\37\74\7\107\121\224\363\37"
+  "\75\7\106\121\24\363\37\76\7\105\121\224\362\37\77\7\107\121\224\363\37\100\7\106\121\24\363\37\101\7\105\121"
+  "\224\362\37\102\7\107\121\224\363\37\103\7\106\121\24\363\37\104\7\105\121\224\362\37\105\7\107\121\224\363\37\106"
+  "\7\106\121\24\363\37\107\7\105\121\224\362\37\110\7\107\121\224\363\37\111\7\106\121\24\363\37\112\7\105\121\224"
+  "\362\37\113\7\107\121\224\363\37\114\7\106\121\24\363\37\115\7\105\121\224\362\37\116\7\107\121\224\363\37\117\7"
+  "\106\121\24\363\37\120\7\105\121\224\362\37\121\7\107\121\224\363\37\122\7\106\121\24\363\37\123\7\105\121\224\362"
+  "\37\124\7\107\121\224\363\37\125\7\106\121\24\363\37\126\7\105\121\224\362\37\127\7\107\121\224\363\37\130\7\106"
+  "\121\24\363\37\131\7\105\121\224\362\37\132\7\107\121\224\363\37\133\7\106\121\24\363\37\134\7\105\121\224\362\37"
+  "\135\7\107\121\224\363\37\136\7\106\121\24\363\37\137\7\105\121\224\362\37\140\7\107\121\224\363\37\141\7\106\121"
+  "\24\363\37\142\7\105\121\224\362\37\143\7\107\121\224\363\37\144\7\106\121\24\363\37\145\7\105\121\224\362\37\146"
+  "\7\107\121\224\363\37\147\7\106\121\24\363\37\150\7\105\121\224\362\37\151\7\107\121\224\363\37\152\7\106\121\24"
+  "\363\37\153\7\105\121\224\362\37\154\7\107\121\224\363\37\155\7\106\121\24\363\37\156\7\105\121\224\362\37\157\7"
+  "\107\121\224\363\37\160\7\106\121\24\363\37\161\7\105\121\224\362\37\162\7\107\121\224\363\37\163\7\106\121\24\363"
+  "\37\164\7\105\121\224\362\37\165\7\107\121\224\363\37\166\7\106\121\24\363\37\167\7\105\121\224\362\37\170\7\107"
+  "\121\224\363\37\171\7\106\121\24\363\37\172\7\105\121\224\362\37\173\7\107\121\224\363\37\174\7\106\121\24\363\37"
+  "\175\7\105\121\224\362\37\176\7\107\121\224\363\37\0\0";
+
+const uint8_t u8g2_font_5x7_tr[689] U8G2_FONT_SECTION("u8g2_font_5x7_tr") = 
+  "\137\0\2\5\5\6\2\2\6\4\7\0\0\7\0\7\0\0\345\1\305\0\0\40\5\0\320\22\41\7\344\320"
+  "\22\362\3\42\7\343\320\222\361\3\43\7\342\320\22\361\3\44\7\344\320\22\362\3\45\7\343\320\222\361\3\46"
+  "\7\342\320\22\361\3\47\7\344\320\22\362\3\50\7\343\320\222\361\3\51\7\342\320\22\361\3\52\7\344\320\22"
+  "\362\3\53\7\343\320\222\361\3\54\7\342\320\22\361\3\55\7\344\320\22\362\3\56\7\343\320\222\361\3\57\7"
+  "\342\320\22\361\3\60\7\344\320\22\362\3\61\7\343\320\222\361\3\62\7\342\320\22\361\3\63\7\344\320\22\362"
+  "\3\64\7\343\320\222\361\3\65\7\342\320\22\361\3\66\7\344\320\22\362\3\67\7\343\320\222\361\3\70\7\342"
+  "\320\22\361\3\71\7\344\320\22\362\3\72\7\343\320\222\361\3\73\7\342\320\22\361\3\74\7\344\320\22\362\3"
+  "\75\7\343\320\222\361\3\76\7\342\320\22\361\3\77\7\344\320\22\362\3\100\7\343\320\222\361\3\101\7\342\320"
+  "\22\361\3\102\7\344\320\22\362\3\103\7\343\320\222\361\3\104\7\342\320\22\361\3\105\7\344\320\22\362\3\106"
+  "\7\343\320\222\361\3\107\7\342\320\22\361\3\110\7\344\320\22\362\3\111\7\343\320\222\361\3\112\7\342\320\22"
+  "\361\3\113\7\344\320\22\362\3\114\7\343\320\222\361\3\115\7\342\320\22\361\3\116\7\344\320\22\362\3\117\7"
+  "\343\320\222\361\3\120\7\342\320\22\361\3\121\7\344\320\22\362\3\122\7\343\320\222\361\3\123\7\342\320\22\361"
+  "\3\124\7\344\320\22\362\3\125\7\343\320\222\361\3\126\7\342\320\22\361\3\127\7\344\320\22\362\3\130\7\343"
+  "\320\222\361\3\131\7\342\320\22\361\3\132\7\344\320\22\362\3\133\7\343\320\222\361\3\134\7\342\320\22\361\3"
+  "\135\7\344\320\22\362\3\136\7\343\320\222\361\3\137\7\342\320\22\361\3\140\7\344\320\22\362\3\141\7\343\320"
+  "\222\361\3\142\7\342\320\22\361\3\143\7\344\320\22\362\3\144\7\343\320\222\361\3\145\7\342\320\22\361\3\146"
+  "\7\344\320\22\362\3\147\7\343\320\222\361\3\150\7\342\320\22\361\3\151\7\344\320\22\362\3\152\7\343\320\222"
+  "\361\3\153\7\342\320\22\361\3\154\7\344\320\22\362\3\155\7\343\320\222\361\3\156\7\342\320\22\361\3\157\7"
+  "\344\320\22\362\3\160\7\343\320\222\361\3\161\7\342\320\22\361\3\162\7\344\320\22\362\3\163\7\343\320\222\361"
+  "\3\164\7\342\320\22\361\3\165\7\344\320\22\362\3\166\7\343\320\222\361\3\167\7\342\320\22\361\3\170\7\344"
+  "\320\22\362\3\171\7\343\320\222\361\3\172\7\342\320\22\361\3\173\7\344\320\22\362\3\174\7\343\320\222\361\3"
+  "\175\7\342\320\22\361\3\176\7\344\320\22\362\3\0\0";
+
@@ -0,0 +1,83 @@
+/*
+ * ============================================================================
+ * AIRTIME — per-call time-on-air for each packet format and radio profile
+ * ============================================================================
+ * Compares the raw PitchSignal struct dump (8 bytes on ESP32) with the 3-byte
+ * compact encoding and the 6-byte call frame, then the other frames on air,
+ * on every named radio profile (PitchCommRadio.h). Also round-trips every
+ * compact field combination through SignalView.
+ * ============================================================================
+ */
+
+#include <PitchCommProtocol.h>
+#include <PitchCommAirtime.h>
+#include <PitchCommFec.h>
+#include <PitchCommRadio.h>
+
+#include <cstdio>
+
+using namespace pitchcomm;
+
+struct Format {
+  const char* name;
+  uint8_t     length;
+};
+
+static const Format formats[] = {
+  { "PitchSignal struct dump", SIGNAL_LENGTH  },
+  { "compact v1 (bit-packed)", COMPACT_LENGTH },
+  { "0xCC call frame",         CALL_LENGTH    },
+  { "mask call",               CALL_MASK_LENGTH },
+  { "FEC call (Hamming 8,4)",  FEC_LENGTH     },
+  { "call ACK",                CALL_ACK_LENGTH },
+  { "link command",            LINK_COMMAND_LENGTH },
+  { "link report",             LINK_REPORT_LENGTH },
+};
+
+static int checkCompact() {
+  int failures = 0;
+  for (uint8_t type = 0; type <= SIGNAL_RESET; type++)
+  for (uint8_t pitch = 0; pitch <= PITCH_COUNT; pitch++)
+  for (uint8_t zone = 0; zone <= ZONE_MAX; zone++)
+  for (uint8_t pk = 0; pk <= PICKOFF_MAX; pk++)
+  for (uint8_t third = 0; third <= THIRD_MAX; third++)
+  for (uint16_t seq = 0; seq <= COMPACT_SEQ_MASK; seq += 37) {
+    uint8_t p = pitch == PITCH_COUNT ? PITCH_NONE : pitch;
+    CompactFrame f = encodeCompact(type, p, zone, pk, third, seq);
+    SignalView v(f.bytes, COMPACT_LENGTH);
+    if (!v.valid() || v.type() != type || v.pitch() != p || v.zone() != zone
+        || v.pickoff() != pk || v.thirdSign() != third || v.number() != seq) {
+      printf("FAIL compact t=%d p=%d z=%d pk=%d 3rd=%d seq=%d\n",
+             type, p, zone, pk, third, seq);
+      failures++;
+    }
+  }
+  return failures;
+}
+
+int main() {
+  printf("=== PitchComm airtime ===\n\n");
+
+  for (uint8_t id = 0; id < PROFILE_COUNT; id++) {
+    const RadioProfile& prof = radioProfile(id);
+    const uint32_t base = timeOnAirUs(prof.modem, SIGNAL_LENGTH);
+    printf("%u %-10s SF%u/BW%lu/CR4-%u  sync 0x%02X  preamble %u  CRC %s  %s header"
+           "  (Tsym %.3f ms, LDRO %s)\n",
+           id, prof.name, prof.modem.sf, (unsigned long)(prof.modem.bwHz / 1000), prof.modem.cr,
+           prof.syncWord, prof.modem.preamble, prof.modem.crc ? "on" : "off",
+           prof.modem.implicitHeader ? "implicit" : "explicit",
+           symbolTimeNs(prof.modem.sf, prof.modem.bwHz) / 1e6, prof.ldro ? "on" : "off");
+    printf("  %-26s %5s %7s %10s %12s\n", "Format", "Bytes", "Symbols", "ToA ms", "Saved ms");
+    for (const Format& fmt : formats) {
+      uint32_t toa = timeOnAirUs(prof.modem, fmt.length);
+      printf("  %-26s %5u %7u %10.2f %12.2f\n", fmt.name, fmt.length,
+             payloadSymbols(prof.modem, fmt.length),
+             toa / 1000.0, ((int32_t)base - (int32_t)toa) / 1000.0);
+    }
+    printf("\n");
+  }
+
+  int failures = checkCompact();
+  printf("Compact round-trip checks: %s\n", failures == 0 ? "PASS" : "FAIL");
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,422 @@
+/*
+ * ============================================================================
+ * ARQ SIM — acknowledged calls vs. blind copies, HUD and armband together
+ * ============================================================================
+ * Plays the coach against the unmodified XIAO HUD (node 0) and armband
+ * (node 1) sketches (sim/SimFirmware.h), both listening at once, in two
+ * modes:
+ *
+ *   3x    every call as COPIES ver 0x01 copies, COPY_GAP_MS apart
+ *   arq   one ver 0x02 copy through pitchcomm::CallArq (PitchCommArq.h).
+ *         It resends until both receivers ACK or ARQ_MAX_SENDS is reached.
+ *
+ * The calls and channel draws come from the same seed in both modes. The
+ * channel is per receiver and per direction: independent loss, plus an
+ * AR(1) SNR fade against the SF7 floor. Two ACKs that overlap at the coach
+ * are both lost, and so is an ACK that arrives while the coach transmits.
+ * A receiver that is transmitting its ACK misses whatever the coach sends
+ * meanwhile (the fake SX1262 is deaf during transmit()). While the armband
+ * sits in delay(), the HUD's loop() runs from the delay hook, so an ePaper
+ * refresh does not hold up the HUD.
+ *
+ * Columns, per receiver:
+ *
+ *   calls %    calls it read cleanly at least once
+ *   lat ms     call start to the end of the first copy it read (mean / p95)
+ *   air ms     coach airtime per call
+ *   up ms      ACK airtime per call, both receivers
+ *   sends      coach transmissions per call
+ *   acked %    calls the coach saw this receiver's ACK for
+ *   rtt ms     first send to the ACK, as the coach measures it (mean / p95)
+ *
+ * Exits 1 if, on the clean channel, ARQ does not use less coach airtime
+ * than the copies, or delivers fewer calls.
+ *
+ * Coach timing is an assumption (the T-Deck TX source is not in this tree).
+ * ============================================================================
+ */
+
+#include <SimFirmware.h>
+#include <PitchCommArq.h>
+#include <PitchCommAirtime.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace pitchcomm;
+
+static const int      CALLS       = 400;
+static const uint32_t GAP_MIN_MS  = 2000;
+static const uint32_t GAP_MAX_MS  = 6000;
+static const int      COPIES      = 3;
+static const uint32_t COPY_GAP_MS = 50;
+static const double   FADE_TAU_MS = 2000;
+
+// ============================================================================
+// SCENARIOS
+// ============================================================================
+struct Scenario {
+  const char* name;
+  double loss;                      // per packet, each direction
+  double snrMean, snrSwing;         // dB, swing 0 = no fading
+};
+
+static const Scenario SCENARIOS[] = {
+  // name      loss   snr mean/swing
+  { "clean",   0.00,   8.0, 0.0 },
+  { "loss10",  0.10,   8.0, 0.0 },
+  { "loss30",  0.30,   8.0, 0.0 },
+  { "fade",    0.00,  -4.0, 4.0 },
+};
+static const int SCENARIO_COUNT = sizeof(SCENARIOS) / sizeof(SCENARIOS[0]);
+
+// ============================================================================
+// RANDOM
+// ============================================================================
+static uint64_t rngState;
+static uint64_t rng() {
+  rngState ^= rngState >> 12;
+  rngState ^= rngState << 25;
+  rngState ^= rngState >> 27;
+  return rngState * 0x2545F4914F6CDD1DULL;
+}
+static double uniform() { return (rng() >> 11) * (1.0 / 9007199254740992.0); }
+static double gaussian() {
+  double u1 = uniform(), u2 = uniform();
+  if (u1 < 1e-12) u1 = 1e-12;
+  return sqrt(-2.0 * log(u1)) * cos(6.283185307179586 * u2);
+}
+
+// ============================================================================
+// RECEIVERS
+// ============================================================================
+struct Receiver {
+  const char* name;
+  SX1262*     radio;
+  void      (*loop)();
+  bool        nested;               // short loop(): may run inside the other's delay()
+};
+
+static const Receiver RECEIVERS[] = {
+  { "HUD",     &hud::radio,     hud::loop,     true  },
+  { "Armband", &armband::radio, armband::loop, false },
+};
+static const int RX_COUNT = sizeof(RECEIVERS) / sizeof(RECEIVERS[0]);
+
+// ============================================================================
+// RUN STATE — shared with the delay / radio hooks
+// ============================================================================
+struct Flight {
+  uint64_t startUs, endUs;
+  int      node;                     // receiver it goes to, -1 = ACK to coach
+  uint8_t  bytes[CALL_LENGTH];
+  uint8_t  len;
+  float    snr;
+  int      tag;
+  bool     lost;
+};
+
+struct Run {
+  const Scenario* sc;
+  bool            arqMode;
+  CallArq*        arq;
+  uint64_t        base, coachBusyUs, nextCallUs, nextCopyUs;
+  int             call, copiesLeft;
+  CallFrame       frame;
+  std::vector<Flight> air;
+  double          fade[RX_COUNT];
+  uint64_t        fadeUs[RX_COUNT];
+
+  std::vector<uint64_t> startUs;
+  std::vector<uint64_t> arrivalUs;   // by tag: end of each copy delivered
+  std::vector<int>      arrivalCall;
+  std::vector<uint64_t> firstReadUs[RX_COUNT];
+  std::vector<uint32_t> rttMs[RX_COUNT];
+  uint64_t        coachAirUs, upAirUs;
+  uint32_t        sends;
+};
+static Run cur;
+
+static uint32_t nowMs() { return (uint32_t)((sim::clockUs() - cur.base) / 1000); }
+
+static double channelSnr(int n, uint64_t us) {
+  const Scenario& s = *cur.sc;
+  if (s.snrSwing > 0) {
+    double a = exp(-(double)(us - cur.fadeUs[n]) / 1000.0 / FADE_TAU_MS);
+    cur.fade[n] = a * cur.fade[n] + sqrt(1 - a * a) * s.snrSwing * gaussian();
+    cur.fadeUs[n] = us;
+  }
+  return s.snrMean + cur.fade[n];
+}
+
+static bool survives(int n, uint64_t us) {
+  if (uniform() < cur.sc->loss) return false;
+  return uniform() >= 1.0 / (1.0 + exp(channelSnr(n, us) - snrFloorQ4(7) / 4.0));
+}
+
+static void coachSend(const CallFrame& f) {
+  uint64_t now = sim::clockUs();
+  uint32_t toa = timeOnAirUs(MODEM_CALL_SF7, CALL_LENGTH);
+  cur.coachAirUs += toa;
+  cur.sends++;
+  for (size_t i = 0; i < cur.air.size(); i++) {
+    if (cur.air[i].node < 0 && cur.air[i].endUs > now) cur.air[i].lost = true;   // half duplex
+  }
+  for (int n = 0; n < RX_COUNT; n++) {
+    Flight fl;
+    fl.startUs = now;
+    fl.endUs   = now + toa;
+    fl.node    = n;
+    memcpy(fl.bytes, f.bytes, CALL_LENGTH);
+    fl.len     = CALL_LENGTH;
+    fl.snr     = (float)channelSnr(n, now);
+    fl.tag     = cur.call;
+    fl.lost    = !survives(n, now);
+    cur.air.push_back(fl);
+  }
+  cur.coachBusyUs = now + toa;
+}
+
+// A receiver's ACK, from inside its radio.transmit()
+static void onTransmit(const SX1262& radio, const uint8_t* data, size_t len) {
+  int n = 0;
+  while (n < RX_COUNT && RECEIVERS[n].radio != &radio) n++;
+  if (n == RX_COUNT || len != CALL_ACK_LENGTH) return;
+
+  uint64_t now = sim::clockUs();
+  uint32_t toa = timeOnAirUs(MODEM_CALL_SF7, (uint8_t)len);
+  cur.upAirUs += toa;
+
+  Flight fl;
+  fl.startUs = now;
+  fl.endUs   = now + toa;
+  fl.node    = -1;
+  memcpy(fl.bytes, data, len);
+  fl.len     = (uint8_t)len;
+  fl.snr     = 0;
+  fl.tag     = -1;
+  fl.lost    = now < cur.coachBusyUs || !survives(n, now);
+  for (size_t i = 0; i < cur.air.size(); i++) {
+    if (cur.air[i].node < 0 && cur.air[i].endUs > now) fl.lost = cur.air[i].lost = true;
+  }
+  cur.air.push_back(fl);
+}
+
+template <int N>
+static void onRead(int tag, bool crcOk) {
+  if (tag < 0 || !crcOk) return;
+  int call = cur.arrivalCall[tag];
+  if (cur.firstReadUs[N][call] == 0) cur.firstReadUs[N][call] = cur.arrivalUs[tag];
+}
+static void (*const ON_READ[RX_COUNT])(int, bool) = { onRead<0>, onRead<1> };
+
+static void finishArqCall() {
+  for (int n = 0; n < RX_COUNT; n++) {
+    if (cur.arq->acked() & (1 << n)) cur.rttMs[n].push_back(cur.arq->rttMs((uint8_t)n));
+  }
+}
+
+// Everything due: land packets, then let the coach transmit if it is free
+static void tick() {
+  uint64_t now = sim::clockUs();
+  for (size_t i = 0; i < cur.air.size(); ) {
+    Flight f = cur.air[i];
+    if (f.endUs > now) { i++; continue; }
+    cur.air[i] = cur.air.back();
+    cur.air.pop_back();
+    if (f.lost) continue;
+    if (f.node < 0) {
+      bool was = cur.arq->pending();
+      cur.arq->onAck(CallAckView(f.bytes, f.len), nowMs());
+      if (was && !cur.arq->pending()) finishArqCall();
+    } else {
+      cur.arrivalUs.push_back(f.endUs);
+      cur.arrivalCall.push_back(f.tag);
+      RECEIVERS[f.node].radio->injectPacket(f.bytes, f.len, (float)(-110.0 + f.snr), f.snr, true,
+                                            (int)cur.arrivalUs.size() - 1);
+    }
+  }
+
+  if (now < cur.coachBusyUs) return;
+  if (cur.call + 1 < CALLS && now >= cur.nextCallUs) {
+    if (cur.arqMode && cur.arq->pending()) finishArqCall();   // dropped unfinished
+    cur.call++;
+    cur.startUs[cur.call] = now;
+    uint8_t cmd = (uint8_t)(CMD_FB_IN + rng() % 10);
+    cur.frame = encodeCall(ADDR_CATCHER, cmd, (uint8_t)cur.call, cur.arqMode);
+    if (cur.arqMode) cur.arq->start(cur.frame, nowMs());
+    else { cur.copiesLeft = COPIES; cur.nextCopyUs = now; }
+    cur.nextCallUs += ((uint64_t)GAP_MIN_MS + rng() % (GAP_MAX_MS - GAP_MIN_MS + 1)) * 1000;
+  }
+
+  if (cur.arqMode) {
+    bool was = cur.arq->pending();
+    CallFrame f;
+    if (cur.arq->poll(nowMs(), f)) coachSend(f);
+    else if (was && !cur.arq->pending()) finishArqCall();    // gave up
+  } else if (cur.copiesLeft > 0 && now >= cur.nextCopyUs) {
+    coachSend(cur.frame);
+    cur.copiesLeft--;
+    cur.nextCopyUs = cur.coachBusyUs + COPY_GAP_MS * 1000;
+  }
+}
+
+// Both sketches run "at once": while the armband sits in delay() (an ePaper
+// refresh, say), the HUD's loop() runs from the delay hook
+static bool inLoop[RX_COUNT];
+static void runLoops(bool fromHook) {
+  for (int n = 0; n < RX_COUNT; n++) {
+    if (inLoop[n] || (fromHook && !RECEIVERS[n].nested)) continue;
+    inLoop[n] = true;
+    RECEIVERS[n].loop();
+    inLoop[n] = false;
+  }
+}
+
+static void hook() {
+  tick();
+  runLoops(true);
+}
+
+struct Result {
+  double   callsPct[RX_COUNT], latMean[RX_COUNT], latP95[RX_COUNT];
+  double   ackedPct[RX_COUNT], rttMean[RX_COUNT], rttP95[RX_COUNT];
+  double   airMs, upMs, sends;
+};
+
+static double p95(std::vector<double> v) {
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  return v[(size_t)(0.95 * (v.size() - 1))];
+}
+
+static Result run(const Scenario& sc, bool arqMode, uint64_t seed) {
+  CallArq arq(MODEM_CALL_SF7, 0x03);
+  rngState = seed;
+
+  cur.sc = &sc;
+  cur.arqMode = arqMode;
+  cur.arq = &arq;
+  cur.base = sim::clockUs();
+  cur.coachBusyUs = 0;
+  cur.nextCallUs = cur.base + 5000000;     // settle first
+  cur.call = -1;
+  cur.copiesLeft = 0;
+  cur.air.clear();
+  cur.coachAirUs = cur.upAirUs = 0;
+  cur.sends = 0;
+  for (int n = 0; n < RX_COUNT; n++) {
+    cur.fade[n] = 0;
+    cur.fadeUs[n] = cur.base;
+    cur.firstReadUs[n].assign(CALLS, 0);
+    cur.rttMs[n].clear();
+    RECEIVERS[n].radio->onRead = ON_READ[n];
+    RECEIVERS[n].radio->onTransmit = onTransmit;
+  }
+  cur.startUs.assign(CALLS, 0);
+  cur.arrivalUs.clear();
+  cur.arrivalCall.clear();
+  sim::delayHook() = hook;
+
+  uint64_t endUs = 0;
+  while (endUs == 0 || sim::clockUs() < endUs) {
+    tick();
+    runLoops(false);
+    if (cur.call == CALLS - 1 && endUs == 0) endUs = sim::clockUs() + 10000000;
+  }
+  sim::delayHook() = NULL;
+  if (arq.pending()) finishArqCall();
+
+  Result r;
+  memset(&r, 0, sizeof(r));
+  for (int n = 0; n < RX_COUNT; n++) {
+    RECEIVERS[n].radio->onRead = NULL;
+    RECEIVERS[n].radio->onTransmit = NULL;
+    std::vector<double> lat, rtt;
+    for (int c = 0; c < CALLS; c++) {
+      if (cur.firstReadUs[n][c]) lat.push_back((cur.firstReadUs[n][c] - cur.startUs[c]) / 1000.0);
+    }
+    for (size_t i = 0; i < cur.rttMs[n].size(); i++) rtt.push_back(cur.rttMs[n][i]);
+    double sum = 0;
+    for (size_t i = 0; i < lat.size(); i++) sum += lat[i];
+    r.callsPct[n] = 100.0 * lat.size() / CALLS;
+    r.latMean[n]  = lat.empty() ? 0 : sum / lat.size();
+    r.latP95[n]   = p95(lat);
+    sum = 0;
+    for (size_t i = 0; i < rtt.size(); i++) sum += rtt[i];
+    r.ackedPct[n] = 100.0 * rtt.size() / CALLS;
+    r.rttMean[n]  = rtt.empty() ? 0 : sum / rtt.size();
+    r.rttP95[n]   = p95(rtt);
+  }
+  r.airMs = cur.coachAirUs / 1000.0 / CALLS;
+  r.upMs  = cur.upAirUs / 1000.0 / CALLS;
+  r.sends = (double)cur.sends / CALLS;
+  cur.arq = NULL;
+  sim::advanceMs(120000);
+  return r;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+int main(int argc, char** argv) {
+  const char* only = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--verbose") == 0) sim::serialEcho() = true;
+    else only = argv[i];
+  }
+
+  hud::setup();
+  armband::setup();
+
+  printf("PitchComm ARQ sim — %d calls, %u-%u s apart, SF7 call frames\n",
+         CALLS, (unsigned)(GAP_MIN_MS / 1000), (unsigned)(GAP_MAX_MS / 1000));
+  printf("3x: %d copies %u ms apart; arq: up to %u sends, turnaround %u ms, ACK slot %u ms\n\n",
+         COPIES, (unsigned)COPY_GAP_MS, (unsigned)ARQ_MAX_SENDS,
+         (unsigned)ARQ_TURNAROUND_MS, (unsigned)callAckSlotMs(MODEM_CALL_SF7));
+  printf("%-8s %-4s %-8s %7s %13s %7s %6s %6s %7s %13s\n",
+         "scenario", "mode", "rx", "calls", "lat ms", "air ms", "up ms", "sends",
+         "acked", "rtt ms");
+  printf("%-8s %-4s %-8s %7s %13s %7s %6s %6s %7s %13s\n",
+         "", "", "", "%", "mean / p95", "/call", "/call", "/call", "%", "mean / p95");
+
+  int failures = 0;
+  for (int si = 0; si < SCENARIO_COUNT; si++) {
+    const Scenario& sc = SCENARIOS[si];
+    if (only && strcmp(only, sc.name) != 0) continue;
+
+    Result res[2];
+    for (int mode = 0; mode < 2; mode++) {
+      Result& r = res[mode];
+      r = run(sc, mode == 1, 0x9E3779B97F4A7C15ULL + si);
+      for (int n = 0; n < RX_COUNT; n++) {
+        char lat[24], rtt[24], acked[12];
+        snprintf(lat, sizeof(lat), "%.0f / %.0f", r.latMean[n], r.latP95[n]);
+        snprintf(rtt, sizeof(rtt), "%.0f / %.0f", r.rttMean[n], r.rttP95[n]);
+        snprintf(acked, sizeof(acked), "%.1f", r.ackedPct[n]);
+        if (n == 0) {
+          printf("%-8s %-4s %-8s %7.1f %13s %7.1f %6.1f %6.2f %7s %13s\n",
+                 mode == 0 ? sc.name : "", mode == 0 ? "3x" : "arq", RECEIVERS[n].name,
+                 r.callsPct[n], lat, r.airMs, r.upMs, r.sends,
+                 mode ? acked : "-", mode ? rtt : "-");
+        } else {
+          printf("%-8s %-4s %-8s %7.1f %13s %7s %6s %6s %7s %13s\n", "", "",
+                 RECEIVERS[n].name, r.callsPct[n], lat, "", "", "",
+                 mode ? acked : "-", mode ? rtt : "-");
+        }
+      }
+    }
+
+    if (strcmp(sc.name, "clean") == 0) {
+      bool bad = res[1].airMs >= res[0].airMs;
+      for (int n = 0; n < RX_COUNT; n++) bad |= res[1].callsPct[n] < res[0].callsPct[n];
+      if (bad) { printf("  FAIL: ARQ should beat the copies on a clean channel\n"); failures++; }
+    }
+  }
+
+  printf("\n%s\n", failures ? "FAIL" : "OK");
+  return failures ? 1 : 0;
+}
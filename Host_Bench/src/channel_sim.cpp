@@ -0,0 +1,415 @@
+/*
+ * ============================================================================
+ * CHANNEL SIM — impaired RF channel vs. receiver dedup and link health
+ * ============================================================================
+ * Drives the unmodified XIAO HUD and armband sketches (sim/SimFirmware.h)
+ * with a coach that sends every call as COPIES identical call frames, over
+ * a channel with:
+ *
+ *   loss        independent per-copy loss
+ *   burst       Gilbert-Elliott good/bad states (per copy)
+ *   collision   copy arrives with a failed CRC (overlapping transmitter)
+ *   fade        AR(1) SNR trace; loss probability rises near the SF7 floor
+ *   outage      link fully down for a window (catcher in the dugout)
+ *   seqStart    first sequence number, for wraparound cases
+ *
+ * Both receivers start each scenario freshly booted. Packets are delivered
+ * on schedule from loop() passes and from inside the firmware's delay()s
+ * (ePaper BUSY waits included). Every copy carries a tag, so the harness
+ * knows which copies the firmware actually read, and can tell apart:
+ *
+ *   missed      call never displayed
+ *   false dup   a copy was read cleanly but dedup threw it away (a call
+ *               replaced by a newer one before it was drawn is missed,
+ *               not a false dup)
+ *   double      call displayed more than once (dedup let a copy through)
+ *
+ * For the HUD it also scores the 30 s / 60 s "No RX" monitor: alarms raised
+ * for an outage (with delay from outage start) and false alarms, where no
+ * outage overlapped the 60 s the monitor looks back over. "spread" is the largest on-air gap between the
+ * first and last copy of one call the firmware read — the HUD's 500 ms
+ * dedup window must cover it.
+ *
+ * Coach timing is an assumption (the T-Deck TX source is not in this tree):
+ * COPIES copies, COPY_GAP_MS between the end of one and the start of the
+ * next.
+ * ============================================================================
+ */
+
+#include <SimFirmware.h>
+#include <PitchCommAirtime.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace pitchcomm;
+
+static const int      COPIES      = 3;
+static const uint32_t COPY_GAP_MS = 50;
+static const double   SNR_FLOOR   = -7.5;    // SF7 demodulation floor, dB
+static const double   FADE_TAU_MS = 2000;
+
+// ============================================================================
+// SCENARIOS
+// ============================================================================
+struct Scenario {
+  const char* name;
+  int      calls;
+  uint32_t gapMinMs, gapMaxMs;              // start-to-start between calls
+  double   loss;
+  double   burstEnter, burstExit, burstLoss;
+  double   collision;
+  double   snrMean, snrSwing;               // swing 0 = no fading
+  uint8_t  seqStart;
+  uint32_t outageEveryMs, outageMs;         // 0 = no outages
+};
+
+static const Scenario SCENARIOS[] = {
+  // name       calls  gap ms        loss  burst in/out/loss   coll  snr mean/swing seq  outage every/len
+  { "clean",     1000, 2000,  6000,  0.00, 0.00, 0.00, 0.0,    0.00,  8.0, 0.0,   0,   0,      0     },
+  { "loss10",    1000, 2000,  6000,  0.10, 0.00, 0.00, 0.0,    0.00,  8.0, 0.0,   0,   0,      0     },
+  { "loss40",    1000, 2000,  6000,  0.40, 0.00, 0.00, 0.0,    0.00,  8.0, 0.0,   0,   0,      0     },
+  { "burst",     1000, 2000,  6000,  0.00, 0.05, 0.30, 0.95,   0.00,  8.0, 0.0,   0,   0,      0     },
+  { "collide",   1000, 2000,  6000,  0.00, 0.00, 0.00, 0.0,    0.15,  8.0, 0.0,   0,   0,      0     },
+  { "fade",      1000, 2000,  6000,  0.00, 0.00, 0.00, 0.0,    0.00, -4.0, 4.0,   0,   0,      0     },
+  { "rapid",     1000,  250,   600,  0.05, 0.00, 0.00, 0.0,    0.00,  8.0, 0.0,   0,   0,      0     },
+  { "wrap",      1000, 2000,  6000,  0.00, 0.00, 0.00, 0.0,    0.00,  8.0, 0.0, 255,   0,      0     },
+  { "outage",     400, 2000,  6000,  0.00, 0.00, 0.00, 0.0,    0.00,  8.0, 0.0,   0, 300000, 90000  },
+  { "idle",       200, 20000, 100000, 0.00, 0.00, 0.00, 0.0,   0.00,  8.0, 0.0,   0,   0,      0     },
+};
+static const int SCENARIO_COUNT = sizeof(SCENARIOS) / sizeof(SCENARIOS[0]);
+
+// ============================================================================
+// RANDOM
+// ============================================================================
+static uint64_t rngState;
+static uint64_t rng() {
+  rngState ^= rngState >> 12;
+  rngState ^= rngState << 25;
+  rngState ^= rngState >> 27;
+  return rngState * 0x2545F4914F6CDD1DULL;
+}
+static double uniform() { return (rng() >> 11) * (1.0 / 9007199254740992.0); }
+static double gaussian() {
+  double u1 = uniform(), u2 = uniform();
+  if (u1 < 1e-12) u1 = 1e-12;
+  return sqrt(-2.0 * log(u1)) * cos(6.283185307179586 * u2);
+}
+
+// ============================================================================
+// CHANNEL — turns a call schedule into the packets a receiver hears
+// ============================================================================
+struct Packet {
+  uint64_t atUs;          // end of reception, relative to scenario start
+  int      call;
+  uint8_t  seq;
+  uint8_t  bytes[CALL_LENGTH];
+  bool     crcOk;
+  float    rssi, snr;
+};
+
+struct Schedule {
+  std::vector<Packet>   packets;
+  std::vector<uint64_t> callStartUs;
+  std::vector<uint64_t> outageStartUs;
+  uint64_t              endUs;
+};
+
+static bool inOutage(const Scenario& s, uint64_t us) {
+  if (s.outageEveryMs == 0) return false;
+  uint64_t period = (uint64_t)s.outageEveryMs * 1000;
+  return us % period >= period - (uint64_t)s.outageMs * 1000;
+}
+
+static const uint8_t CALL_CMDS[] = {
+  CMD_FB_IN, CMD_FB_OUT, CMD_CURVE, CMD_CHANGE, CMD_SLIDER, CMD_CUTTER,
+  CMD_SPLIT, CMD_SCREW, CMD_PICK1, CMD_PICK2, CMD_PITCHOUT, CMD_TIMEOUT,
+};
+
+static Schedule buildSchedule(const Scenario& s) {
+  Schedule sch;
+  const uint64_t toaUs = timeOnAirUs(MODEM_CALL_SF7, CALL_LENGTH);
+  uint64_t t = 5000000;           // let the receivers settle first
+  uint64_t lastFadeUs = 0;
+  double   fade = 0;
+  bool     bad = false;
+  uint8_t  seq = s.seqStart;
+
+  for (int c = 0; c < s.calls; c++) {
+    sch.callStartUs.push_back(t);
+    uint8_t   cmd = CALL_CMDS[rng() % sizeof(CALL_CMDS)];
+    CallFrame f   = encodeCall(ADDR_CATCHER, cmd, seq++);
+
+    for (int k = 0; k < COPIES; k++) {
+      uint64_t at = t + k * (toaUs + COPY_GAP_MS * 1000) + toaUs;
+
+      if (s.snrSwing > 0) {
+        double a = exp(-(double)(at - lastFadeUs) / 1000.0 / FADE_TAU_MS);
+        fade = a * fade + sqrt(1 - a * a) * s.snrSwing * gaussian();
+        lastFadeUs = at;
+      }
+      double snr = s.snrMean + fade;
+
+      bool lost = inOutage(s, at) || uniform() < s.loss;
+      if (s.burstEnter > 0) {
+        bad = bad ? uniform() >= s.burstExit : uniform() < s.burstEnter;
+        if (bad && uniform() < s.burstLoss) lost = true;
+      }
+      if (uniform() < 1.0 / (1.0 + exp(snr - SNR_FLOOR))) lost = true;
+      if (lost) continue;
+
+      Packet p;
+      p.atUs  = at;
+      p.call  = c;
+      p.seq   = f.bytes[4];
+      memcpy(p.bytes, f.bytes, CALL_LENGTH);
+      p.crcOk = uniform() >= s.collision;
+      if (!p.crcOk) p.bytes[(size_t)(rng() % CALL_LENGTH)] ^= (uint8_t)(1 + rng() % 255);
+      p.snr   = (float)snr;
+      p.rssi  = (float)(-110.0 + snr);
+      sch.packets.push_back(p);
+    }
+    t += ((uint64_t)s.gapMinMs + rng() % (s.gapMaxMs - s.gapMinMs + 1)) * 1000;
+  }
+
+  if (s.outageEveryMs) {
+    for (uint64_t o = (uint64_t)(s.outageEveryMs - s.outageMs) * 1000; o < t;
+         o += (uint64_t)s.outageEveryMs * 1000) {
+      sch.outageStartUs.push_back(o);
+    }
+  }
+  sch.endUs = t + 10000000ULL;
+  return sch;
+}
+
+// ============================================================================
+// RECEIVERS
+// ============================================================================
+// Mirror the sketches' global initializers: every scenario starts fresh.
+static void resetHud() {
+  hud::rxEvent.wait(0);     // drop a wakeup left over from the last scenario
+  hud::lastSeq = 0;  hud::lastCmd = 0;  hud::lastRxTime = 0;
+  hud::showing = false;  hud::rxCount = 0;  hud::errCount = 0;
+  hud::showStandby();
+}
+static uint32_t hudAccepted() { return hud::rxCount; }
+static void hudLoop() { hud::loop(); }
+
+static uint8_t hudShown() { return hud::lastSeq; }
+
+static void resetArmband() {
+  armband::rxEvent.wait(0);
+  armband::haveCall = false;  armband::lastSeq = 0;  armband::lastCmd = 0;
+  armband::lastRxTime = 0;  armband::lastCallTime = 0;
+  armband::displayingCall = false;
+  armband::callQueued = false;  armband::shownSeq = 0xFF;
+}
+static uint32_t armbandAccepted() { return (uint32_t)armband::lastCallTime; }
+static uint8_t armbandShown() { return armband::shownSeq; }
+static void armbandLoop() { armband::loop(); }
+
+struct Receiver {
+  const char* name;
+  SX1262*     radio;
+  void      (*reset)();
+  void      (*loop)();
+  uint32_t  (*accepted)();     // changes whenever a call is displayed
+  uint8_t   (*shownSeq)();     // sequence number of the call on screen
+  bool        health;
+};
+
+static const Receiver RECEIVERS[] = {
+  { "HUD",     &hud::radio,     resetHud,     hudLoop,     hudAccepted,     hudShown,     true  },
+  { "Armband", &armband::radio, resetArmband, armbandLoop, armbandAccepted, armbandShown, false },
+};
+static const int RECEIVER_COUNT = sizeof(RECEIVERS) / sizeof(RECEIVERS[0]);
+
+// ============================================================================
+// RUN — one receiver through one schedule
+// ============================================================================
+// State the delay / radio / serial hooks share with run()
+struct Run {
+  const Receiver*       rx;
+  const Schedule*       sch;
+  uint64_t              base;
+  size_t                next;
+  std::vector<int>      cleanReads;
+  std::vector<uint64_t> firstRead, lastRead;
+  std::vector<bool>     superseded;
+  int                   callBySeq[256];     // last call read with this seq
+};
+static Run cur;
+
+// Everything due by now lands in the one RX buffer
+static void deliver() {
+  const std::vector<Packet>& packets = cur.sch->packets;
+  while (cur.next < packets.size() && packets[cur.next].atUs <= sim::clockUs() - cur.base) {
+    const Packet& p = packets[cur.next];
+    cur.rx->radio->injectPacket(p.bytes, CALL_LENGTH, p.rssi, p.snr, p.crcOk, (int)cur.next);
+    cur.next++;
+  }
+}
+
+static void onRead(int tag, bool crcOk) {
+  if (tag < 0 || !crcOk) return;
+  const Packet& p = cur.sch->packets[tag];
+  if (cur.cleanReads[p.call]++ == 0) cur.firstRead[p.call] = p.atUs;
+  cur.lastRead[p.call] = p.atUs;
+  cur.callBySeq[p.seq] = p.call;
+}
+
+// "[WARN] No RX 60s" timestamps from the HUD's serial log, and calls the
+// armband replaced before they reached the glass
+static std::vector<uint64_t> alarmsUs;
+static std::string tapLine;
+static void serialTap(const char* text) {
+  if (strstr(text, "[WARN] No RX")) alarmsUs.push_back(sim::clockUs());
+
+  tapLine += text;                  // print() chunks -> whole lines
+  if (tapLine.empty() || tapLine[tapLine.size() - 1] != '\n') return;
+  size_t sup = tapLine.find("superseded #");
+  if (sup != std::string::npos && cur.sch) {
+    int c = cur.callBySeq[atoi(tapLine.c_str() + sup + 12) & 0xFF];
+    if (c >= 0) cur.superseded[c] = true;
+  }
+  tapLine.clear();
+}
+
+struct Result {
+  int      missed, falseDup, doubled;
+  unsigned long overwritten;
+  double   spreadMaxMs;
+  int      alarms, falseAlarms, outages, detected;
+  double   detectSumS;
+};
+
+static Result run(const Receiver& rx, const Scenario& s, const Schedule& sch) {
+  rx.reset();
+  alarmsUs.clear();
+  unsigned long over0 = rx.radio->overwritten;
+
+  const int calls = (int)sch.callStartUs.size();
+  std::vector<int> shown(calls, 0);
+
+  cur.rx   = &rx;
+  cur.sch  = &sch;
+  cur.base = sim::clockUs();
+  cur.next = 0;
+  cur.cleanReads.assign(calls, 0);
+  cur.firstRead.assign(calls, 0);
+  cur.lastRead.assign(calls, 0);
+  cur.superseded.assign(calls, false);
+  for (int i = 0; i < 256; i++) cur.callBySeq[i] = -1;
+  sim::delayHook() = deliver;
+  rx.radio->onRead = onRead;
+
+  while (sim::clockUs() - cur.base < sch.endUs) {
+    deliver();
+
+    uint32_t acc0 = rx.accepted();
+    rx.loop();
+
+    if (rx.accepted() != acc0) {
+      int c = cur.callBySeq[rx.shownSeq()];
+      if (c >= 0) shown[c]++;
+    }
+  }
+
+  sim::delayHook() = NULL;
+  rx.radio->onRead = NULL;
+  cur.sch = NULL;
+  const std::vector<int>&      cleanReads = cur.cleanReads;
+  const std::vector<uint64_t>& firstRead  = cur.firstRead;
+  const std::vector<uint64_t>& lastRead   = cur.lastRead;
+
+  Result r;
+  memset(&r, 0, sizeof(r));
+  r.overwritten = rx.radio->overwritten - over0;
+  for (int c = 0; c < calls; c++) {
+    if (shown[c] == 0) r.missed++;
+    if (shown[c] == 0 && cleanReads[c] > 0 && !cur.superseded[c]) r.falseDup++;
+    if (shown[c] > 1) r.doubled++;
+    if (cleanReads[c] > 1) {
+      double spread = (lastRead[c] - firstRead[c]) / 1000.0;
+      if (spread > r.spreadMaxMs) r.spreadMaxMs = spread;
+    }
+  }
+
+  if (rx.health) {
+    // An alarm is justified when an outage overlapped the 60 s it looks back
+    const uint64_t lookbackUs = 60000000ULL;
+    r.outages = (int)sch.outageStartUs.size();
+    std::vector<bool> seen(r.outages, false);
+    for (size_t i = 0; i < alarmsUs.size(); i++) {
+      uint64_t at = alarmsUs[i] - cur.base;
+      bool justified = false;
+      r.alarms++;
+      for (int o = 0; o < r.outages; o++) {
+        uint64_t start = sch.outageStartUs[o];
+        uint64_t end   = start + (uint64_t)s.outageMs * 1000;
+        if (at < start || at >= end + lookbackUs) continue;
+        justified = true;
+        if (!seen[o]) {
+          seen[o] = true;
+          r.detected++;
+          r.detectSumS += (at - start) / 1e6;
+        }
+      }
+      if (!justified) r.falseAlarms++;
+    }
+  }
+  return r;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+int main(int argc, char** argv) {
+  const char* only = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--verbose") == 0) sim::serialEcho() = true;
+    else only = argv[i];
+  }
+
+  Serial.tap = serialTap;
+  hud::setup();
+  armband::setup();
+
+  printf("PitchComm channel sim — %d copies per call, %u ms apart, SF7 call frames\n\n",
+         COPIES, (unsigned)COPY_GAP_MS);
+  printf("%-8s %-8s %6s %8s %9s %8s %6s %8s %7s %7s %9s\n",
+         "scenario", "rx", "calls", "missed", "false dup", "double", "overwr",
+         "spread", "alarms", "false", "detect");
+  printf("%-8s %-8s %6s %8s %9s %8s %6s %8s %7s %7s %9s\n",
+         "", "", "", "%", "%", "%", "", "max ms", "", "alarms", "mean s");
+
+  for (int si = 0; si < SCENARIO_COUNT; si++) {
+    const Scenario& s = SCENARIOS[si];
+    if (only && strcmp(only, s.name) != 0) continue;
+
+    rngState = 0x9E3779B97F4A7C15ULL + si;
+    Schedule sch = buildSchedule(s);
+
+    for (int ri = 0; ri < RECEIVER_COUNT; ri++) {
+      Result r = run(RECEIVERS[ri], s, sch);
+      double n = (double)s.calls / 100.0;
+      printf("%-8s %-8s %6d %8.2f %9.2f %8.2f %6lu %8.1f",
+             ri == 0 ? s.name : "", RECEIVERS[ri].name, s.calls,
+             r.missed / n, r.falseDup / n, r.doubled / n, r.overwritten, r.spreadMaxMs);
+      if (RECEIVERS[ri].health) {
+        char detect[16] = "-";
+        if (r.detected) snprintf(detect, sizeof(detect), "%.1f", r.detectSumS / r.detected);
+        printf(" %7d %7d %5s%s\n", r.alarms, r.falseAlarms, detect,
+               r.outages ? (" (" + std::to_string(r.detected) + "/" +
+                            std::to_string(r.outages) + ")").c_str() : "");
+      } else {
+        printf(" %7s %7s %9s\n", "-", "-", "-");
+      }
+      sim::advanceMs(120000);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * ============================================================================
+ * FEC BENCH — single FEC frame vs. triple-redundant plain frames
+ * ============================================================================
+ * Pushes call frames through a simulated noisy channel and compares:
+ *
+ *   plain x1   one 6-byte frame, LoRa CRC drops it on any bit error
+ *   plain x3   what the coach does today: 3 copies, first clean one wins
+ *   FEC x1     one 14-byte PitchCommFec.h frame, decoded even on CRC fail
+ *
+ * Two channels: independent bit errors (BER), and symbol bursts where a
+ * corrupted LoRa symbol flips bits inside one SF-bit window (SER).
+ * Reports delivery probability, airtime, delivery per ms of airtime, mean
+ * call latency (end of the first good copy) and undetected bad decodes.
+ * ============================================================================
+ */
+
+#include <PitchCommFec.h>
+#include <PitchCommAirtime.h>
+
+#include <cstdio>
+#include <cstring>
+
+using namespace pitchcomm;
+
+static const LoRaModem MODEM = MODEM_CALL_SF7;
+static const int       TRIALS = 200000;
+
+// ============================================================================
+// CHANNEL
+// ============================================================================
+static uint64_t rngState = 0x9E3779B97F4A7C15ULL;
+static uint64_t rng() {
+  rngState ^= rngState >> 12;
+  rngState ^= rngState << 25;
+  rngState ^= rngState >> 27;
+  return rngState * 0x2545F4914F6CDD1DULL;
+}
+static double uniform() { return (rng() >> 11) * (1.0 / 9007199254740992.0); }
+
+enum ChannelKind { CHANNEL_BIT, CHANNEL_SYMBOL };
+
+// Corrupts buf in place, returns number of flipped bits
+static int corrupt(uint8_t* buf, size_t len, ChannelKind kind, double p) {
+  int flips = 0;
+  size_t bits = len * 8;
+  if (kind == CHANNEL_BIT) {
+    for (size_t b = 0; b < bits; b++) {
+      if (uniform() < p) { buf[b >> 3] ^= (uint8_t)(1 << (b & 7)); flips++; }
+    }
+  } else {
+    for (size_t s = 0; s < bits; s += MODEM.sf) {
+      if (uniform() >= p) continue;
+      uint32_t pattern = 0;
+      while (pattern == 0) pattern = (uint32_t)rng() & ((1u << MODEM.sf) - 1);
+      for (uint8_t k = 0; k < MODEM.sf && s + k < bits; k++) {
+        if (pattern & (1u << k)) { buf[(s + k) >> 3] ^= (uint8_t)(1 << ((s + k) & 7)); flips++; }
+      }
+    }
+  }
+  return flips;
+}
+
+// ============================================================================
+// MODES
+// ============================================================================
+struct Result {
+  int    delivered;
+  int    wrong;          // accepted but decoded to a different call
+  double latencyMsSum;   // over delivered calls
+};
+
+static Result runPlain(int copies, ChannelKind kind, double p) {
+  Result r = { 0, 0, 0 };
+  const double toa = timeOnAirUs(MODEM, CALL_LENGTH) / 1000.0;
+  for (int t = 0; t < TRIALS; t++) {
+    CallFrame f = encodeCall(ADDR_CATCHER, (uint8_t)rng(), (uint8_t)t);
+    for (int c = 0; c < copies; c++) {
+      uint8_t rx[CALL_LENGTH];
+      memcpy(rx, f.bytes, CALL_LENGTH);
+      if (corrupt(rx, CALL_LENGTH, kind, p) == 0) {   // LoRa CRC passes
+        r.delivered++;
+        r.latencyMsSum += toa * (c + 1);
+        break;
+      }
+    }
+  }
+  return r;
+}
+
+static Result runFec(ChannelKind kind, double p) {
+  Result r = { 0, 0, 0 };
+  const double toa = timeOnAirUs(MODEM, FEC_LENGTH) / 1000.0;
+  for (int t = 0; t < TRIALS; t++) {
+    uint8_t cmd = (uint8_t)rng();
+    FecFrame f = encodeFecCall(ADDR_CATCHER, cmd, (uint8_t)t);
+    corrupt(f.bytes, FEC_LENGTH, kind, p);
+
+    uint8_t scratch[CALL_LENGTH];
+    CallView rx = openCall(f.bytes, FEC_LENGTH, scratch);
+    if (!rx.valid()) continue;
+    if (rx.cmd() != cmd || rx.seq() != (uint8_t)t) { r.wrong++; continue; }
+    r.delivered++;
+    r.latencyMsSum += toa;
+  }
+  return r;
+}
+
+static void printRow(const char* mode, const Result& r, double airtimeMs) {
+  double pDel = (double)r.delivered / TRIALS;
+  printf("  %-9s %9.5f %9.2f %11.5f %10.2f %8d\n", mode, pDel, airtimeMs,
+         pDel / airtimeMs, r.delivered ? r.latencyMsSum / r.delivered : 0.0, r.wrong);
+}
+
+static void runChannel(ChannelKind kind, const double* rates, size_t count) {
+  const double plainMs = timeOnAirUs(MODEM, CALL_LENGTH) / 1000.0;
+  const double fecMs   = timeOnAirUs(MODEM, FEC_LENGTH) / 1000.0;
+
+  for (size_t i = 0; i < count; i++) {
+    printf("%s = %g\n", kind == CHANNEL_BIT ? "BER" : "SER", rates[i]);
+    printf("  %-9s %9s %9s %11s %10s %8s\n",
+           "Mode", "P(deliv)", "Air ms", "P / air ms", "Lat ms", "Wrong");
+    printRow("plain x1", runPlain(1, kind, rates[i]), plainMs);
+    printRow("plain x3", runPlain(3, kind, rates[i]), 3 * plainMs);
+    printRow("FEC x1",   runFec(kind, rates[i]),      fecMs);
+    printf("\n");
+  }
+}
+
+int main() {
+  printf("=== PitchComm FEC bench ===\n");
+  printf("SF%d BW%lu CR4/%d, %d trials per point\n\n",
+         MODEM.sf, (unsigned long)(MODEM.bwHz / 1000), MODEM.cr, TRIALS);
+
+  const double bers[] = { 1e-4, 1e-3, 5e-3, 1e-2, 2e-2 };
+  const double sers[] = { 1e-3, 1e-2, 3e-2, 5e-2 };
+  runChannel(CHANNEL_BIT,    bers, sizeof(bers) / sizeof(bers[0]));
+  runChannel(CHANNEL_SYMBOL, sers, sizeof(sers) / sizeof(sers[0]));
+  return 0;
+}
@@ -0,0 +1,1080 @@
+/*
+ * ============================================================================
+ * FONT COMPILER — pre-rasterized call strings for every receiver display
+ * ============================================================================
+ * Every call string a receiver shows in a large font is fixed at compile
+ * time, yet the firmwares measure it (getStrWidth / getTextBounds /
+ * textWidth) and rasterize its glyphs on every call. This tool does both
+ * once, on the host, with the font data of the libraries the firmwares
+ * build against:
+ *
+ *   U8g2      src/clib/u8g2_fonts.c       Heltec V3, Stick, XIAO HUD
+ *   GFX       Adafruit GFX Library/Fonts  XIAO Armband (GxEPD2)
+ *   TFT_eSPI  Fonts/glcdfont.c            T-Watch S3
+ *
+ * Strings are read from the firmware sources (callTable, decodePitch,
+ * pitchNames) and the protocol limits in PitchCommProtocol.h. Layouts
+ * mirror each firmware's draw code, which points back here. Each receiver
+ * gets a generated CallBitmaps.h next to its source:
+ *
+ *   XIAO HUD      64x32    whole U8g2 frames (splash + one per call),
+ *                          shown with a memcpy into the frame buffer
+ *   Heltec V3     128x64   PackedBitmap per pitch / zone / PK / 3rd / RESET
+ *   Heltec Stick  64x32    "
+ *   T-Watch S3    240x240  "
+ *   XIAO Armband  250x122  PackedBitmap per decodePitch() line
+ *
+ * (PackedBitmap: src/PitchCommBitmaps.h). Font files are looked up in the
+ * firmwares' PlatformIO libdeps and the Arduino sketchbook, so run one
+ * normal build first, or pass the paths:
+ *
+ *   font_compiler [--root ..] [--u8g2 u8g2_fonts.c] [--gfx Fonts/]
+ *                 [--glcd glcdfont.c] [--libdeps DIR] [--only DIR]
+ *                 [--out DIR] [--dry-run]
+ *
+ * --libdeps searches one libdeps folder (U8g2/, TFT_eSPI/, Adafruit GFX
+ * Library/) first. --only builds the receivers whose header lies under DIR
+ * (e.g. Heltec_Receiver/src). --out writes DIR/<header path> instead of
+ * next to the sources; a header is only rewritten when its text changed.
+ *
+ * The Heltec, Stick and T-Watch builds run this before every compile
+ * (Host_Bench/call_bitmaps.py), so their images always carry the bitmaps.
+ * The XIAO sketches build in the Arduino IDE: run it by hand after changing
+ * a call string or a mirrored layout. Receivers whose fonts are missing are
+ * skipped; exits 1 if any was skipped.
+ * ============================================================================
+ */
+
+#include <PitchCommProtocol.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+using namespace pitchcomm;
+
+// ============================================================================
+// SOURCE FILES
+// ============================================================================
+static bool readFile(const std::string& path, std::string& out) {
+  std::ifstream f(path.c_str(), std::ios::binary);
+  if (!f) return false;
+  std::ostringstream ss;
+  ss << f.rdbuf();
+  out = ss.str();
+  return true;
+}
+
+// Creates every missing directory of path's parent
+static bool makeParents(const std::string& path) {
+  for (size_t i = path.find_first_of("/\\", 1); i != std::string::npos;
+       i = path.find_first_of("/\\", i + 1)) {
+    std::string dir = path.substr(0, i);
+    struct stat st;
+    if (stat(dir.c_str(), &st) == 0) continue;
+#ifdef _WIN32
+    if (_mkdir(dir.c_str()) != 0) return false;
+#else
+    if (mkdir(dir.c_str(), 0755) != 0) return false;
+#endif
+  }
+  return true;
+}
+
+// Leaves the file (and its timestamp) alone when it already holds text
+static bool writeIfChanged(const std::string& path, const std::string& text) {
+  std::string old;
+  if (readFile(path, old) && old == text) return true;
+  if (!makeParents(path)) return false;
+  std::ofstream out(path.c_str(), std::ios::binary);
+  out << text;
+  return (bool)out;
+}
+
+static std::string firstExisting(const std::vector<std::string>& paths) {
+  for (size_t i = 0; i < paths.size(); i++) {
+    std::ifstream f(paths[i].c_str());
+    if (f) return paths[i];
+  }
+  return "";
+}
+
+// Drops // and /* */ comments, leaving string and char literals alone
+static std::string stripComments(const std::string& s) {
+  std::string out;
+  out.reserve(s.size());
+  size_t i = 0;
+  while (i < s.size()) {
+    char c = s[i];
+    if (c == '"' || c == '\'') {
+      out += s[i++];
+      while (i < s.size() && s[i] != c) {
+        if (s[i] == '\\' && i + 1 < s.size()) out += s[i++];
+        out += s[i++];
+      }
+      if (i < s.size()) out += s[i++];
+    } else if (c == '/' && i + 1 < s.size() && s[i + 1] == '/') {
+      while (i < s.size() && s[i] != '\n') i++;
+    } else if (c == '/' && i + 1 < s.size() && s[i + 1] == '*') {
+      size_t end = s.find("*/", i + 2);
+      i = end == std::string::npos ? s.size() : end + 2;
+      out += ' ';
+    } else {
+      out += s[i++];
+    }
+  }
+  return out;
+}
+
+// Text between the '{' following `after` and its matching '}'
+static bool braceBlock(const std::string& s, size_t after, std::string& out) {
+  size_t open = s.find('{', after);
+  if (open == std::string::npos) return false;
+  int depth = 0;
+  for (size_t i = open; i < s.size(); i++) {
+    if (s[i] == '{') depth++;
+    else if (s[i] == '}' && --depth == 0) {
+      out = s.substr(open + 1, i - open - 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+static std::vector<long> integers(const std::string& s) {
+  std::vector<long> v;
+  std::regex num("(^|[^\\w])(-?(0x[0-9A-Fa-f]+|\\d+))\\b");
+  for (std::sregex_iterator it(s.begin(), s.end(), num), end; it != end; ++it) {
+    v.push_back(strtol((*it)[2].str().c_str(), NULL, 0));
+  }
+  return v;
+}
+
+// Concatenated C string literals from pos up to the terminating ';'
+static bool cStringBytes(const std::string& s, size_t pos, std::vector<uint8_t>& out) {
+  while (pos < s.size()) {
+    char c = s[pos++];
+    if (c == ';') return true;
+    if (c != '"') continue;
+    while (pos < s.size() && s[pos] != '"') {
+      char ch = s[pos++];
+      if (ch != '\\') { out.push_back((uint8_t)ch); continue; }
+      char e = s[pos++];
+      if (e >= '0' && e <= '7') {
+        int v = e - '0';
+        for (int k = 0; k < 2 && s[pos] >= '0' && s[pos] <= '7'; k++) v = v * 8 + (s[pos++] - '0');
+        out.push_back((uint8_t)v);
+      } else if (e == 'x') {
+        int v = 0;
+        while (isxdigit((unsigned char)s[pos])) {
+          char h = s[pos++];
+          v = v * 16 + (isdigit((unsigned char)h) ? h - '0' : (tolower(h) - 'a' + 10));
+        }
+        out.push_back((uint8_t)v);
+      } else {
+        switch (e) {
+          case 'a': out.push_back(7);  break;
+          case 'b': out.push_back(8);  break;
+          case 'f': out.push_back(12); break;
+          case 'n': out.push_back(10); break;
+          case 'r': out.push_back(13); break;
+          case 't': out.push_back(9);  break;
+          case 'v': out.push_back(11); break;
+          default:  out.push_back((uint8_t)e); break;
+        }
+      }
+    }
+    pos++;                              // closing quote
+  }
+  return false;
+}
+
+// ============================================================================
+// CANVAS — one byte per pixel, clipped like the panel
+// ============================================================================
+struct Canvas {
+  int w, h;
+  std::vector<uint8_t> px;
+
+  Canvas(int width, int height) : w(width), h(height), px((size_t)width * height, 0) {}
+
+  void set(int x, int y, uint8_t c) {
+    if (x >= 0 && y >= 0 && x < w && y < h) px[(size_t)y * w + x] = c;
+  }
+  void fill(int x, int y, int fw, int fh, uint8_t c) {
+    for (int j = 0; j < fh; j++)
+      for (int i = 0; i < fw; i++) set(x + i, y + j, c);
+  }
+  uint8_t get(int x, int y) const { return px[(size_t)y * w + x]; }
+};
+
+// ============================================================================
+// U8G2 FONTS — compressed glyphs from u8g2_fonts.c
+// ============================================================================
+// Lookup, RLE decode and string width follow u8g2_font.c (font position
+// baseline, font mode transparent, U8G2_R0).
+class U8g2Font {
+public:
+  const char* name;
+
+  explicit U8g2Font(const char* fontName) : name(fontName) {}
+
+  bool load(const std::string& source) {
+    std::string key = std::string(name) + "[";
+    size_t at = source.find(key);
+    if (at == std::string::npos) return false;
+    size_t eq = source.find('=', at);
+    _data.clear();
+    if (eq == std::string::npos || !cStringBytes(source, eq + 1, _data)) return false;
+    return _data.size() > HEADER;
+  }
+
+  size_t bytes() const { return _data.size() + 1; }     // + literal's NUL
+
+  // u8g2_string_width(): advances, with the last glyph's box instead
+  int strWidth(const char* s) const {
+    int w = 0, dx = 0, lastW = 0, lastX = 0;
+    for (; *s; s++) {
+      Glyph g;
+      Bits b;
+      if (!glyph((uint8_t)*s, g, b)) { dx = 0; continue; }
+      dx = g.dx;
+      w += dx;
+      lastW = g.w;
+      lastX = g.x;
+    }
+    if (lastW != 0) w = w - dx + lastW + lastX;
+    return w;
+  }
+
+  // drawStr() at baseline y
+  void drawStr(Canvas& c, int x, int y, const char* s, uint8_t color) const {
+    if (x < 0) fprintf(stderr, "  warning: \"%s\" starts at x=%d (U8g2 coordinates are unsigned)\n", s, x);
+    for (; *s; s++) x += drawGlyph(c, x, y, (uint8_t)*s, color);
+  }
+
+private:
+  static const size_t HEADER = 23;
+
+  struct Bits {
+    const uint8_t* p;
+    const uint8_t* end;
+    unsigned       pos;
+
+    unsigned get(unsigned cnt) {
+      unsigned v = 0;
+      for (unsigned i = 0; i < cnt && p < end; i++) {
+        v |= ((*p >> pos) & 1u) << i;
+        if (++pos == 8) { pos = 0; p++; }
+      }
+      return v;
+    }
+    int getSigned(unsigned cnt) {
+      if (cnt == 0) return 0;
+      return (int)get(cnt) - (1 << (cnt - 1));
+    }
+  };
+
+  struct Glyph { int w, h, x, y, dx; };
+
+  unsigned info(size_t i) const { return _data[i]; }
+
+  bool glyph(uint8_t enc, Glyph& g, Bits& b) const {
+    size_t p = HEADER;
+    if (enc >= 'a')      p += (info(19) << 8) | info(20);
+    else if (enc >= 'A') p += (info(17) << 8) | info(18);
+
+    while (p + 1 < _data.size() && _data[p + 1] != 0) {
+      if (_data[p] == enc) {
+        b.p   = &_data[p + 2];
+        b.end = _data.data() + _data.size();
+        b.pos = 0;
+        g.w  = b.get(info(4));
+        g.h  = b.get(info(5));
+        g.x  = b.getSigned(info(6));
+        g.y  = b.getSigned(info(7));
+        g.dx = b.getSigned(info(8));
+        return true;
+      }
+      p += _data[p + 1];
+    }
+    return false;
+  }
+
+  int drawGlyph(Canvas& c, int x, int y, uint8_t enc, uint8_t color) const {
+    Glyph g;
+    Bits b;
+    if (!glyph(enc, g, b)) return 0;
+    if (g.w == 0) return g.dx;
+
+    int tx = x + g.x;
+    int ty = y - (g.h + g.y);
+    int lx = 0, ly = 0;
+
+    // u8g2_font_decode_len(): runs wrap at the glyph width
+    struct Run {
+      static void draw(Canvas& c, const Glyph& g, int tx, int ty, int& lx, int& ly,
+                       unsigned len, bool ink, uint8_t color) {
+        unsigned cnt = len;
+        for (;;) {
+          unsigned rem = (unsigned)(g.w - lx);
+          unsigned cur = cnt < rem ? cnt : rem;
+          if (ink) {
+            for (unsigned i = 0; i < cur; i++) c.set(tx + lx + (int)i, ty + ly, color);
+          }
+          if (cnt < rem) break;
+          cnt -= rem;
+          lx = 0;
+          ly++;
+        }
+        lx += (int)cnt;
+      }
+    };
+
+    for (;;) {
+      unsigned zeros = b.get(info(2));
+      unsigned ones  = b.get(info(3));
+      do {
+        Run::draw(c, g, tx, ty, lx, ly, zeros, false, color);
+        Run::draw(c, g, tx, ty, lx, ly, ones,  true,  color);
+      } while (b.get(1) != 0);
+      if (ly >= g.h || b.p >= b.end) break;
+    }
+    return g.dx;
+  }
+
+  std::vector<uint8_t> _data;
+};
+
+// ============================================================================
+// ADAFRUIT GFX FONTS — GFXfont headers (Fonts/<name>.h)
+// ============================================================================
+// print() and getTextBounds() follow Adafruit_GFX with text size 1 and
+// wrap on, as GxEPD2 leaves them.
+class GfxFont {
+public:
+  const char* name;
+
+  explicit GfxFont(const char* fontName) : name(fontName), _first(0), _last(0), _yAdvance(0) {}
+
+  bool load(const std::string& dir) {
+    std::string raw;
+    if (!readFile(dir + "/" + name + ".h", raw)) return false;
+    std::string s = stripComments(raw);
+    std::string block;
+
+    size_t at = s.find(std::string(name) + "Bitmaps[");
+    if (at == std::string::npos || !braceBlock(s, at, block)) return false;
+    std::vector<long> bytes = integers(block);
+    _bitmap.assign(bytes.begin(), bytes.end());
+
+    at = s.find(std::string(name) + "Glyphs[");
+    if (at == std::string::npos || !braceBlock(s, at, block)) return false;
+    std::vector<long> g = integers(block);
+    if (g.empty() || g.size() % 6 != 0) return false;
+    _glyphs.clear();
+    for (size_t i = 0; i < g.size(); i += 6) {
+      Glyph gl = { (int)g[i], (int)g[i + 1], (int)g[i + 2], (int)g[i + 3],
+                   (int)g[i + 4], (int)g[i + 5] };
+      _glyphs.push_back(gl);
+    }
+
+    at = s.find("GFXfont " + std::string(name));
+    if (at == std::string::npos || !braceBlock(s, at, block)) return false;
+    std::vector<long> f = integers(block);
+    if (f.size() < 3) return false;
+    _first    = (int)f[f.size() - 3];
+    _last     = (int)f[f.size() - 2];
+    _yAdvance = (int)f[f.size() - 1];
+    return _last - _first + 1 == (int)_glyphs.size();
+  }
+
+  size_t bytes() const { return _bitmap.size() + _glyphs.size() * 7 + 10; }
+
+  // getTextBounds() on a width x height display
+  void textBounds(const char* s, int x, int y, int width, int height,
+                  int& x1, int& y1, int& w, int& h) const {
+    int minx = width, miny = height, maxx = -1, maxy = -1;
+    x1 = x; y1 = y; w = h = 0;
+    for (; *s; s++) {
+      int c = (uint8_t)*s;
+      if (c == '\n') { x = 0; y += _yAdvance; continue; }
+      if (c == '\r' || c < _first || c > _last) continue;
+      const Glyph& g = _glyphs[c - _first];
+      if (x + g.xo + g.w > width) { x = 0; y += _yAdvance; }
+      int gx1 = x + g.xo, gy1 = y + g.yo;
+      int gx2 = gx1 + g.w - 1, gy2 = gy1 + g.h - 1;
+      if (gx1 < minx) minx = gx1;
+      if (gy1 < miny) miny = gy1;
+      if (gx2 > maxx) maxx = gx2;
+      if (gy2 > maxy) maxy = gy2;
+      x += g.xAdvance;
+    }
+    if (maxx >= minx) { x1 = minx; w = maxx - minx + 1; }
+    if (maxy >= miny) { y1 = miny; h = maxy - miny + 1; }
+  }
+
+  // setCursor(x, y); print(s)
+  void print(Canvas& c, int x, int y, const char* text, uint8_t color) const {
+    for (const char* s = text; *s; s++) {
+      int ch = (uint8_t)*s;
+      if (ch == '\n') { x = 0; y += _yAdvance; continue; }
+      if (ch == '\r' || ch < _first || ch > _last) continue;
+      const Glyph& g = _glyphs[ch - _first];
+      if (g.w > 0 && g.h > 0) {
+        if (x + g.xo + g.w > c.w) {
+          fprintf(stderr, "  warning: \"%s\" wraps on a %d px line\n", text, c.w);
+          x = 0;
+          y += _yAdvance;
+        }
+        drawChar(c, x, y, g, color);
+      }
+      x += g.xAdvance;
+    }
+  }
+
+private:
+  struct Glyph { int offset, w, h, xAdvance, xo, yo; };
+
+  void drawChar(Canvas& c, int x, int y, const Glyph& g, uint8_t color) const {
+    size_t bo = g.offset;
+    uint8_t bits = 0;
+    unsigned bit = 0;
+    for (int yy = 0; yy < g.h; yy++) {
+      for (int xx = 0; xx < g.w; xx++) {
+        if (!(bit++ & 7)) bits = bo < _bitmap.size() ? _bitmap[bo++] : 0;
+        if (bits & 0x80) c.set(x + g.xo + xx, y + g.yo + yy, color);
+        bits <<= 1;
+      }
+    }
+  }
+
+  std::vector<uint8_t> _bitmap;
+  std::vector<Glyph>   _glyphs;
+  int _first, _last, _yAdvance;
+};
+
+// ============================================================================
+// TFT_eSPI GLCD FONT — 5x8 columns from glcdfont.c (font 1)
+// ============================================================================
+// drawString() with font 1, transparent text (setTextColor(c) only).
+class GlcdFont {
+public:
+  bool load(const std::string& path) {
+    std::string raw;
+    if (!readFile(path, raw)) return false;
+    std::string s = stripComments(raw), block;
+    size_t at = s.find("font[");
+    if (at == std::string::npos || !braceBlock(s, at, block)) return false;
+    std::vector<long> v = integers(block);
+    _data.assign(v.begin(), v.end());
+    return _data.size() >= 128 * 5;
+  }
+
+  // MC_DATUM when centred, else TL_DATUM
+  void drawString(Canvas& c, const char* s, int x, int y, int size, bool centred,
+                  uint8_t color) const {
+    if (centred) {
+      x -= (int)(6 * strlen(s) * size) / 2;
+      y -= 8 * size / 2;
+    }
+    for (; *s; s++, x += 6 * size) drawChar(c, x, y, (uint8_t)*s, size, color);
+  }
+
+private:
+  void drawChar(Canvas& c, int x, int y, uint8_t ch, int size, uint8_t color) const {
+    if (x >= c.w || y >= c.h || x + 6 * size - 1 < 0 || y + 8 * size - 1 < 0) return;
+    if ((size_t)ch * 5 + 5 > _data.size()) return;
+    for (int i = 0; i < 5; i++) {
+      uint8_t line = _data[ch * 5 + i];
+      for (int j = 0; j < 8; j++, line >>= 1) {
+        if (line & 1) c.fill(x + i * size, y + j * size, size, size, color);
+      }
+    }
+  }
+
+  std::vector<uint8_t> _data;
+};
+
+// ============================================================================
+// PACKING
+// ============================================================================
+struct Art {
+  std::string text;
+  int x, y, w, h;
+  std::vector<uint8_t> bits;
+};
+
+// Ink bounding box as 1 bpp rows, MSB first, padded to bytes
+static Art crop(const Canvas& c, const std::string& text) {
+  int x0 = c.w, y0 = c.h, x1 = -1, y1 = -1;
+  for (int y = 0; y < c.h; y++)
+    for (int x = 0; x < c.w; x++)
+      if (c.get(x, y)) {
+        if (x < x0) x0 = x;
+        if (x > x1) x1 = x;
+        if (y < y0) y0 = y;
+        if (y > y1) y1 = y;
+      }
+  Art a;
+  a.text = text;
+  a.x = a.y = a.w = a.h = 0;
+  if (x1 < 0) return a;
+  a.x = x0; a.y = y0;
+  a.w = x1 - x0 + 1;
+  a.h = y1 - y0 + 1;
+  int stride = (a.w + 7) / 8;
+  a.bits.assign((size_t)stride * a.h, 0);
+  for (int y = 0; y < a.h; y++)
+    for (int x = 0; x < a.w; x++)
+      if (c.get(x0 + x, y0 + y)) a.bits[(size_t)y * stride + x / 8] |= 0x80 >> (x & 7);
+  return a;
+}
+
+// U8g2 full buffer: byte (page * width + x), bit (y & 7), LSB on top
+static std::vector<uint8_t> u8g2Frame(const Canvas& c) {
+  std::vector<uint8_t> f((size_t)c.w * c.h / 8, 0);
+  for (int y = 0; y < c.h; y++)
+    for (int x = 0; x < c.w; x++)
+      if (c.get(x, y)) f[(size_t)(y / 8) * c.w + x] |= 1 << (y & 7);
+  return f;
+}
+
+// ============================================================================
+// HEADER WRITER
+// ============================================================================
+class Header {
+public:
+  Header(const char* receiver, const char* guard, const std::string& fonts)
+      : _receiver(receiver), _guard(guard), _fonts(fonts), _next(0) {}
+
+  static std::string hex(const std::vector<uint8_t>& v, const char* indent) {
+    std::string s;
+    char buf[8];
+    for (size_t i = 0; i < v.size(); i++) {
+      if (i % 16 == 0) s += indent;
+      snprintf(buf, sizeof(buf), "0x%02X,", v[i]);
+      s += buf;
+      s += (i % 16 == 15 || i + 1 == v.size()) ? "\n" : " ";
+    }
+    return s;
+  }
+
+  static std::string quote(const std::string& s) { return "\"" + s + "\""; }
+
+  // Emits the bits of a, returns its PackedBitmap initializer
+  std::string ref(const Art& a) {
+    if (a.w == 0) return "{ 0, 0, 0, 0, NULL }";
+    char name[16], init[96];
+    snprintf(name, sizeof(name), "art%d", _next++);
+    _data += "// " + quote(a.text) + "\n";
+    _data += std::string("static const uint8_t ") + name + "[] = {\n" + hex(a.bits, "  ") + "};\n";
+    snprintf(init, sizeof(init), "{ %d, %d, %d, %d, %s }", a.x, a.y, a.w, a.h, name);
+    return init;
+  }
+
+  void table(const std::string& decl, const std::vector<std::string>& rows,
+             const std::vector<std::string>& notes) {
+    _tables += decl + " = {\n";
+    for (size_t i = 0; i < rows.size(); i++) {
+      _tables += "  " + rows[i] + ",";
+      if (i < notes.size() && !notes[i].empty()) _tables += "  // " + notes[i];
+      _tables += "\n";
+    }
+    _tables += "};\n\n";
+  }
+
+  void raw(const std::string& s) { _tables += s; }
+
+  std::string text() const {
+    std::string s;
+    s += "// Generated by Host_Bench/src/font_compiler.cpp — do not edit.\n";
+    s += std::string("// ") + _receiver + ", fonts: " + _fonts + "\n";
+    s += std::string("#ifndef ") + _guard + "\n#define " + _guard + "\n\n";
+    s += "#include <PitchCommBitmaps.h>\n\n";
+    s += "#define PITCHCOMM_CALL_BITMAPS 1\n\n";
+    s += _data + "\n" + _tables;
+    s += std::string("#endif // ") + _guard + "\n";
+    return s;
+  }
+
+private:
+  const char* _receiver;
+  const char* _guard;
+  std::string _fonts;
+  std::string _data, _tables;
+  int         _next;
+};
+
+// ============================================================================
+// FIRMWARE STRINGS
+// ============================================================================
+struct Call {
+  std::string cmd, line1, line2;
+  bool        urgent;
+};
+
+// { CMD_X, "line1", "line2", true } rows (HUD callTable, armband decodePitch)
+static std::vector<Call> callRows(const std::string& src) {
+  std::vector<Call> calls;
+  std::regex row("(CMD_\\w+)[^\"\\n]*\"([^\"]*)\"\\s*,\\s*\"([^\"]*)\"\\s*,\\s*(true|false)");
+  for (std::sregex_iterator it(src.begin(), src.end(), row), end; it != end; ++it) {
+    Call c = { (*it)[1].str(), (*it)[2].str(), (*it)[3].str(), (*it)[4].str() == "true" };
+    calls.push_back(c);
+  }
+  return calls;
+}
+
+static bool defaultCall(const std::string& src, Call& c) {
+  std::smatch m;
+  std::regex row("default:\\s*return\\s*\\{\\s*\"([^\"]*)\"\\s*,\\s*\"([^\"]*)\"\\s*,\\s*(true|false)");
+  if (!std::regex_search(src, m, row)) return false;
+  c.cmd = "";
+  c.line1 = m[1].str();
+  c.line2 = m[2].str();
+  c.urgent = m[3].str() == "true";
+  return true;
+}
+
+static bool pitchNames(const std::string& src, std::vector<std::string>& names) {
+  std::smatch m;
+  if (!std::regex_search(src, m, std::regex("pitchNames\\[\\]\\s*=\\s*\\{([^}]*)\\}"))) return false;
+  std::string list = m[1].str();
+  std::regex str("\"([^\"]*)\"");
+  names.clear();
+  for (std::sregex_iterator it(list.begin(), list.end(), str), end; it != end; ++it) {
+    names.push_back((*it)[1].str());
+  }
+  return names.size() == PITCH_COUNT;
+}
+
+static std::string numbered(const char* prefix, int n) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%s%d", prefix, n);
+  return buf;
+}
+
+static const char* THIRD_NAMES[] = { "", "3A", "3B", "3C", "3D" };
+
+// ============================================================================
+// RECEIVERS
+// ============================================================================
+struct Libs {
+  std::string root, u8g2, gfx, glcd;
+  std::string u8g2Source;
+  GlcdFont    glcdFont;
+  bool        glcdLoaded;
+};
+
+struct Result {
+  std::string header;
+  size_t      fontBytes;       // large-font tables no longer referenced
+};
+
+static bool loadU8g2(const Libs& libs, U8g2Font& f) {
+  if (libs.u8g2Source.empty()) return false;
+  if (f.load(libs.u8g2Source)) return true;
+  fprintf(stderr, "  %s not found in %s\n", f.name, libs.u8g2.c_str());
+  return false;
+}
+
+// ---- XIAO HUD: showCall() / showSplash() ----
+static bool buildHud(const Libs& libs, const std::string& src, Result& r) {
+  U8g2Font helvB14("u8g2_font_helvB14_tr"), helvB10("u8g2_font_helvB10_tr"), f5x7("u8g2_font_5x7_tr");
+  if (!loadU8g2(libs, helvB14) || !loadU8g2(libs, helvB10) || !loadU8g2(libs, f5x7)) return false;
+
+  std::vector<Call> calls = callRows(src);
+  if (calls.empty()) { fprintf(stderr, "  callTable not found\n"); return false; }
+
+  Header h("XIAO HUD 64x32 SSD1306", "CALL_BITMAPS_HUD_H", "u8g2_font_helvB14_tr, u8g2_font_helvB10_tr");
+  h.raw("// Whole U8g2 frames: memcpy into getBufferPtr(), then flush\n");
+  h.raw("const uint16_t CALL_FRAME_BYTES = 256;\n\n");
+  h.raw("struct CallScreen {\n  uint8_t cmd;\n  uint8_t frame[CALL_FRAME_BYTES];\n};\n\n");
+
+  Canvas splash(64, 32);
+  helvB10.drawStr(splash, (64 - helvB10.strWidth("HUD")) / 2, 14, "HUD", 1);
+  f5x7.drawStr(splash, (64 - f5x7.strWidth("v2.0")) / 2, 28, "v2.0", 1);
+  h.raw("static const uint8_t splashFrame[CALL_FRAME_BYTES] = {\n" + Header::hex(u8g2Frame(splash), "  ") + "};\n\n");
+
+  std::string rows;
+  for (size_t i = 0; i < calls.size(); i++) {
+    const Call& call = calls[i];
+    Canvas c(64, 32);
+    uint8_t ink = 1;
+    if (call.urgent) { c.fill(0, 0, 64, 32, 1); ink = 0; }
+    if (!call.line2.empty()) {
+      helvB14.drawStr(c, (64 - helvB14.strWidth(call.line1.c_str())) / 2, 16, call.line1.c_str(), ink);
+      helvB10.drawStr(c, (64 - helvB10.strWidth(call.line2.c_str())) / 2, 30, call.line2.c_str(), ink);
+    } else {
+      helvB14.drawStr(c, (64 - helvB14.strWidth(call.line1.c_str())) / 2, 22, call.line1.c_str(), ink);
+    }
+    rows += "  // " + Header::quote(call.line1) + " " + Header::quote(call.line2) + (call.urgent ? " inverted" : "") + "\n";
+    rows += "  { pitchcomm::" + call.cmd + ", {\n" + Header::hex(u8g2Frame(c), "    ") + "  } },\n";
+  }
+  h.raw("static const CallScreen callScreens[] = {\n" + rows + "};\n");
+  h.raw("const uint8_t CALL_SCREEN_COUNT = sizeof(callScreens) / sizeof(callScreens[0]);\n\n");
+
+  r.header = h.text();
+  r.fontBytes = helvB14.bytes() + helvB10.bytes();
+  return true;
+}
+
+// ---- Heltec V3: drawSignal() ----
+static bool buildHeltec(const Libs& libs, const std::string& src, Result& r) {
+  U8g2Font helvB24("u8g2_font_helvB24_tr"), helvB18("u8g2_font_helvB18_tr");
+  if (!loadU8g2(libs, helvB24) || !loadU8g2(libs, helvB18)) return false;
+  std::vector<std::string> names;
+  if (!pitchNames(src, names)) { fprintf(stderr, "  pitchNames not found\n"); return false; }
+
+  Header h("Heltec V3 128x64 SSD1306", "CALL_BITMAPS_HELTEC_H", "u8g2_font_helvB24_tr, u8g2_font_helvB18_tr");
+  std::vector<std::string> rows, notes;
+
+  Canvas reset(128, 64);
+  helvB24.drawStr(reset, 12, 45, "RESET", 1);
+  h.raw("static const pitchcomm::PackedBitmap resetBitmap = " + h.ref(crop(reset, "RESET")) + ";\n\n");
+
+  rows.clear(); notes.clear();
+  for (int p = 0; p <= PICKOFF_MAX; p++) {
+    std::string s = p ? numbered("PK", p) : "";
+    Canvas c(128, 64);
+    helvB24.drawStr(c, 25, 45, s.c_str(), 1);
+    rows.push_back(h.ref(crop(c, s)));
+    notes.push_back(s);
+  }
+  h.table("static const pitchcomm::PackedBitmap pickoffOnlyBitmaps[pitchcomm::PICKOFF_MAX + 1]", rows, notes);
+
+  rows.clear(); notes.clear();
+  for (int t = 0; t <= THIRD_MAX + 1; t++) {
+    std::string s = t <= THIRD_MAX ? THIRD_NAMES[t] : "3?";
+    Canvas c(128, 64);
+    helvB24.drawStr(c, 40, 45, s.c_str(), 1);
+    rows.push_back(h.ref(crop(c, s)));
+    notes.push_back(s);
+  }
+  h.table("// [THIRD_MAX + 1] is \"3?\"\nstatic const pitchcomm::PackedBitmap thirdOnlyBitmaps[pitchcomm::THIRD_MAX + 2]", rows, notes);
+
+  std::vector<std::string> alone, zoned, zoneRows;
+  for (int p = 0; p < PITCH_COUNT; p++) {
+    const char* name = names[p].c_str();
+    int pitchWidth = helvB24.strWidth(name);
+    int xPos = (128 - pitchWidth) / 2;
+
+    Canvas a(128, 64), z(128, 64);
+    helvB24.drawStr(a, xPos, 40, name, 1);
+    helvB24.drawStr(z, xPos - 15, 35, name, 1);
+    alone.push_back(h.ref(crop(a, name)));
+    zoned.push_back(h.ref(crop(z, name)));
+
+    std::string row = "{ ";
+    for (int zone = 0; zone <= ZONE_MAX; zone++) {
+      std::string s = zone ? numbered("", zone) : "";
+      Canvas c(128, 64);
+      helvB18.drawStr(c, xPos + pitchWidth + 5, 35, s.c_str(), 1);
+      row += (zone ? ",\n    " : "") + h.ref(crop(c, names[p] + " " + s));
+    }
+    zoneRows.push_back(row + " }");
+  }
+  h.table("// Pitch only (centred at y 40)\nstatic const pitchcomm::PackedBitmap pitchBitmaps[pitchcomm::PITCH_COUNT]", alone, names);
+  h.table("// Pitch with a zone (shifted left, y 35)\nstatic const pitchcomm::PackedBitmap pitchZonedBitmaps[pitchcomm::PITCH_COUNT]", zoned, names);
+  h.table("// Zone digit to the right of each pitch\nstatic const pitchcomm::PackedBitmap zoneBitmaps[pitchcomm::PITCH_COUNT][pitchcomm::ZONE_MAX + 1]", zoneRows, names);
+
+  r.header = h.text();
+  r.fontBytes = helvB24.bytes() + helvB18.bytes();
+  return true;
+}
+
+// ---- Heltec Stick: drawSignal() ----
+static bool buildStick(const Libs& libs, const std::string& src, Result& r) {
+  U8g2Font helvB18("u8g2_font_helvB18_tr"), helvB14("u8g2_font_helvB14_tr"), helvB12("u8g2_font_helvB12_tr");
+  if (!loadU8g2(libs, helvB18) || !loadU8g2(libs, helvB14) || !loadU8g2(libs, helvB12)) return false;
+  std::vector<std::string> names;
+  if (!pitchNames(src, names)) { fprintf(stderr, "  pitchNames not found\n"); return false; }
+
+  Header h("Heltec Wireless Stick Lite 64x32 SSD1306", "CALL_BITMAPS_STICK_H",
+           "u8g2_font_helvB18_tr, u8g2_font_helvB14_tr, u8g2_font_helvB12_tr");
+  std::vector<std::string> rows, notes;
+
+  Canvas reset(64, 32);
+  helvB12.drawStr(reset, 2, 22, "RESET", 1);
+  h.raw("static const pitchcomm::PackedBitmap resetBitmap = " + h.ref(crop(reset, "RESET")) + ";\n\n");
+
+  for (int p = 0; p <= PICKOFF_MAX; p++) {
+    std::string s = p ? numbered("PK", p) : "";
+    Canvas c(64, 32);
+    helvB18.drawStr(c, 4, 26, s.c_str(), 1);
+    rows.push_back(h.ref(crop(c, s)));
+    notes.push_back(s);
+  }
+  h.table("static const pitchcomm::PackedBitmap pickoffOnlyBitmaps[pitchcomm::PICKOFF_MAX + 1]", rows, notes);
+
+  rows.clear(); notes.clear();
+  for (int t = 0; t <= THIRD_MAX; t++) {
+    Canvas c(64, 32);
+    helvB18.drawStr(c, 14, 26, THIRD_NAMES[t], 1);
+    rows.push_back(h.ref(crop(c, THIRD_NAMES[t])));
+    notes.push_back(THIRD_NAMES[t]);
+  }
+  h.table("static const pitchcomm::PackedBitmap thirdOnlyBitmaps[pitchcomm::THIRD_MAX + 1]", rows, notes);
+
+  rows.clear();
+  for (int p = 0; p < PITCH_COUNT; p++) {
+    Canvas c(64, 32);
+    helvB18.drawStr(c, 0, 26, names[p].c_str(), 1);
+    rows.push_back(h.ref(crop(c, names[p])));
+  }
+  h.table("static const pitchcomm::PackedBitmap pitchBitmaps[pitchcomm::PITCH_COUNT]", rows, names);
+
+  rows.clear(); notes.clear();
+  for (int z = 0; z <= ZONE_MAX; z++) {
+    std::string s = z ? numbered("", z) : "";
+    Canvas c(64, 32);
+    helvB14.drawStr(c, 50, 24, s.c_str(), 1);
+    rows.push_back(h.ref(crop(c, s)));
+    notes.push_back(s);
+  }
+  h.table("static const pitchcomm::PackedBitmap zoneBitmaps[pitchcomm::ZONE_MAX + 1]", rows, notes);
+
+  r.header = h.text();
+  r.fontBytes = helvB18.bytes() + helvB14.bytes() + helvB12.bytes();
+  return true;
+}
+
+// ---- T-Watch S3: renderSignal() ----
+static bool buildTwatch(const Libs& libs, const std::string& src, Result& r) {
+  if (!libs.glcdLoaded) return false;
+  const GlcdFont& glcd = libs.glcdFont;
+  std::vector<std::string> names;
+  if (!pitchNames(src, names)) { fprintf(stderr, "  pitchNames not found\n"); return false; }
+
+  Header h("T-Watch S3 240x240 ST7789", "CALL_BITMAPS_TWATCH_H", "TFT_eSPI GLCD font 1 at sizes 2-6");
+  std::vector<std::string> rows, notes;
+
+  Canvas reset(240, 240);
+  glcd.drawString(reset, "RESET", 120, 120, 3, true, 1);
+  h.raw("static const pitchcomm::PackedBitmap resetBitmap = " + h.ref(crop(reset, "RESET")) + ";\n\n");
+
+  std::vector<std::string> small, smallNotes;
+  for (int p = 0; p <= PICKOFF_MAX; p++) {
+    std::string s = p ? numbered("PK", p) : "";
+    Canvas big(240, 240), c(240, 240);
+    glcd.drawString(big, s.c_str(), 120, 120, 6, true, 1);
+    glcd.drawString(c, s.c_str(), 120, 200, 2, true, 1);
+    rows.push_back(h.ref(crop(big, s)));
+    small.push_back(h.ref(crop(c, s)));
+    notes.push_back(s);
+  }
+  h.table("static const pitchcomm::PackedBitmap pickoffOnlyBitmaps[pitchcomm::PICKOFF_MAX + 1]", rows, notes);
+  h.table("static const pitchcomm::PackedBitmap pickoffBitmaps[pitchcomm::PICKOFF_MAX + 1]", small, notes);
+
+  rows.clear(); notes.clear(); small.clear();
+  for (int t = 0; t <= THIRD_MAX + 1; t++) {
+    std::string s = t <= THIRD_MAX ? THIRD_NAMES[t] : "3?";
+    Canvas big(240, 240), c(240, 240);
+    glcd.drawString(big, s.c_str(), 120, 120, 6, true, 1);
+    rows.push_back(h.ref(crop(big, s)));
+    notes.push_back(s);
+    if (t <= THIRD_MAX) {
+      glcd.drawString(c, s.c_str(), 200, 20, 2, true, 1);
+      small.push_back(h.ref(crop(c, s)));
+    }
+  }
+  h.table("// [THIRD_MAX + 1] is \"3?\"\nstatic const pitchcomm::PackedBitmap thirdOnlyBitmaps[pitchcomm::THIRD_MAX + 2]", rows, notes);
+  h.table("static const pitchcomm::PackedBitmap thirdBitmaps[pitchcomm::THIRD_MAX + 1]", small, notes);
+
+  rows.clear();
+  for (int p = 0; p < PITCH_COUNT; p++) {
+    Canvas c(240, 240);
+    glcd.drawString(c, names[p].c_str(), 120, 80, 6, true, 1);
+    rows.push_back(h.ref(crop(c, names[p])));
+  }
+  h.table("static const pitchcomm::PackedBitmap pitchBitmaps[pitchcomm::PITCH_COUNT]", rows, names);
+
+  rows.clear(); notes.clear();
+  for (int z = 0; z <= ZONE_MAX; z++) {
+    std::string s = z ? numbered("", z) : "";
+    Canvas c(240, 240);
+    glcd.drawString(c, s.c_str(), 120, 150, 4, true, 1);
+    rows.push_back(h.ref(crop(c, s)));
+    notes.push_back(s);
+  }
+  h.table("static const pitchcomm::PackedBitmap zoneBitmaps[pitchcomm::ZONE_MAX + 1]", rows, notes);
+
+  r.header = h.text();
+  r.fontBytes = 0;                      // font 1 still draws the #n counter
+  return true;
+}
+
+// ---- XIAO Armband: displayPitchCall() ----
+static bool buildArmband(const Libs& libs, const std::string& src, Result& r) {
+  GfxFont sans24("FreeSansBold24pt7b"), sans12("FreeSansBold12pt7b");
+  if (libs.gfx.empty()) return false;
+  if (!sans24.load(libs.gfx) || !sans12.load(libs.gfx)) {
+    fprintf(stderr, "  FreeSansBold24pt7b / FreeSansBold12pt7b not found in %s\n", libs.gfx.c_str());
+    return false;
+  }
+
+  std::vector<Call> calls = callRows(src);
+  Call unknown;
+  if (calls.empty() || !defaultCall(src, unknown)) {
+    fprintf(stderr, "  decodePitch() not found\n");
+    return false;
+  }
+  calls.push_back(unknown);
+
+  const int W = 250, H = 122;
+  Header h("XIAO Armband 250x122 SSD1680", "CALL_BITMAPS_ARMBAND_H", "FreeSansBold24pt7b, FreeSansBold12pt7b");
+  h.raw("struct CallArt {\n  uint8_t cmd;\n  pitchcomm::PackedBitmap line1, line2;\n};\n\n");
+
+  std::string rows;
+  for (size_t i = 0; i < calls.size(); i++) {
+    const Call& call = calls[i];
+    int x1, y1, w, hh;
+    Canvas l1(W, H), l2(W, H);
+
+    sans24.textBounds(call.line1.c_str(), 0, 0, W, H, x1, y1, w, hh);
+    sans24.print(l1, (W - w) / 2, call.line2.empty() ? 70 : 52, call.line1.c_str(), 1);
+    if (!call.line2.empty()) {
+      sans12.textBounds(call.line2.c_str(), 0, 0, W, H, x1, y1, w, hh);
+      sans12.print(l2, (W - w) / 2, 90, call.line2.c_str(), 1);
+    }
+    std::string entry = "{ " + (call.cmd.empty() ? std::string("0") : "pitchcomm::" + call.cmd) + ",\n    " +
+                        h.ref(crop(l1, call.line1)) + ",\n    " + h.ref(crop(l2, call.line2)) + " }";
+    if (call.cmd.empty()) h.raw("// decodePitch() default\nstatic const CallArt unknownArt = " + entry + ";\n\n");
+    else rows += "  " + entry + ",\n";
+  }
+  h.raw("static const CallArt callArt[] = {\n" + rows + "};\n");
+  h.raw("const uint8_t CALL_ART_COUNT = sizeof(callArt) / sizeof(callArt[0]);\n\n");
+
+  r.header = h.text();
+  r.fontBytes = sans24.bytes();
+  return true;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+struct Target {
+  const char* name;
+  const char* source;
+  const char* header;
+  bool      (*build)(const Libs&, const std::string&, Result&);
+};
+
+static const Target TARGETS[] = {
+  { "XIAO HUD",       "XIAO_Catcher_HUD/Catcher_HUD_Receiver_v2.ino",    "XIAO_Catcher_HUD/CallBitmaps.h",    buildHud },
+  { "Heltec V3 OLED", "Heltec_Receiver/src/main.cpp",                    "Heltec_Receiver/src/CallBitmaps.h", buildHeltec },
+  { "Heltec Stick",   "Heltec_Stick_Receiver/src/main.cpp",              "Heltec_Stick_Receiver/src/CallBitmaps.h", buildStick },
+  { "T-Watch S3",     "TWatch_Receiver/src/main.cpp",                    "TWatch_Receiver/src/CallBitmaps.h", buildTwatch },
+  { "XIAO Armband",   "XIAO_Armband_ePaper/Catcher_Armband_ePaper_v1.ino", "XIAO_Armband_ePaper/CallBitmaps.h", buildArmband },
+};
+static const int TARGET_COUNT = sizeof(TARGETS) / sizeof(TARGETS[0]);
+
+static void usage() {
+  printf("usage: font_compiler [--root DIR] [--u8g2 u8g2_fonts.c] [--gfx FONTS_DIR]\n"
+         "                     [--glcd glcdfont.c] [--libdeps DIR] [--only DIR]\n"
+         "                     [--out DIR] [--dry-run]\n");
+}
+
+int main(int argc, char** argv) {
+  Libs libs;
+  libs.root = "..";
+  libs.glcdLoaded = false;
+  bool dryRun = false;
+  std::string libdeps, only, outDir;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--root") == 0 && i + 1 < argc)         libs.root = argv[++i];
+    else if (strcmp(argv[i], "--u8g2") == 0 && i + 1 < argc)    libs.u8g2 = argv[++i];
+    else if (strcmp(argv[i], "--gfx") == 0 && i + 1 < argc)     libs.gfx  = argv[++i];
+    else if (strcmp(argv[i], "--glcd") == 0 && i + 1 < argc)    libs.glcd = argv[++i];
+    else if (strcmp(argv[i], "--libdeps") == 0 && i + 1 < argc) libdeps   = argv[++i];
+    else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc)    only      = argv[++i];
+    else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc)     outDir    = argv[++i];
+    else if (strcmp(argv[i], "--dry-run") == 0)                 dryRun = true;
+    else { usage(); return 2; }
+  }
+
+  const char* home = getenv("HOME");
+  std::string sketchbook = std::string(home ? home : ".") + "/Arduino/libraries";
+  std::string root = libs.root;
+  if (outDir.empty()) outDir = root;
+  if (libs.u8g2.empty()) {
+    std::vector<std::string> c;
+    if (!libdeps.empty()) c.push_back(libdeps + "/U8g2/src/clib/u8g2_fonts.c");
+    c.push_back(root + "/Heltec_Receiver/.pio/libdeps/heltec_wifi_lora_32_V3/U8g2/src/clib/u8g2_fonts.c");
+    c.push_back(root + "/Heltec_Stick_Receiver/.pio/libdeps/heltec_wireless_stick_lite_v3/U8g2/src/clib/u8g2_fonts.c");
+    c.push_back(sketchbook + "/U8g2/src/clib/u8g2_fonts.c");
+    libs.u8g2 = firstExisting(c);
+  }
+  if (libs.glcd.empty()) {
+    std::vector<std::string> c;
+    if (!libdeps.empty()) c.push_back(libdeps + "/TFT_eSPI/Fonts/glcdfont.c");
+    c.push_back(root + "/TWatch_Receiver/.pio/libdeps/lilygo-t-watch-s3/TFT_eSPI/Fonts/glcdfont.c");
+    c.push_back(root + "/TDeck_Transmitter/.pio/libdeps/tdeck-plus/TFT_eSPI/Fonts/glcdfont.c");
+    c.push_back(sketchbook + "/TFT_eSPI/Fonts/glcdfont.c");
+    libs.glcd = firstExisting(c);
+  }
+  if (libs.gfx.empty()) {
+    std::vector<std::string> c;
+    if (!libdeps.empty()) c.push_back(libdeps + "/Adafruit GFX Library/Fonts/FreeSansBold24pt7b.h");
+    c.push_back(sketchbook + "/Adafruit_GFX_Library/Fonts/FreeSansBold24pt7b.h");
+    std::string found = firstExisting(c);
+    if (!found.empty()) libs.gfx = found.substr(0, found.rfind('/'));
+  }
+
+  printf("=== PitchComm font compiler ===\n");
+  printf("u8g2 fonts: %s\n", libs.u8g2.empty() ? "(not found, use --u8g2)" : libs.u8g2.c_str());
+  printf("GFX fonts:  %s\n", libs.gfx.empty()  ? "(not found, use --gfx)"  : libs.gfx.c_str());
+  printf("GLCD font:  %s\n\n", libs.glcd.empty() ? "(not found, use --glcd)" : libs.glcd.c_str());
+
+  if (!libs.u8g2.empty() && !readFile(libs.u8g2, libs.u8g2Source)) {
+    fprintf(stderr, "cannot read %s\n", libs.u8g2.c_str());
+  }
+  if (!libs.glcd.empty()) {
+    libs.glcdLoaded = libs.glcdFont.load(libs.glcd);
+    if (!libs.glcdLoaded) fprintf(stderr, "no font[] table in %s\n", libs.glcd.c_str());
+  }
+
+  printf("%-15s %-42s %9s %9s\n", "receiver", "header", "art B", "fonts B");
+  int skipped = 0, built = 0;
+  for (int t = 0; t < TARGET_COUNT; t++) {
+    const Target& tg = TARGETS[t];
+    if (!only.empty() && strncmp(tg.header, only.c_str(), only.size()) != 0) continue;
+    built++;
+    std::string src;
+    Result r;
+    r.fontBytes = 0;
+    if (!readFile(root + "/" + tg.source, src) || !tg.build(libs, src, r)) {
+      printf("%-15s %-42s %9s\n", tg.name, tg.header, "SKIPPED");
+      skipped++;
+      continue;
+    }
+    size_t artBytes = 0;
+    size_t mark = r.header.find("0x");
+    for (size_t i = mark; i != std::string::npos; i = r.header.find("0x", i + 2)) artBytes++;
+
+    if (!dryRun && !writeIfChanged(outDir + "/" + tg.header, r.header)) {
+      printf("%-15s %-42s %9s\n", tg.name, tg.header, "WRITE ERR");
+      skipped++;
+      continue;
+    }
+    printf("%-15s %-42s %9lu %9lu\n", tg.name, tg.header, (unsigned long)artBytes,
+           (unsigned long)r.fontBytes);
+  }
+
+  printf("\nart B: generated bitmap bytes in flash. fonts B: font tables the\n"
+         "receiver no longer references once CallBitmaps.h is present.\n");
+  if (dryRun) printf("(dry run, nothing written)\n");
+  if (built == 0) fprintf(stderr, "no receiver header under %s\n", only.c_str());
+  return skipped || built == 0 ? 1 : 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * ============================================================================
+ * GROUP SIM — channel airtime per call vs. receiver count, by addressing
+ * ============================================================================
+ * One call goes to N receivers (device ids 1..N, N = 1..20), sent as:
+ *
+ *   unicast   one 6-byte frame per receiver, addr = its id (today's way)
+ *   group     one 6-byte frame to callGroup(GROUP_DEFENSE), which the N
+ *             receivers have joined
+ *   mask      one 9-byte MASK CALL naming exactly the N devices
+ *
+ * each as COPIES blind copies COPY_GAP_MS apart, and
+ *
+ *   mask+ack  one 9-byte ver 0x02 MASK CALL. Each receiver ACKs in its
+ *             slot, and the call is resent until all ACK or ARQ_MAX_SENDS
+ *             is reached (PitchCommArq.h timing). The ACK has 3 node bits,
+ *             so this runs only up to ARQ_MAX_NODES receivers.
+ *
+ * BYSTANDERS more devices (ids 21..24, battery group only) hear everything
+ * too. Every device runs each frame it hears through
+ * CallView::valid(its CallAddress), the filter the receivers use. The run
+ * fails if a bystander accepts a frame or a receiver rejects one meant for
+ * it.
+ *
+ * Channel: each link loses each packet with probability LOSS, in both
+ * directions. Columns per mode:
+ *
+ *   air ms    channel airtime per call: coach frames plus ACKs
+ *   all %     calls that reached every receiver
+ *   last ms   call start to the last receiver's first copy (mean)
+ * ============================================================================
+ */
+
+#include <PitchCommProtocol.h>
+#include <PitchCommAirtime.h>
+#include <PitchCommArq.h>
+
+#include <cstdio>
+#include <vector>
+
+using namespace pitchcomm;
+
+static const int      CALLS       = 2000;
+static const int      COPIES      = 3;
+static const uint32_t COPY_GAP_MS = 50;
+static const double   LOSS        = 0.10;
+static const int      BYSTANDERS  = 4;
+static const int      MAX_RX      = 20;
+
+static const int RX_COUNTS[] = { 1, 2, 3, 4, 6, 8, 10, 12, 16, 20 };
+
+// ============================================================================
+// RANDOM
+// ============================================================================
+static uint64_t rngState = 0x9E3779B97F4A7C15ULL;
+static uint64_t rng() {
+  rngState ^= rngState >> 12;
+  rngState ^= rngState << 25;
+  rngState ^= rngState >> 27;
+  return rngState * 0x2545F4914F6CDD1DULL;
+}
+static double uniform() { return (rng() >> 11) * (1.0 / 9007199254740992.0); }
+
+// ============================================================================
+// DEVICES
+// ============================================================================
+struct Device {
+  CallAddress addr;
+  bool        wanted;       // one of the call's receivers
+  double      firstMs;      // first copy it accepted, < 0 = none yet
+};
+
+static std::vector<Device> devices;
+static int filterErrors = 0;
+
+static void setupDevices(int receivers) {
+  devices.clear();
+  for (int i = 1; i <= receivers; i++) {
+    Device d = { { (uint8_t)i, 1UL << GROUP_DEFENSE }, true, -1 };
+    devices.push_back(d);
+  }
+  for (int i = 0; i < BYSTANDERS; i++) {
+    Device d = { { (uint8_t)(MAX_RX + 1 + i), 1UL << GROUP_BATTERY }, false, -1 };
+    devices.push_back(d);
+  }
+}
+
+// A frame ends at atMs; every device that hears it runs the filter.
+// forId: the device a unicast frame is for (0 = the whole call).
+// Returns a bit per device index that accepted it.
+static uint32_t broadcast(const uint8_t* frame, size_t len, double atMs, uint8_t forId) {
+  uint32_t heard = 0;
+  for (size_t i = 0; i < devices.size(); i++) {
+    Device& d = devices[i];
+    if (uniform() < LOSS) continue;
+    bool accepted = CallView(frame, len).valid(d.addr);
+    bool meant    = d.wanted && (forId == 0 || forId == d.addr.id);
+    if (accepted != meant) filterErrors++;
+    if (!accepted) continue;
+    heard |= 1UL << i;
+    if (d.firstMs < 0) d.firstMs = atMs;
+  }
+  return heard;
+}
+
+// ============================================================================
+// MODES — each returns airtime (ms) and fills devices[].firstMs
+// ============================================================================
+enum Mode { UNICAST, GROUP, MASK, MASK_ACK, MODE_COUNT };
+static const char* MODE_NAMES[MODE_COUNT] = { "unicast 3x", "group 3x", "mask 3x", "mask + ACK" };
+
+static uint32_t receiverMask(int receivers) {
+  uint32_t m = 0;
+  for (int i = 1; i <= receivers; i++) m |= deviceBit((uint8_t)i);
+  return m;
+}
+
+static double sendCopies(const uint8_t* frame, size_t len, double& t, uint8_t forId) {
+  double toa = timeOnAirUs(MODEM_CALL_SF7, (uint8_t)len) / 1000.0;
+  for (int k = 0; k < COPIES; k++) {
+    broadcast(frame, len, t + toa, forId);
+    t += toa + COPY_GAP_MS;
+  }
+  return COPIES * toa;
+}
+
+static double sendCall(Mode mode, int receivers, uint8_t seq) {
+  double t = 0, air = 0;
+  switch (mode) {
+  case UNICAST:
+    for (int i = 1; i <= receivers; i++) {
+      CallFrame f = encodeCall((uint8_t)i, CMD_CURVE, seq);
+      air += sendCopies(f.bytes, CALL_LENGTH, t, (uint8_t)i);
+    }
+    break;
+  case GROUP: {
+    CallFrame f = encodeCall(callGroup(GROUP_DEFENSE), CMD_CURVE, seq);
+    air += sendCopies(f.bytes, CALL_LENGTH, t, 0);
+    break;
+  }
+  case MASK: {
+    CallMaskFrame f = encodeMaskCall(receiverMask(receivers), CMD_CURVE, seq);
+    air += sendCopies(f.bytes, CALL_MASK_LENGTH, t, 0);
+    break;
+  }
+  case MASK_ACK: {
+    CallMaskFrame f = encodeMaskCall(receiverMask(receivers), CMD_CURVE, seq, true);
+    double callMs = timeOnAirUs(MODEM_CALL_SF7, CALL_MASK_LENGTH) / 1000.0;
+    double ackMs  = timeOnAirUs(MODEM_CALL_SF7, CALL_ACK_LENGTH) / 1000.0;
+    double deadlineMs = callMs + 1 + ARQ_TURNAROUND_MS + receivers * callAckSlotMs(MODEM_CALL_SF7);
+    uint32_t everyone = (1UL << receivers) - 1, acked = 0;
+    for (int s = 0; s < ARQ_MAX_SENDS && acked != everyone; s++) {
+      uint32_t heard = broadcast(f.bytes, CALL_MASK_LENGTH, t + callMs, 0);
+      air += callMs;
+      // Every receiver that heard this send ACKs it, duplicates too
+      for (int i = 0; i < receivers; i++) {
+        if (!(heard & (1UL << i))) continue;
+        CallAckFrame a = encodeCallAck((uint8_t)i, seq, -90);
+        air += ackMs;
+        if (uniform() < LOSS) continue;
+        CallAckView v(a.bytes, CALL_ACK_LENGTH);
+        if (v.valid() && v.seq() == seq) acked |= 1UL << v.node();
+      }
+      t += deadlineMs;
+    }
+    break;
+  }
+  default:
+    break;
+  }
+  return air;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+int main() {
+  printf("PitchComm group sim — %d calls per point, SF7, %.0f%% loss per link, %d bystanders\n",
+         CALLS, LOSS * 100, BYSTANDERS);
+  printf("copies: %d, %u ms apart; ACK mode: up to %u sends, %u ms slots, max %u receivers\n\n",
+         COPIES, (unsigned)COPY_GAP_MS, (unsigned)ARQ_MAX_SENDS,
+         (unsigned)callAckSlotMs(MODEM_CALL_SF7), (unsigned)ARQ_MAX_NODES);
+
+  printf("%4s", "rx");
+  for (int m = 0; m < MODE_COUNT; m++) printf("  %-22s", MODE_NAMES[m]);
+  printf("\n%4s", "");
+  for (int m = 0; m < MODE_COUNT; m++) printf("  %6s %6s %8s", "air ms", "all %", "last ms");
+  printf("\n");
+
+  for (size_t r = 0; r < sizeof(RX_COUNTS) / sizeof(RX_COUNTS[0]); r++) {
+    int receivers = RX_COUNTS[r];
+    printf("%4d", receivers);
+    for (int m = 0; m < MODE_COUNT; m++) {
+      if (m == MASK_ACK && receivers > ARQ_MAX_NODES) {
+        printf("  %6s %6s %8s", "-", "-", "-");
+        continue;
+      }
+      double air = 0, lastSum = 0;
+      int all = 0;
+      for (int c = 0; c < CALLS; c++) {
+        setupDevices(receivers);
+        air += sendCall((Mode)m, receivers, (uint8_t)c);
+        bool every = true;
+        double last = 0;
+        for (int i = 0; i < receivers; i++) {
+          if (devices[i].firstMs < 0) every = false;
+          else if (devices[i].firstMs > last) last = devices[i].firstMs;
+        }
+        if (every) { all++; lastSum += last; }
+      }
+      printf("  %6.1f %6.1f %8.1f", air / CALLS, 100.0 * all / CALLS, all ? lastSum / all : 0.0);
+    }
+    printf("\n");
+  }
+
+  printf("\nAddress filter errors: %d\n", filterErrors);
+  printf("%s\n", filterErrors ? "FAIL" : "OK");
+  return filterErrors ? 1 : 0;
+}
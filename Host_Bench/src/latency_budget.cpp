@@ -0,0 +1,313 @@
+/*
+ * ============================================================================
+ * LATENCY BUDGET — call-to-display latency per receiver
+ * ============================================================================
+ * Builds an end-to-end budget for every receiver from:
+ *   - exact LoRa time-on-air for the packet the coach sends today, using the
+ *     receiver's own radio profile (setupLoRa() SF10 or initRadio() SF7)
+ *   - DIO1 ISR to loop() wakeup (PitchCommRxEvent.h; log "wake=" on target)
+ *   - SPI readout, decode, framebuffer render
+ *   - bus flush (I2C / SPI byte counts at the configured clock)
+ *   - panel / haptic time where the receiver has one
+ *
+ * Stage defaults are bus arithmetic or datasheet figures, noted per row.
+ * Replace them with bench measurements on the command line:
+ *
+ *   latency_budget --set twatch.render=18.5/22 --target hud=60 --target armband=500/worst
+ *
+ * --sniff N budgets the battery receivers (HUD, armband) in RX duty cycle
+ * mode (PitchCommSniff.h) with an N-symbol coach preamble. That adds a
+ * "sniff" stage: the extra preamble, the same on every call, so typical and
+ * worst case are equal. A table of preamble lengths against the radio's
+ * average current is printed either way.
+ *
+ * Each target is a typical or a worst-case claim, and is checked against
+ * that total: "<60ms" on the HUD is typical, while the armband promises
+ * every call on the glass within its figure. Exits 1 when any receiver
+ * misses its target.
+ * ============================================================================
+ */
+
+#include <PitchCommProtocol.h>
+#include <PitchCommFec.h>
+#include <PitchCommAirtime.h>
+#include <PitchCommSniff.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace pitchcomm;
+
+// ============================================================================
+// MODEL
+// ============================================================================
+const int MAX_STAGES = 8;
+
+struct Stage {
+  const char* name;
+  double      typMs;
+  double      worstMs;
+  const char* source;
+};
+
+enum TargetKind { TARGET_TYPICAL, TARGET_WORST };
+
+struct Receiver {
+  const char* key;
+  const char* name;
+  LoRaModem   modem;
+  uint8_t     payload;          // bytes the coach sends today
+  bool        sniffs;           // battery receiver: RX duty cycle available
+  double      targetMs;
+  TargetKind  targetKind;       // which total the target bounds
+  const char* targetSource;
+  Stage       stages[MAX_STAGES];
+};
+
+// I2C frame time: 9 bits per byte (8 + ACK), plus address/control bytes per
+// U8g2 transfer chunk of 32 data bytes
+static double i2cMs(double bytes, double hz) {
+  return (bytes + 2.0 * bytes / 32.0) * 9.0 / hz * 1000.0;
+}
+
+static double spiMs(double bytes, double hz) {
+  return bytes * 8.0 / hz * 1000.0;
+}
+
+// T-Watch band push: band 0 is copied out of PSRAM (~40 MB/s) before the
+// first transfer, later copies overlap the wire. loop() queues the next
+// band on the first tick after one finishes, so a 1.9 ms band at 40 MHz
+// takes 2 ticks, 3 when loop() is busy with something else.
+static double bandPushMs(int bands, double bandBytes, int ticksPerBand) {
+  return bandBytes / 40e6 * 1000.0 + bands * ticksPerBand * 1.0;
+}
+
+// "airtime" rows are filled in from the modem at startup
+static Receiver receivers[] = {
+  { "heltec", "Heltec V3 128x64 OLED", MODEM_SIGNAL_SF10, SIGNAL_LENGTH, false,
+    350.0, TARGET_TYPICAL, "README \"<350ms typical\" (SF10)", {
+      { "airtime",  0, 0,     "LoRa ToA" },
+      { "rx-wake",  0.02, 0.05, "DIO1 ISR -> task notify" },
+      { "spi-read", 0.1, 0.2, "SX1262 readData" },
+      { "render",   0.5, 1.0, "U8g2 helvB24 into buffer" },
+      { "flush",    i2cMs(336, 400e3), i2cMs(1080, 400e3),
+                    "dirty tiles ~336 B (full frame 1080 B) HW I2C 400 kHz" },
+    } },
+  { "stick", "Heltec Stick 64x32 OLED", MODEM_SIGNAL_SF10, SIGNAL_LENGTH, false,
+    350.0, TARGET_TYPICAL, "README \"<350ms typical\" (SF10)", {
+      { "airtime",  0, 0,     "LoRa ToA" },
+      { "rx-wake",  0.02, 0.05, "DIO1 ISR -> task notify" },
+      { "spi-read", 0.1, 0.2, "SX1262 readData" },
+      { "render",   0.3, 0.6, "U8g2 helvB18 into buffer" },
+      { "flush",    i2cMs(168, 400e3), i2cMs(284, 400e3),
+                    "dirty tiles ~168 B (full frame 284 B) HW I2C 400 kHz" },
+    } },
+  { "twatch", "T-Watch S3 240x240 TFT", MODEM_SIGNAL_SF10, SIGNAL_LENGTH, false,
+    350.0, TARGET_TYPICAL, "README \"<350ms typical\" (SF10)", {
+      { "airtime",  0, 0,     "LoRa ToA" },
+      { "rx-wake",  0.02, 0.05, "DIO1 ISR -> task notify" },
+      { "spi-read", 0.1, 0.2, "SX1262 readData" },
+      { "render",   2.5, 4.0,   "cached frame 115 KB PSRAM copy to back buffer + #n" },
+      { "dma",      bandPushMs(12, 9600, 2), bandPushMs(12, 9600, 3),
+                    "12 x 9.6 KB DMA bands @ 40 MHz, queued on 1 ms loop ticks" },
+      { "haptic",   i2cMs(16, 100e3) + 20, i2cMs(16, 100e3) + 30,
+                    "DRV2605 sequence + GO (16 B I2C) + ERM spin-up" },
+    } },
+  { "hud", "XIAO HUD 64x32 OLED", MODEM_CALL_SF7, CALL_LENGTH, true,
+    60.0, TARGET_TYPICAL, "HUD guide \"<60ms\"", {
+      { "airtime",  0, 0,     "LoRa ToA" },
+      { "rx-wake",  0.03, 0.1,  "DIO1 ISR -> semaphore, WFE wake" },
+      { "spi-read", 0.1, 0.2, "SX1262 readData" },
+      { "render",   0.3, 0.6, "U8g2 helvB14 into buffer" },
+      { "flush",    i2cMs(269, 400e3), i2cMs(269, 400e3) * 1.1,
+                    "256 B + 13 B window, TWIM EasyDMA 400 kHz (SW I2C was ~15 ms)" },
+    } },
+  { "armband", "XIAO Armband 250x122 ePaper", MODEM_CALL_SF7, CALL_LENGTH, true,
+    600.0, TARGET_WORST, "examples/README \"<600ms worst\"", {
+      { "airtime",  0, 0,     "LoRa ToA" },
+      { "rx-wake",  0.03, 0.1,  "DIO1 ISR -> semaphore, WFE wake" },
+      { "spi-read", 0.1, 0.2, "SX1262 readData" },
+      { "render",   6, 12,    "GFX FreeSansBold24 into canvas + diff vs. glass" },
+      { "flush",    spiMs(3570, 4e6), spiMs(2 * 4000, 4e6) * 1.3,
+                    "changed window ~3570 B (whole panel 2 x 4000 B) SPI 4 MHz" },
+      { "panel",    400, 500,  "partial 300-500 ms; full refresh only in idle windows" },
+    } },
+};
+const size_t RECEIVER_COUNT = sizeof(receivers) / sizeof(receivers[0]);
+
+// SX1262 supply current by state, for the sniff table
+const double RX_MA    = 6.0;      // ePaper build guide "LoRa RX ~6mA"
+const double WAKE_MA  = 1.5;      // TCXO start + standby (datasheet, typ)
+const double SLEEP_MA = 0.0012;   // warm-start sleep, RTC on (datasheet)
+
+const uint16_t SNIFF_LEVELS[] = { 0, 32, 64, 128, 256 };
+
+// Radio average current with the coach sending `preamble` symbols
+static double sniffMa(const LoRaModem& m, uint16_t preamble) {
+  double rx = sniffRxUs(m), sleep = sniffSleepUs(m, preamble);
+  if (preamble == 0 || sleep == 0) return RX_MA;
+  return (rx * RX_MA + SNIFF_WAKE_US * WAKE_MA + (sleep - SNIFF_WAKE_US) * SLEEP_MA) / (rx + sleep);
+}
+
+// ============================================================================
+// COMMAND LINE
+// ============================================================================
+static Receiver* findReceiver(const char* key, size_t keyLen) {
+  for (size_t i = 0; i < RECEIVER_COUNT; i++) {
+    if (strlen(receivers[i].key) == keyLen && strncmp(receivers[i].key, key, keyLen) == 0) {
+      return &receivers[i];
+    }
+  }
+  return NULL;
+}
+
+static Stage* findStage(Receiver* r, const char* name) {
+  for (int i = 0; i < MAX_STAGES && r->stages[i].name; i++) {
+    if (strcmp(r->stages[i].name, name) == 0) return &r->stages[i];
+  }
+  for (int i = 0; i < MAX_STAGES; i++) {
+    if (!r->stages[i].name) return &r->stages[i];   // new stage
+  }
+  return NULL;
+}
+
+// receiver.stage=typ[/worst]
+static bool applySet(const char* arg) {
+  const char* dot = strchr(arg, '.');
+  const char* eq  = strchr(arg, '=');
+  if (!dot || !eq || eq < dot) return false;
+  Receiver* r = findReceiver(arg, dot - arg);
+  if (!r) return false;
+
+  static char names[16][24];
+  static int  nameCount = 0;
+  if (nameCount >= 16 || (size_t)(eq - dot - 1) >= sizeof(names[0])) return false;
+  char* name = names[nameCount++];
+  memcpy(name, dot + 1, eq - dot - 1);
+  name[eq - dot - 1] = '\0';
+
+  Stage* st = findStage(r, name);
+  if (!st) return false;
+  char* end;
+  st->name    = name;
+  st->typMs   = strtod(eq + 1, &end);
+  st->worstMs = (*end == '/') ? strtod(end + 1, NULL) : st->typMs;
+  st->source  = "measured (--set)";
+  return true;
+}
+
+// receiver=ms[/typ|/worst]; the kind stays the receiver's own if omitted
+static bool applyTarget(const char* arg) {
+  const char* eq = strchr(arg, '=');
+  if (!eq) return false;
+  Receiver* r = findReceiver(arg, eq - arg);
+  if (!r) return false;
+  char* end;
+  r->targetMs = strtod(eq + 1, &end);
+  if (strcmp(end, "/worst") == 0)    r->targetKind = TARGET_WORST;
+  else if (strcmp(end, "/typ") == 0) r->targetKind = TARGET_TYPICAL;
+  else if (*end != '\0')             return false;
+  r->targetSource = "--target";
+  return true;
+}
+
+// Symbols of coach preamble; adds a "sniff" stage to the battery receivers
+static bool applySniff(const char* arg) {
+  static char source[64];
+  long preamble = strtol(arg, NULL, 10);
+  if (preamble <= 0 || preamble > 0xFFFF) return false;
+  for (size_t i = 0; i < RECEIVER_COUNT; i++) {
+    Receiver& r = receivers[i];
+    if (!r.sniffs) continue;
+    if (sniffSleepUs(r.modem, (uint16_t)preamble) == 0) return false;
+    Stage* st = findStage(&r, "sniff");
+    if (!st) return false;
+    snprintf(source, sizeof(source), "coach preamble %ld sym, radio %.2f mA (continuous %.1f)",
+             preamble, sniffMa(r.modem, (uint16_t)preamble), RX_MA);
+    st->name    = "sniff";
+    st->typMs   = st->worstMs = sniffExtraUs(r.modem, (uint16_t)preamble) / 1000.0;
+    st->source  = source;
+  }
+  return true;
+}
+
+static void usage() {
+  printf("usage: latency_budget [--set rx.stage=typ[/worst]] [--target rx=ms[/typ|/worst]]\n"
+         "                      [--sniff symbols]\n");
+  printf("receivers:");
+  for (size_t i = 0; i < RECEIVER_COUNT; i++) printf(" %s", receivers[i].key);
+  printf("\n");
+}
+
+// ============================================================================
+// REPORT
+// ============================================================================
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    bool ok = false;
+    if (strcmp(argv[i], "--set") == 0 && i + 1 < argc)         ok = applySet(argv[++i]);
+    else if (strcmp(argv[i], "--target") == 0 && i + 1 < argc) ok = applyTarget(argv[++i]);
+    else if (strcmp(argv[i], "--sniff") == 0 && i + 1 < argc)  ok = applySniff(argv[++i]);
+    if (!ok) { usage(); return 2; }
+  }
+
+  printf("=== PitchComm latency budget ===\n\n");
+  int failures = 0;
+
+  for (size_t i = 0; i < RECEIVER_COUNT; i++) {
+    Receiver& r = receivers[i];
+    Stage* air = findStage(&r, "airtime");
+    if (air->typMs == 0) {
+      air->typMs = air->worstMs = timeOnAirUs(r.modem, r.payload) / 1000.0;
+    }
+
+    printf("%s — SF%d BW%lu CR4/%d, %u-byte packet\n", r.name, r.modem.sf,
+           (unsigned long)(r.modem.bwHz / 1000), r.modem.cr, r.payload);
+    printf("  ToA by format: signal %.1f ms | compact %.1f ms | call %.1f ms | FEC %.1f ms\n",
+           timeOnAirUs(r.modem, SIGNAL_LENGTH) / 1000.0,
+           timeOnAirUs(r.modem, COMPACT_LENGTH) / 1000.0,
+           timeOnAirUs(r.modem, CALL_LENGTH) / 1000.0,
+           timeOnAirUs(r.modem, FEC_LENGTH) / 1000.0);
+    printf("  %-10s %9s %9s  %s\n", "Stage", "typ ms", "worst ms", "Source");
+
+    double typ = 0, worst = 0;
+    for (int s = 0; s < MAX_STAGES && r.stages[s].name; s++) {
+      const Stage& st = r.stages[s];
+      printf("  %-10s %9.2f %9.2f  %s\n", st.name, st.typMs, st.worstMs, st.source);
+      typ   += st.typMs;
+      worst += st.worstMs;
+    }
+
+    bool worstKind = r.targetKind == TARGET_WORST;
+    bool pass = (worstKind ? worst : typ) <= r.targetMs;
+    if (!pass) failures++;
+    printf("  %-10s %9.2f %9.2f\n", "TOTAL", typ, worst);
+    printf("  target %.0f ms %s (%s): %s\n\n", r.targetMs, worstKind ? "worst" : "typical",
+           r.targetSource, pass ? "PASS" : "FAIL");
+  }
+
+  // Sniff trade-off for the battery receivers: the preamble is in symbols,
+  // so link adaptation's slowest call step (SF10) scales every row by 8
+  LoRaModem sf10 = MODEM_CALL_SF7;
+  sf10.sf = 10;
+  printf("RX duty cycle (HUD / armband, --sniff N) — window %u symbols, wake-up %.1f ms\n",
+         (unsigned)SNIFF_RX_SYMBOLS, SNIFF_WAKE_US / 1000.0);
+  printf("  %-8s %9s %9s %9s %9s %8s %9s\n", "preamble", "+ms SF7", "+ms SF10",
+         "sleep ms", "listen %", "awake %", "radio mA");
+  for (size_t i = 0; i < sizeof(SNIFF_LEVELS) / sizeof(SNIFF_LEVELS[0]); i++) {
+    uint16_t p = SNIFF_LEVELS[i];
+    double rx = sniffRxUs(MODEM_CALL_SF7), sleep = p ? sniffSleepUs(MODEM_CALL_SF7, p) : 0;
+    double listen = sleep ? 100.0 * rx / (rx + sleep) : 100.0;
+    double awake  = sleep ? 100.0 * (rx + SNIFF_WAKE_US) / (rx + sleep) : 100.0;
+    char name[12];
+    snprintf(name, sizeof(name), p ? "%u" : "off", (unsigned)p);
+    printf("  %-8s %9.1f %9.1f %9.1f %9.1f %8.1f %9.2f\n", name,
+           sniffExtraUs(MODEM_CALL_SF7, p) / 1000.0, sniffExtraUs(sf10, p) / 1000.0,
+           sleep / 1000.0, listen, awake, sniffMa(MODEM_CALL_SF7, p));
+  }
+  printf("\n");
+
+  printf("%d of %u receivers over target\n", failures, (unsigned)RECEIVER_COUNT);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,438 @@
+/*
+ * ============================================================================
+ * LINK SIM — adaptive data rate, coach vs. the receiver sketches
+ * ============================================================================
+ * Plays the coach with pitchcomm::LinkAdapter (PitchCommLink.h) against the
+ * unmodified receiver sketches (sim/SimFirmware.h), one radio family at a
+ * time:
+ *
+ *   signal  Heltec V3, Stick, T-Watch   8-byte signal frames, home SF10
+ *   call    XIAO HUD, Armband           6-byte call frames,   home SF7
+ *
+ * The coach sends CALLS calls, one copy each, CALL_GAP_MIN_MS to
+ * CALL_GAP_MAX_MS apart, at whatever step the adapter is on. It also sends
+ * the adapter's link commands. Receivers answer with reports from their
+ * own loop(), and the coach hears a report only if it is listening on that
+ * SF and is not transmitting.
+ *
+ * Channel: each receiver has an SNR at full coach power, which is
+ * scenario mean - node * spread plus slow AR(1) fading. It is the same in
+ * both directions. A packet is lost with probability
+ * 1 / (1 + e^(SNR - floor(SF))), and a receiver tuned to another SF hears
+ * nothing.
+ *
+ *   dugout    40 m dugout to plate, plenty of margin
+ *   outfield  long range, SF10 is all the link supports
+ *   fade      deep slow fading around a middling mean
+ *   dropcmd   receiver 1 hears calls but no link frames for 8 minutes
+ *   blackout  receiver 0 hears nothing and sends nothing for 90 s
+ *
+ * Each scenario runs three times: "fixed" (no link frames, everyone at
+ * home), "adr" (default coach) and "save" (coach power saving on, so the
+ * call family adapts too and both may drop TX power). Columns:
+ *
+ *   calls %   calls the worst receiver read
+ *   SFn %     share of calls sent at each SF
+ *   air ms    coach airtime per call, link frames included
+ *   up ms     receivers' report airtime per call
+ *   steps     step changes (failed: not confirmed by every receiver)
+ *   fallbk    receiver fallbacks to home
+ *   stranded  longest time any receiver listened on another SF than the
+ *             coach sent on
+ *
+ * Exits 1 if a receiver stays out of step longer than LINK_FALLBACK_MS +
+ * LINK_JOIN_MS, or if the signal family in "dugout" sends fewer than half
+ * its calls at SF7.
+ *
+ * Coach behaviour beyond LinkAdapter (one copy per call, call spacing) is
+ * an assumption: the T-Deck TX source is not in this tree.
+ * ============================================================================
+ */
+
+#include <SimFirmware.h>
+#include <PitchCommLink.h>
+#include <PitchCommAirtime.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace pitchcomm;
+
+static const int      CALLS           = 150;
+static const uint32_t CALL_GAP_MIN_MS = 8000;
+static const uint32_t CALL_GAP_MAX_MS = 25000;
+static const double   FADE_TAU_MS     = 20000;
+
+// ============================================================================
+// SCENARIOS
+// ============================================================================
+struct Scenario {
+  const char* name;
+  double   snrMean, snrSwing;      // dB at full power, fading sigma
+  double   nodeSpread;             // receiver n is n * spread dB worse
+  int      cutNode;                // -1 = none
+  uint32_t cutStartMs, cutMs;
+  bool     linkOnly;               // cut drops link frames only
+};
+
+static const Scenario SCENARIOS[] = {
+  // name         snr mean/swing  spread  cut node/start/len        link only
+  { "dugout",      8.0, 1.5,      1.0,    -1,      0,      0,       false },
+  { "outfield",   -6.0, 1.5,      1.0,    -1,      0,      0,       false },
+  { "fade",        0.0, 5.0,      1.0,    -1,      0,      0,       false },
+  { "dropcmd",     8.0, 1.5,      1.0,     1, 300000, 480000,       true  },
+  { "blackout",    8.0, 1.5,      1.0,     0, 300000,  90000,       false },
+};
+static const int SCENARIO_COUNT = sizeof(SCENARIOS) / sizeof(SCENARIOS[0]);
+
+// ============================================================================
+// RANDOM
+// ============================================================================
+static uint64_t rngState;
+static uint64_t rng() {
+  rngState ^= rngState >> 12;
+  rngState ^= rngState << 25;
+  rngState ^= rngState >> 27;
+  return rngState * 0x2545F4914F6CDD1DULL;
+}
+static double uniform() { return (rng() >> 11) * (1.0 / 9007199254740992.0); }
+static double gaussian() {
+  double u1 = uniform(), u2 = uniform();
+  if (u1 < 1e-12) u1 = 1e-12;
+  return sqrt(-2.0 * log(u1)) * cos(6.283185307179586 * u2);
+}
+
+// ============================================================================
+// RECEIVERS
+// ============================================================================
+struct Node {
+  const char*   name;
+  SX1262*       radio;
+  void        (*setup)();
+  void        (*loop)();
+  LinkFollower* link;
+};
+
+struct Family {
+  const char*       name;
+  const LinkFamily* link;
+  bool              signalFrames;
+  const Node*       nodes;
+  int               count;
+};
+
+static const Node SIGNAL_NODES[] = {
+  { "Heltec V3", &heltec::radio, heltec::setup, heltec::loop, &heltec::adr },
+  { "Stick",     &stick::radio,  stick::setup,  stick::loop,  &stick::adr  },
+  { "T-Watch",   &twatch::radio, twatch::setup, twatch::loop, &twatch::adr },
+};
+static const Node CALL_NODES[] = {
+  { "HUD",       &hud::radio,     hud::setup,     hud::loop,     &hud::adr     },
+  { "Armband",   &armband::radio, armband::setup, armband::loop, &armband::adr },
+};
+
+static const Family FAMILIES[] = {
+  { "signal", &LINK_SIGNAL, true,  SIGNAL_NODES, 3 },
+  { "call",   &LINK_CALL,   false, CALL_NODES,   2 },
+};
+static const int FAMILY_COUNT = sizeof(FAMILIES) / sizeof(FAMILIES[0]);
+static const int MAX_NODES = 3;
+
+// ============================================================================
+// RUN STATE — shared with the delay / radio hooks
+// ============================================================================
+struct Delivery {
+  uint64_t atUs;
+  int      node;                   // -1 = to the coach
+  uint8_t  sf;
+  uint8_t  bytes[MAX_PACKET_LENGTH];
+  uint8_t  len;
+  float    snr;
+  int      tag;                    // call index, -1 = link frame
+};
+
+struct Run {
+  const Scenario* sc;
+  const Family*   fam;
+  bool            adaptive;
+  LinkAdapter*    coach;
+  uint64_t        base, coachBusyUs, nextCallUs;
+  int             callsSent;
+  std::vector<Delivery> air;       // in flight, any order
+  double          fade[MAX_NODES];
+  uint64_t        fadeUs[MAX_NODES];
+
+  // results
+  std::vector<bool> read[MAX_NODES];
+  uint64_t  callAirUs, linkAirUs, upAirUs;
+  int       callsAtSf[13];
+  uint64_t  offSinceUs[MAX_NODES];
+  uint64_t  strandedMaxUs;
+};
+static Run cur;
+
+static uint32_t nowMs() { return (uint32_t)((sim::clockUs() - cur.base) / 1000); }
+
+static bool cut(int node, uint64_t us, bool linkFrame) {
+  const Scenario& s = *cur.sc;
+  if (node != s.cutNode || (s.linkOnly && !linkFrame)) return false;
+  uint64_t t = (us - cur.base) / 1000;
+  return t >= s.cutStartMs && t < (uint64_t)s.cutStartMs + s.cutMs;
+}
+
+// Receiver n's SNR at full coach power
+static double channelSnr(int n, uint64_t us) {
+  const Scenario& s = *cur.sc;
+  if (s.snrSwing > 0) {
+    double a = exp(-(double)(us - cur.fadeUs[n]) / 1000.0 / FADE_TAU_MS);
+    cur.fade[n] = a * cur.fade[n] + sqrt(1 - a * a) * s.snrSwing * gaussian();
+    cur.fadeUs[n] = us;
+  }
+  return s.snrMean - n * s.nodeSpread + cur.fade[n];
+}
+
+static bool survives(double snr, uint8_t sf) {
+  return uniform() >= 1.0 / (1.0 + exp(snr - snrFloorQ4(sf) / 4.0));
+}
+
+// The coach puts one frame on the air at ladder step `step`
+static void coachSend(const uint8_t* bytes, size_t len, uint8_t step, int tag) {
+  const LinkStep& st  = LINK_LADDER[step];
+  uint64_t        now = sim::clockUs();
+  uint32_t        toa = timeOnAirUs(linkModem(*cur.fam->link, step), (uint8_t)len);
+
+  if (tag >= 0) { cur.callAirUs += toa; cur.callsAtSf[st.sf]++; }
+  else          { cur.linkAirUs += toa; }
+
+  for (int n = 0; n < cur.fam->count; n++) {
+    if (cut(n, now, tag < 0)) continue;
+    double snr = channelSnr(n, now) + (st.powerDbm - LINK_FULL_POWER_DBM);
+    if (!survives(snr, st.sf)) continue;
+    Delivery d;
+    d.atUs = now + toa;
+    d.node = n;
+    d.sf   = st.sf;
+    memcpy(d.bytes, bytes, len);
+    d.len  = (uint8_t)len;
+    d.snr  = (float)snr;
+    d.tag  = tag;
+    cur.air.push_back(d);
+  }
+  cur.coachBusyUs = now + toa;
+}
+
+// A receiver's report, from inside its radio.transmit()
+static void onTransmit(const SX1262& radio, const uint8_t* data, size_t len) {
+  int n = 0;
+  while (n < cur.fam->count && cur.fam->nodes[n].radio != &radio) n++;
+  if (n == cur.fam->count) return;
+
+  uint64_t  now = sim::clockUs();
+  LoRaModem m   = { radio.sf, cur.fam->link->modem.bwHz, radio.cr, radio.preamble, true, false };
+  uint32_t  toa = timeOnAirUs(m, (uint8_t)len);
+  cur.upAirUs += toa;
+
+  if (cut(n, now, true) || now < cur.coachBusyUs) return;
+  if (!survives(channelSnr(n, now), radio.sf)) return;
+  Delivery d;
+  d.atUs = now + toa;
+  d.node = -1;
+  d.sf   = radio.sf;
+  memcpy(d.bytes, data, len);
+  d.len  = (uint8_t)len;
+  d.snr  = 0;
+  d.tag  = -1;
+  cur.air.push_back(d);
+}
+
+template <int N>
+static void onRead(int tag, bool crcOk) {
+  if (tag >= 0 && crcOk) cur.read[N][tag] = true;
+}
+static void (*const ON_READ[MAX_NODES])(int, bool) = { onRead<0>, onRead<1>, onRead<2> };
+
+// Everything due: land packets, then let the coach transmit if it is free
+static void tick() {
+  uint64_t now = sim::clockUs();
+  for (size_t i = 0; i < cur.air.size(); ) {
+    Delivery d = cur.air[i];
+    if (d.atUs > now) { i++; continue; }
+    cur.air[i] = cur.air.back();
+    cur.air.pop_back();
+    if (d.node < 0) {
+      // Listening on the report's SF, not transmitting
+      if (cur.coach && d.sf == cur.coach->current().sf && now >= cur.coachBusyUs) {
+        cur.coach->onReport(LinkReportView(d.bytes, d.len), nowMs());
+      }
+    } else {
+      SX1262* radio = cur.fam->nodes[d.node].radio;
+      if (radio->sf == d.sf) {
+        radio->injectPacket(d.bytes, d.len, (float)(-120.0 + d.snr), d.snr, true, d.tag);
+      }
+    }
+  }
+
+  if (now < cur.coachBusyUs || (cur.coach && cur.coach->quiet(nowMs()))) return;
+  uint8_t step = cur.coach ? cur.coach->step() : cur.fam->link->homeStep;
+  if (cur.callsSent < CALLS && now >= cur.nextCallUs) {
+    int c = cur.callsSent++;
+    if (cur.fam->signalFrames) {
+      SignalFrame f = encodeSignal(SIGNAL_PITCH, (uint8_t)(c % PITCH_COUNT),
+                                   (uint8_t)(1 + c % ZONE_MAX), 0, 0, (uint16_t)c);
+      coachSend(f.bytes, SIGNAL_LENGTH, step, c);
+    } else {
+      CallFrame f = encodeCall(ADDR_CATCHER, (uint8_t)(CMD_FB_IN + c % 8), (uint8_t)c);
+      coachSend(f.bytes, CALL_LENGTH, step, c);
+    }
+    cur.nextCallUs += ((uint64_t)CALL_GAP_MIN_MS + rng() % (CALL_GAP_MAX_MS - CALL_GAP_MIN_MS + 1)) * 1000;
+    return;
+  }
+  LinkCommandFrame f;
+  uint8_t at;
+  if (cur.coach && cur.coach->poll(nowMs(), f, at)) coachSend(f.bytes, LINK_COMMAND_LENGTH, at, -1);
+}
+
+// Time any receiver spends on another SF than the coach's
+static void trackStranded() {
+  uint64_t now = sim::clockUs();
+  uint8_t  sf  = LINK_LADDER[cur.coach ? cur.coach->step() : cur.fam->link->homeStep].sf;
+  for (int n = 0; n < cur.fam->count; n++) {
+    if (cur.fam->nodes[n].radio->sf != sf) {
+      if (cur.offSinceUs[n] == 0) cur.offSinceUs[n] = now;
+      uint64_t off = now - cur.offSinceUs[n];
+      if (off > cur.strandedMaxUs) cur.strandedMaxUs = off;
+    } else {
+      cur.offSinceUs[n] = 0;
+    }
+  }
+}
+
+struct Result {
+  double   worstPct;
+  double   sfPct[13];
+  double   airMs, upMs;
+  uint32_t changes, failures, fallbacks;
+  double   strandedS;
+};
+
+static Result run(const Family& fam, const Scenario& sc, bool adaptive, bool powerSave) {
+  LinkAdapter coach(*fam.link, powerSave);
+
+  cur.sc = &sc;
+  cur.fam = &fam;
+  cur.adaptive = adaptive;
+  cur.coach = adaptive ? &coach : NULL;
+  cur.base = sim::clockUs();
+  cur.coachBusyUs = 0;
+  cur.nextCallUs = cur.base + 5000000;     // settle first
+  cur.callsSent = 0;
+  cur.air.clear();
+  cur.callAirUs = cur.linkAirUs = cur.upAirUs = 0;
+  cur.strandedMaxUs = 0;
+  memset(cur.callsAtSf, 0, sizeof(cur.callsAtSf));
+
+  // Followers are at home: every run ends with a silence past the fallback
+  uint32_t fallbacks0[MAX_NODES];
+  for (int n = 0; n < fam.count; n++) {
+    const Node& node = fam.nodes[n];
+    fallbacks0[n] = node.link->fallbacks();
+    node.radio->onRead = ON_READ[n];
+    node.radio->onTransmit = onTransmit;
+    cur.read[n].assign(CALLS, false);
+    cur.fade[n] = 0;
+    cur.fadeUs[n] = cur.base;
+    cur.offSinceUs[n] = 0;
+  }
+  sim::delayHook() = tick;
+
+  uint64_t endUs = 0;
+  while (cur.callsSent < CALLS || sim::clockUs() < endUs) {
+    if (cur.callsSent == CALLS && endUs == 0) endUs = sim::clockUs() + 10000000;
+    tick();
+    for (int n = 0; n < fam.count; n++) fam.nodes[n].loop();
+    trackStranded();
+  }
+
+  sim::delayHook() = NULL;
+  Result r;
+  memset(&r, 0, sizeof(r));
+  r.worstPct = 100.0;
+  for (int n = 0; n < fam.count; n++) {
+    const Node& node = fam.nodes[n];
+    node.radio->onRead = NULL;
+    node.radio->onTransmit = NULL;
+    int got = 0;
+    for (int c = 0; c < CALLS; c++) got += cur.read[n][c];
+    double pct = 100.0 * got / CALLS;
+    if (pct < r.worstPct) r.worstPct = pct;
+    r.fallbacks += node.link->fallbacks() - fallbacks0[n];
+  }
+  for (int sf = 7; sf <= 12; sf++) r.sfPct[sf] = 100.0 * cur.callsAtSf[sf] / CALLS;
+  r.airMs     = (cur.callAirUs + cur.linkAirUs) / 1000.0 / CALLS;
+  r.upMs      = cur.upAirUs / 1000.0 / CALLS;
+  r.changes   = coach.changes();
+  r.failures  = coach.failures();
+  r.strandedS = cur.strandedMaxUs / 1e6;
+  cur.coach = NULL;
+
+  // Back to home for the next run: let every follower fall back
+  sim::advanceMs(LINK_FALLBACK_MS + 1000);
+  for (int n = 0; n < fam.count; n++) fam.nodes[n].loop();
+  return r;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+int main(int argc, char** argv) {
+  const char* only = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--verbose") == 0) sim::serialEcho() = true;
+    else only = argv[i];
+  }
+
+  for (int f = 0; f < FAMILY_COUNT; f++)
+    for (int n = 0; n < FAMILIES[f].count; n++) FAMILIES[f].nodes[n].setup();
+
+  printf("PitchComm link sim — %d calls per run, %u-%u s apart, one copy each\n",
+         CALLS, (unsigned)(CALL_GAP_MIN_MS / 1000), (unsigned)(CALL_GAP_MAX_MS / 1000));
+  printf("target margin %d dB, poll every %u-%u s, fallback %u s, join beacon %u s\n\n",
+         LINK_MARGIN_Q4 / 4, (unsigned)(LINK_BEACON_MS / 1000),
+         (unsigned)(LINK_BEACON_MAX_MS / 1000),
+         (unsigned)(LINK_FALLBACK_MS / 1000), (unsigned)(LINK_JOIN_MS / 1000));
+  printf("%-9s %-6s %-5s %7s %5s %5s %5s %5s %7s %6s %6s %6s %6s %8s\n",
+         "scenario", "family", "mode", "calls", "SF10", "SF9", "SF8", "SF7",
+         "air ms", "up ms", "steps", "failed", "fallbk", "stranded");
+  printf("%-9s %-6s %-5s %7s %5s %5s %5s %5s %7s %6s %6s %6s %6s %8s\n",
+         "", "", "", "%", "%", "%", "%", "%", "/call", "/call", "", "", "", "max s");
+
+  static const char* const MODE_NAMES[] = { "fixed", "adr", "save" };
+  const double strandBoundS = (LINK_FALLBACK_MS + LINK_JOIN_MS) / 1000.0;
+  int failures = 0;
+  for (int si = 0; si < SCENARIO_COUNT; si++) {
+    const Scenario& sc = SCENARIOS[si];
+    if (only && strcmp(only, sc.name) != 0) continue;
+
+    for (int f = 0; f < FAMILY_COUNT; f++) {
+      for (int mode = 0; mode < 3; mode++) {
+        rngState = 0x9E3779B97F4A7C15ULL + si * 16 + f;   // same calls and fades per mode
+        Result r = run(FAMILIES[f], sc, mode > 0, mode == 2);
+
+        bool bad = r.strandedS > strandBoundS + 1.0;
+        if (mode == 1 && f == 0 && strcmp(sc.name, "dugout") == 0 && r.sfPct[7] < 50.0) bad = true;
+        if (bad) failures++;
+        printf("%-9s %-6s %-5s %7.1f %5.0f %5.0f %5.0f %5.0f %7.1f %6.1f %6u %6u %6u %8.1f%s\n",
+               (f == 0 && mode == 0) ? sc.name : "", mode == 0 ? FAMILIES[f].name : "",
+               MODE_NAMES[mode], r.worstPct,
+               r.sfPct[10], r.sfPct[9], r.sfPct[8], r.sfPct[7], r.airMs, r.upMs,
+               (unsigned)r.changes, (unsigned)r.failures, (unsigned)r.fallbacks,
+               r.strandedS, bad ? "  FAIL" : "");
+      }
+    }
+  }
+
+  printf("\n%s\n", failures ? "FAIL" : "OK");
+  return failures ? 1 : 0;
+}
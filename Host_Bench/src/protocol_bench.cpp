@@ -0,0 +1,210 @@
+/*
+ * ============================================================================
+ * PROTOCOL BENCH — parse/validate throughput + round-trip checks
+ * ============================================================================
+ * Runs the PitchCommProtocol.h decoders over a large buffer of mixed radio
+ * packets (valid, corrupted, foreign) and reports ns/packet. The old
+ * receiver path — memcpy into a PitchSignal struct, byte-indexed
+ * validatePacket() — is timed alongside for comparison.
+ *
+ * Exits non-zero if any encode/decode round trip or corruption check fails.
+ * ============================================================================
+ */
+
+#include <PitchCommProtocol.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace pitchcomm;
+
+// ============================================================================
+// LEGACY REFERENCE — what the receivers did before the shared library
+// ============================================================================
+typedef struct {
+  uint8_t type;
+  uint8_t pitch;
+  uint8_t zone;
+  uint8_t pickoff;
+  uint8_t thirdSign;
+  uint16_t number;
+} LegacyPitchSignal;
+
+static bool legacyValidate(const uint8_t* pkt, size_t len) {
+  if (len != 6)            return false;
+  if (pkt[0] != 0xCC)      return false;
+  if (pkt[1] != 0x01)      return false;
+  if (pkt[2] != 0x01)      return false;
+  uint8_t chk = 0;
+  for (int i = 0; i < 5; i++) chk ^= pkt[i];
+  return pkt[5] == chk;
+}
+
+// ============================================================================
+// TEST CORPUS
+// ============================================================================
+struct Packet {
+  uint8_t bytes[MAX_PACKET_LENGTH];
+  size_t  len;
+};
+
+static uint32_t rngState = 0x12345678;
+static uint32_t rng() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+static std::vector<Packet> buildCorpus(size_t count) {
+  std::vector<Packet> corpus(count);
+  for (size_t i = 0; i < count; i++) {
+    Packet& p = corpus[i];
+    uint32_t r = rng();
+    if ((r & 3) == 0) {
+      SignalFrame f = encodeSignal(r & 1 ? SIGNAL_PITCH : SIGNAL_RESET,
+                                   (r >> 8) % PITCH_COUNT, (r >> 12) % 10,
+                                   (r >> 16) & 3, (r >> 18) % 5, (uint16_t)(r >> 16));
+      memcpy(p.bytes, f.bytes, SIGNAL_LENGTH);
+      p.len = SIGNAL_LENGTH;
+    } else {
+      CallFrame f = encodeCall(ADDR_CATCHER, (uint8_t)(r >> 8), (uint8_t)(r >> 16));
+      memcpy(p.bytes, f.bytes, CALL_LENGTH);
+      p.len = CALL_LENGTH;
+      if ((r & 0xF0) == 0) p.bytes[rng() % CALL_LENGTH] ^= 0x10;  // corrupted
+    }
+  }
+  return corpus;
+}
+
+// ============================================================================
+// CORRECTNESS
+// ============================================================================
+static int failures = 0;
+
+#define CHECK(cond) do { \
+  if (!(cond)) { printf("FAIL %s:%d  %s\n", __FILE__, __LINE__, #cond); failures++; } \
+} while (0)
+
+static void checkRoundTrips() {
+  for (uint8_t type = 0; type <= SIGNAL_RESET; type++)
+  for (uint8_t pitch = 0; pitch <= PITCH_COUNT; pitch++)
+  for (uint8_t zone = 0; zone <= ZONE_MAX; zone++)
+  for (uint8_t pk = 0; pk <= PICKOFF_MAX; pk++)
+  for (uint8_t third = 0; third <= THIRD_MAX; third++) {
+    uint8_t p = pitch == PITCH_COUNT ? PITCH_NONE : pitch;
+    uint16_t number = (uint16_t)(rng() & 0xFFFF);
+    SignalFrame f = encodeSignal(type, p, zone, pk, third, number);
+    SignalView v(f.bytes, SIGNAL_LENGTH);
+    CHECK(v.valid());
+    CHECK(v.type() == type && v.pitch() == p && v.zone() == zone);
+    CHECK(v.pickoff() == pk && v.thirdSign() == third && v.number() == number);
+    CHECK(v.hasPitch() == (p < PITCH_COUNT));
+
+    // Must agree with the struct the transmitter actually dumps on air
+    LegacyPitchSignal ref = { type, p, zone, pk, third, number };
+    if (sizeof(ref) == SIGNAL_LENGTH) {
+      LegacyPitchSignal got;
+      memcpy(&got, f.bytes, sizeof(got));
+      CHECK(got.number == ref.number && got.thirdSign == ref.thirdSign);
+    }
+  }
+
+  for (int cmd = 0; cmd < 256; cmd++) {
+    for (int seq = 0; seq < 256; seq++) {
+      CallFrame f = encodeCall(ADDR_CATCHER, (uint8_t)cmd, (uint8_t)seq);
+      CallView v(f.bytes, CALL_LENGTH);
+      CHECK(v.valid() && v.cmd() == cmd && v.seq() == seq);
+      CHECK(v.valid() == legacyValidate(f.bytes, CALL_LENGTH));
+
+      // Any single-byte error must be rejected by the XOR checksum
+      uint8_t bad[CALL_LENGTH];
+      memcpy(bad, f.bytes, CALL_LENGTH);
+      bad[(cmd + seq) % CALL_LENGTH] ^= (uint8_t)(1 + (seq % 255));
+      CHECK(!CallView(bad, CALL_LENGTH).valid());
+    }
+    CHECK(!CallView(encodeCall(0x02, (uint8_t)cmd, 0).bytes, CALL_LENGTH).valid());
+  }
+
+  // Addressing: each device against unicast, groups, masks and broadcast
+  for (uint8_t id = 1; id <= MASK_DEVICES; id++) {
+    CallAddress me = { id, (uint32_t)1 << (id % ADDR_GROUPS) };
+    CHECK(CallView(encodeCall(id, CMD_CURVE, 1).bytes, CALL_LENGTH).valid(me));
+    CHECK(!CallView(encodeCall((uint8_t)(id + 1), CMD_CURVE, 1).bytes, CALL_LENGTH).valid(me));
+    CHECK(CallView(encodeCall(ADDR_ALL, CMD_CURVE, 1).bytes, CALL_LENGTH).valid(me));
+    for (uint8_t g = 0; g < ADDR_GROUPS; g++) {
+      CHECK(CallView(encodeCall(callGroup(g), CMD_CURVE, 1).bytes, CALL_LENGTH).valid(me)
+            == (g == id % ADDR_GROUPS));
+    }
+
+    for (int t = 0; t < 64; t++) {
+      uint32_t devices = rng() & 0xFFFFFF;
+      CallMaskFrame f = encodeMaskCall(devices, (uint8_t)t, id, t & 1);
+      CallView v(f.bytes, CALL_MASK_LENGTH);
+      CHECK(v.wellFormed() && v.mask() == devices);
+      CHECK(v.cmd() == t && v.seq() == id && v.ackRequested() == (bool)(t & 1));
+      CHECK(v.valid(me) == (bool)((devices >> (id - 1)) & 1));
+
+      uint8_t bad[CALL_MASK_LENGTH];
+      memcpy(bad, f.bytes, CALL_MASK_LENGTH);
+      bad[rng() % CALL_MASK_LENGTH] ^= (uint8_t)(1 + rng() % 255);
+      CHECK(!CallView(bad, CALL_MASK_LENGTH).wellFormed());
+      CHECK(!CallView(f.bytes, CALL_LENGTH).wellFormed());   // truncated
+    }
+  }
+}
+
+// ============================================================================
+// THROUGHPUT
+// ============================================================================
+typedef std::chrono::steady_clock Clock;
+
+static volatile uint32_t sink;
+
+template <typename Fn>
+static double timeNsPerPacket(const std::vector<Packet>& corpus, int rounds, Fn fn) {
+  uint32_t acc = 0;
+  Clock::time_point start = Clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < corpus.size(); i++) acc += fn(corpus[i]);
+  }
+  Clock::time_point end = Clock::now();
+  sink = acc;
+  double ns = std::chrono::duration<double, std::nano>(end - start).count();
+  return ns / ((double)corpus.size() * rounds);
+}
+
+int main() {
+  printf("=== PitchComm protocol bench ===\n\n");
+
+  checkRoundTrips();
+  printf("Round-trip checks: %s\n\n", failures == 0 ? "PASS" : "FAIL");
+
+  const size_t count  = 1 << 16;
+  const int    rounds = 64;
+  std::vector<Packet> corpus = buildCorpus(count);
+
+  double legacy = timeNsPerPacket(corpus, rounds, [](const Packet& p) -> uint32_t {
+    if (p.len == 6) return legacyValidate(p.bytes, p.len) ? p.bytes[3] : 0;
+    LegacyPitchSignal s;
+    memcpy(&s, p.bytes, sizeof(s));
+    return s.pitch + s.zone + s.number;
+  });
+
+  double view = timeNsPerPacket(corpus, rounds, [](const Packet& p) -> uint32_t {
+    CallView call(p.bytes, p.len);
+    if (call.valid()) return call.cmd();
+    SignalView sig(p.bytes, p.len);
+    return sig.valid() ? sig.pitch() + sig.zone() + sig.number() : 0;
+  });
+
+  printf("%-34s %10s\n", "Decoder", "ns/packet");
+  printf("%-34s %10.2f\n", "legacy memcpy + validatePacket()", legacy);
+  printf("%-34s %10.2f\n", "SignalView / CallView (in place)", view);
+  printf("\n%zu packets x %d rounds\n", count, rounds);
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,325 @@
+/*
+ * ============================================================================
+ * SCENE BENCH — render cost and golden images for every receiver layout
+ * ============================================================================
+ * Builds the scenes each receiver shows (its own buildScene() / callScene()
+ * over pitches, zones, PK / 3rd signs, resets and the call table) and
+ * renders them through that receiver's SceneLayout twice:
+ *
+ *   panel  the firmware's own SceneBackend on the sim/ display fake (the
+ *          code path the receiver runs, minus the bus)
+ *   fb     SceneBackend<FrameBuffer>: headless 1 bpp (RGB565 for the
+ *          T-Watch), built-in 5x7 font scaled to roughly the panel's fonts
+ *
+ * Each framebuffer render is hashed and checked against golden/scenes.txt,
+ * so a layout or scene change shows up as the list of scenes it moved.
+ *
+ *   scene_bench [--golden FILE] [--update] [--dump DIR]
+ *
+ *   --update   rewrite the golden file from this run
+ *   --dump     write every frame as DIR/<receiver>-<n>.pbm (.ppm for RGB)
+ *
+ * The host CPU is not an ESP32 or nRF52; compare the us columns against
+ * each other, not as on-target numbers. Exits 1 if a golden hash differs
+ * or is missing.
+ * ============================================================================
+ */
+
+#include <SimFirmware.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace pitchcomm;
+
+static const int REPEATS = 200;
+
+// ============================================================================
+// SCENES
+// ============================================================================
+typedef void (*SignalBuilder)(const SignalView&, Scene&);
+
+static void addSignal(std::vector<Scene>& out, SignalBuilder build, uint8_t type, uint8_t pitch,
+                      uint8_t zone, uint8_t pickoff, uint8_t third) {
+  SignalFrame f = encodeSignal(type, pitch, zone, pickoff, third, 42);
+  Scene s;
+  build(SignalView(f.bytes, SIGNAL_LENGTH), s);
+  out.push_back(s);
+}
+
+// Every pitch alone and with each zone, PK and 3rd badge; the signs alone;
+// reset
+static std::vector<Scene> signalScenes(SignalBuilder build) {
+  std::vector<Scene> out;
+  for (uint8_t p = 0; p < PITCH_COUNT; p++) {
+    for (uint8_t z = 0; z <= ZONE_MAX; z++) addSignal(out, build, SIGNAL_PITCH, p, z, 0, 0);
+    for (uint8_t k = 1; k <= PICKOFF_MAX; k++) addSignal(out, build, SIGNAL_PITCH, p, 5, k, 0);
+    for (uint8_t t = 1; t <= THIRD_MAX; t++) addSignal(out, build, SIGNAL_PITCH, p, 5, 0, t);
+    addSignal(out, build, SIGNAL_PITCH, p, 9, PICKOFF_MAX, THIRD_MAX);
+  }
+  for (uint8_t k = 1; k <= PICKOFF_MAX; k++) addSignal(out, build, SIGNAL_PITCH, PITCH_NONE, 0, k, 0);
+  for (uint8_t t = 1; t <= THIRD_MAX; t++) addSignal(out, build, SIGNAL_PITCH, PITCH_NONE, 0, 0, t);
+  addSignal(out, build, SIGNAL_RESET, PITCH_NONE, 0, 0, 0);
+  return out;
+}
+
+static const uint8_t CALL_CMDS[] = {
+  CMD_FB_IN, CMD_FB_OUT, CMD_CURVE, CMD_CHANGE, CMD_SLIDER, CMD_CUTTER,
+  CMD_SPLIT, CMD_SCREW, CMD_PICK1, CMD_PICK2, CMD_PITCHOUT, CMD_TIMEOUT,
+};
+
+// callTable plus the unknown-command screen processPacket() shows
+static std::vector<Scene> hudScenes() {
+  std::vector<Scene> out;
+  Scene s;
+  for (uint8_t i = 0; i < hud::CALL_COUNT; i++) {
+    callScene(hud::callTable[i].line1, hud::callTable[i].line2, hud::callTable[i].invert, s);
+    out.push_back(s);
+  }
+  callScene("0x7F", "???", true, s);
+  out.push_back(s);
+  return out;
+}
+
+static std::vector<Scene> armbandScenes() {
+  std::vector<Scene> out;
+  Scene s;
+  armband::lastRSSI = -87;
+  for (size_t i = 0; i < sizeof(CALL_CMDS); i++) {
+    armband::buildScene(armband::decodePitch(CALL_CMDS[i]), s);
+    out.push_back(s);
+  }
+  armband::buildScene(armband::decodePitch(0x7F), s);
+  out.push_back(s);
+  return out;
+}
+
+static std::string sceneKey(const Scene& s) {
+  std::string k = s.primary.text;
+  if (!s.detail.empty()) k += std::string("/") + s.detail.text;
+  for (uint8_t i = 0; i < SCENE_BADGE_MAX; i++) {
+    if (!s.badge[i].empty()) k += std::string(" ") + s.badge[i].text;
+  }
+  if (s.urgent) k += " (inverted)";
+  return k;
+}
+
+// ============================================================================
+// RENDER
+// ============================================================================
+struct Row {
+  std::string key;
+  uint32_t    hash;
+};
+
+struct Report {
+  double           panelMeanUs, panelMaxUs;
+  double           fbMeanUs, fbMaxUs;
+  size_t           frameBytes;
+  std::vector<Row> rows;
+};
+
+template <class Backend>
+static void timeRenders(Backend& b, const std::vector<Scene>& scenes, const SceneLayout& layout,
+                        double& meanUs, double& maxUs) {
+  double total = 0, worst = 0;
+  for (size_t i = 0; i < scenes.size(); i++) {
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEATS; r++) renderScene(b, scenes[i], layout);
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    double us = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / 1000.0 / REPEATS;
+    total += us;
+    if (us > worst) worst = us;
+  }
+  meanUs = total / scenes.size();
+  maxUs  = worst;
+}
+
+template <int16_t W, int16_t H, uint8_t BPP>
+static void dump(const FrameBuffer<W, H, BPP>& fb, const std::string& path) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return;
+  if (BPP == 1) {
+    fprintf(f, "P4\n%d %d\n", W, H);
+    fwrite(fb.data(), 1, fb.BYTES, f);
+  } else {
+    fprintf(f, "P6\n%d %d\n255\n", W, H);
+    for (int16_t y = 0; y < H; y++)
+      for (int16_t x = 0; x < W; x++) {
+        uint16_t c = fb.get(x, y);
+        uint8_t rgb[3] = { (uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)(c << 3) };
+        fwrite(rgb, 1, 3, f);
+      }
+  }
+  fclose(f);
+}
+
+template <class Panel, int16_t W, int16_t H, uint8_t BPP>
+static Report bench(const char* id, const std::vector<Scene>& scenes, const SceneLayout& layout,
+                    Panel& panel, FrameBuffer<W, H, BPP>& fb, const uint8_t* scales, bool middle,
+                    const std::string& dumpDir) {
+  Report r;
+  SceneBackend<FrameBuffer<W, H, BPP> > headless(fb, scales, middle);
+  timeRenders(panel, scenes, layout, r.panelMeanUs, r.panelMaxUs);
+  timeRenders(headless, scenes, layout, r.fbMeanUs, r.fbMaxUs);
+  r.frameBytes = fb.BYTES;
+
+  for (size_t i = 0; i < scenes.size(); i++) {
+    renderScene(headless, scenes[i], layout);
+    Row row = { sceneKey(scenes[i]), fb.hash() };
+    r.rows.push_back(row);
+    if (!dumpDir.empty()) {
+      char name[64];
+      snprintf(name, sizeof(name), "/%s-%03u.%s", id, (unsigned)i, BPP == 1 ? "pbm" : "ppm");
+      dump(fb, dumpDir + name);
+    }
+  }
+  return r;
+}
+
+// ============================================================================
+// RECEIVERS
+// ============================================================================
+// Framebuffer font scales per layout font index, nearest to the panel fonts
+static const uint8_t HELTEC_SCALES[]  = { 3, 2, 1, 1 };      // helvB24 helvB18 6x10 5x7
+static const uint8_t STICK_SCALES[]   = { 2, 2, 2, 1 };      // helvB18 helvB14 helvB12 4x6
+static const uint8_t HUD_SCALES[]     = { 2, 1 };            // helvB14 helvB10
+static const uint8_t ARMBAND_SCALES[] = { 4, 2, 1 };         // Sans24 Sans12 6x8
+
+static FrameBuffer<128, 64, 1>   heltecFb;
+static FrameBuffer<64, 32, 1>    stickFb;
+static FrameBuffer<240, 240, 16> twatchFb;
+static FrameBuffer<64, 32, 1>    hudFb;
+static FrameBuffer<250, 122, 1>  armbandFb;
+
+struct Entry {
+  const char* id;
+  const char* name;
+  Report      report;
+};
+
+// ============================================================================
+// GOLDEN FILE — "<receiver> <hash> <scene>" per line
+// ============================================================================
+static bool loadGolden(const std::string& path, std::map<std::string, uint32_t>& golden) {
+  std::ifstream in(path.c_str());
+  if (!in) return false;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream ss(line);
+    std::string id, hash, key;
+    ss >> id >> hash;
+    std::getline(ss >> std::ws, key);
+    golden[id + " " + key] = (uint32_t)strtoul(hash.c_str(), NULL, 16);
+  }
+  return true;
+}
+
+static bool saveGolden(const std::string& path, const std::vector<Entry>& entries) {
+  std::ofstream out(path.c_str());
+  out << "# scene_bench golden images: receiver, FNV-1a of the FrameBuffer, scene\n"
+         "# regenerate with: scene_bench --update\n";
+  for (size_t e = 0; e < entries.size(); e++) {
+    const std::vector<Row>& rows = entries[e].report.rows;
+    for (size_t i = 0; i < rows.size(); i++) {
+      char hash[16];
+      snprintf(hash, sizeof(hash), "%08x", rows[i].hash);
+      out << entries[e].id << " " << hash << " " << rows[i].key << "\n";
+    }
+  }
+  return (bool)out;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+static void usage() {
+  printf("usage: scene_bench [--golden FILE] [--update] [--dump DIR]\n");
+}
+
+int main(int argc, char** argv) {
+  std::string goldenPath = "golden/scenes.txt", dumpDir;
+  bool update = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc)    goldenPath = argv[++i];
+    else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) dumpDir = argv[++i];
+    else if (strcmp(argv[i], "--update") == 0)               update = true;
+    else { usage(); return 2; }
+  }
+
+  printf("PitchComm scene bench — each scene rendered %d times per backend\n\n", REPEATS);
+
+  SceneBackend<TFT_eSPI> twatchPanel(twatch::tft, twatch::sceneSizes, TFT_BLACK);
+
+  std::vector<Entry> entries;
+  Entry heltecE  = { "heltec",  "Heltec V3 OLED",
+    bench("heltec", signalScenes(heltec::buildScene), heltec::signalLayout, heltec::panel,
+          heltecFb, HELTEC_SCALES, false, dumpDir) };
+  Entry stickE   = { "stick",   "Heltec Stick",
+    bench("stick", signalScenes(stick::buildScene), stick::signalLayout, stick::panel,
+          stickFb, STICK_SCALES, false, dumpDir) };
+  Entry twatchE  = { "twatch",  "T-Watch S3",
+    bench("twatch", signalScenes(twatch::buildScene), twatch::signalLayout, twatchPanel,
+          twatchFb, twatch::sceneSizes, true, dumpDir) };
+  Entry hudE     = { "hud",     "XIAO HUD",
+    bench("hud", hudScenes(), hud::callLayout, hud::panel, hudFb, HUD_SCALES, false, dumpDir) };
+  Entry armbandE = { "armband", "XIAO Armband",
+    bench("armband", armbandScenes(), armband::callLayout, armband::panel,
+          armbandFb, ARMBAND_SCALES, false, dumpDir) };
+  entries.push_back(heltecE);
+  entries.push_back(stickE);
+  entries.push_back(twatchE);
+  entries.push_back(hudE);
+  entries.push_back(armbandE);
+
+  std::map<std::string, uint32_t> golden;
+  bool haveGolden = !update && loadGolden(goldenPath, golden);
+
+  printf("%-15s %6s %10s %10s %10s %10s %8s  %s\n",
+         "receiver", "scenes", "panel mean", "panel max", "fb mean", "fb max", "frame B", "golden");
+  printf("%-15s %6s %10s %10s %10s %10s %8s\n", "", "", "(us)", "(us)", "(us)", "(us)", "");
+
+  int failures = 0;
+  std::vector<std::string> changed;
+  for (size_t e = 0; e < entries.size(); e++) {
+    const Report& r = entries[e].report;
+    int bad = 0;
+    for (size_t i = 0; i < r.rows.size() && haveGolden; i++) {
+      std::map<std::string, uint32_t>::const_iterator g =
+          golden.find(std::string(entries[e].id) + " " + r.rows[i].key);
+      if (g == golden.end() || g->second != r.rows[i].hash) {
+        bad++;
+        changed.push_back(std::string(entries[e].id) + " " + r.rows[i].key +
+                          (g == golden.end() ? " (new)" : ""));
+      }
+    }
+    char status[24];
+    if (update)           snprintf(status, sizeof(status), "updated");
+    else if (!haveGolden) snprintf(status, sizeof(status), "missing");
+    else if (bad)         snprintf(status, sizeof(status), "%d changed", bad);
+    else                  snprintf(status, sizeof(status), "ok");
+    if (!update && (!haveGolden || bad)) failures++;
+
+    printf("%-15s %6lu %10.2f %10.2f %10.2f %10.2f %8lu  %s\n", entries[e].name,
+           (unsigned long)r.rows.size(), r.panelMeanUs, r.panelMaxUs, r.fbMeanUs, r.fbMaxUs,
+           (unsigned long)r.frameBytes, status);
+  }
+
+  for (size_t i = 0; i < changed.size(); i++) printf("  changed: %s\n", changed[i].c_str());
+  if (!update && !haveGolden) printf("\nno golden file at %s (run with --update)\n", goldenPath.c_str());
+  if (update && !saveGolden(goldenPath, entries)) {
+    printf("\ncannot write %s\n", goldenPath.c_str());
+    return 1;
+  }
+  if (!dumpDir.empty()) printf("\nframes written to %s/\n", dumpDir.c_str());
+
+  printf("\n%s\n", failures ? "FAIL" : "OK");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,251 @@
+/*
+ * ============================================================================
+ * SIM BENCH — receiver firmware on the host, fake radio and displays
+ * ============================================================================
+ * Builds all five receiver sketches unmodified against the fakes in sim/
+ * (see sim/SimFirmware.h), runs each setup(), then feeds every receiver
+ * the same stream of calls through its fake SX1262, one call per
+ * CALL_SPACING_MS of virtual time.
+ *
+ * For the loop() iteration that handles each packet it reports:
+ *   cpu us     wall-clock time on this host (mean / p99 / max)
+ *   bus B      display + I2C bytes the firmware pushed for the call
+ *   blocked ms virtual time loop() spent in delay()/BUSY
+ *   allocs     heap allocations (PitchCommHeapProbe.h; "-" unless built
+ *              with -DPITCHCOMM_HEAP_PROBE and the malloc wraps, as the
+ *              sim_bench env is)
+ *
+ * and per radio the deaf window: virtual time from RX done to the
+ * firmware's next startReceive() (mean / max).
+ *
+ * The host CPU is not an ESP32 or nRF52; use the cpu columns to compare
+ * render paths against each other, not as on-target numbers.
+ *
+ * Before the calls, each radio is checked against its factory profile
+ * (PitchCommRadio.h), and one ESP32 and one XIAO receiver are switched to
+ * Balanced and back with the "profile" serial command.
+ *
+ * Exits 1 if any receiver fails to render every call, or, in probe builds,
+ * allocates while handling one, or if a radio is off its profile.
+ * ============================================================================
+ */
+
+#include <SimFirmware.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace pitchcomm;
+
+static const int      CALLS           = 2000;
+static const uint32_t CALL_SPACING_MS = 1500;
+
+// ============================================================================
+// CALL STREAM
+// ============================================================================
+static SignalFrame signalFor(int i) {
+  if (i % 50 == 49) return encodeSignal(SIGNAL_RESET, PITCH_NONE, 0, 0, 0, (uint16_t)i);
+  if (i % 11 == 10) return encodeSignal(SIGNAL_PITCH, PITCH_NONE, 0, 0, 1 + i % 4, (uint16_t)i);
+  if (i % 7 == 6)   return encodeSignal(SIGNAL_PITCH, PITCH_NONE, 0, 1 + i % 3, 0, (uint16_t)i);
+  return encodeSignal(SIGNAL_PITCH, (uint8_t)(i % PITCH_COUNT), (uint8_t)(1 + i % ZONE_MAX),
+                      0, 0, (uint16_t)i);
+}
+
+static const uint8_t CALL_CMDS[] = {
+  CMD_FB_IN, CMD_FB_OUT, CMD_CURVE, CMD_CHANGE, CMD_SLIDER, CMD_CUTTER,
+  CMD_SPLIT, CMD_SCREW, CMD_PICK1, CMD_PICK2, CMD_PITCHOUT, CMD_TIMEOUT,
+};
+
+static CallFrame callFor(int i) {
+  return encodeCall(ADDR_CATCHER, CALL_CMDS[i % sizeof(CALL_CMDS)], (uint8_t)i);
+}
+
+// ============================================================================
+// RECEIVERS
+// ============================================================================
+struct Target {
+  const char*    name;
+  SX1262*        radio;
+  bool           callFrames;           // false = 8-byte signal frames
+  uint8_t        profile;              // factory RADIO_PROFILE
+  void         (*setup)();
+  void         (*loop)();
+  unsigned long (*displayBytes)();
+};
+
+static const Target TARGETS[] = {
+  { "Heltec V3 OLED", &heltec::radio, false, PROFILE_LONG_RANGE, heltec::setup, heltec::loop,
+    [] { return heltec::display.bytesSent; } },
+  { "Heltec Stick",   &stick::radio,  false, PROFILE_LONG_RANGE, stick::setup,  stick::loop,
+    [] { return stick::display.bytesSent; } },
+  { "T-Watch S3",     &twatch::radio, false, PROFILE_LONG_RANGE, twatch::setup, twatch::loop,
+    [] { return twatch::tft.spiBytes; } },
+  { "XIAO HUD",       &hud::radio,    true,  PROFILE_LOW_LATENCY, hud::setup,   hud::loop,
+    [] { return hud::display.bytesSent; } },
+  { "XIAO Armband",   &armband::radio, true, PROFILE_LOW_LATENCY, armband::setup, armband::loop,
+    [] { return armband::display.bytesSent; } },
+};
+static const int TARGET_COUNT = sizeof(TARGETS) / sizeof(TARGETS[0]);
+
+struct Result {
+  std::vector<double> cpuNs;
+  double busBytes;       // sum over calls
+  double blockedMs;      // sum over calls
+  double allocs;         // sum over calls
+  int    rendered;
+};
+
+static Result run(const Target& t) {
+  Result r;
+  r.busBytes = r.blockedMs = r.allocs = 0;
+  r.rendered = 0;
+  r.cpuNs.reserve(CALLS);
+
+  for (int i = 0; i < CALLS; i++) {
+    sim::advanceMs(CALL_SPACING_MS);
+
+    if (t.callFrames) {
+      CallFrame f = callFor(i);
+      t.radio->injectPacket(f.bytes, CALL_LENGTH, -70.0f, 8.0f);
+    } else {
+      SignalFrame f = signalFor(i);
+      t.radio->injectPacket(f.bytes, SIGNAL_LENGTH, -70.0f, 8.0f);
+    }
+
+    unsigned long bus0 = t.displayBytes() + Wire.bytesOnBus;
+    uint64_t      vt0  = sim::clockUs();
+    HeapProbe     heap;
+    std::chrono::steady_clock::time_point c0 = std::chrono::steady_clock::now();
+    t.loop();
+    std::chrono::steady_clock::time_point c1 = std::chrono::steady_clock::now();
+    r.allocs += heap.allocs();
+    unsigned long bus = t.displayBytes() + Wire.bytesOnBus - bus0;
+
+    r.cpuNs.push_back((double)std::chrono::duration_cast<std::chrono::nanoseconds>(c1 - c0).count());
+    r.busBytes  += bus;
+    r.blockedMs += (sim::clockUs() - vt0) / 1000.0;
+    if (bus > 0) r.rendered++;
+  }
+  return r;
+}
+
+// ============================================================================
+// RADIO PROFILES
+// ============================================================================
+static bool onProfile(const SX1262& radio, const RadioProfile& p) {
+  return radio.freq == p.freqMhz && radio.bw * 1000.0f == (float)p.modem.bwHz
+      && radio.sf == p.modem.sf && radio.cr == p.modem.cr && radio.preamble == p.modem.preamble
+      && (radio.crc != 0) == p.modem.crc && radio.implicit == p.modem.implicitHeader
+      && radio.ldro == p.ldro && radio.syncWord == p.syncWord && radio.power == p.powerDbm;
+}
+
+// "profile <name>" on a receiver's serial; true if it retuned and stored it
+template <typename Store>
+static bool switchProfile(const Target& t, Store& store, const char* name, uint8_t id) {
+  Serial.feed("profile ");
+  Serial.feed(name);
+  Serial.feed("\n");
+  t.loop();
+  return onProfile(*t.radio, radioProfile(id)) && t.radio->rxArmed
+      && store.load(PROFILE_COUNT) == id;
+}
+
+static int checkProfiles() {
+  int failures = 0;
+  printf("%-15s %-11s %s\n", "radio", "profile", "after setup()");
+  for (int t = 0; t < TARGET_COUNT; t++) {
+    const RadioProfile& p = radioProfile(TARGETS[t].profile);
+    bool ok = onProfile(*TARGETS[t].radio, p);
+    if (!ok) failures++;
+    printf("%-15s %-11s %s\n", TARGETS[t].name, p.name, ok ? "match" : "MISMATCH  FAIL");
+  }
+
+  const Target& esp = TARGETS[0];
+  const Target& xiao = TARGETS[3];
+  bool ok = switchProfile(esp, heltec::profileStore, "balanced", PROFILE_BALANCED)
+         && heltec::adr.family().modem.sf == 9
+         && switchProfile(esp, heltec::profileStore, "LongRange", PROFILE_LONG_RANGE)
+         && switchProfile(xiao, hud::profileStore, "1", PROFILE_BALANCED)
+         && hud::adr.family().modem.sf == 9 && hud::adr.current().sf == 9
+         && switchProfile(xiao, hud::profileStore, "lowlatency", PROFILE_LOW_LATENCY)
+         && hud::adr.atHome();
+  if (!ok) failures++;
+  printf("serial switch   %s and %s to Balanced and back: %s\n\n", esp.name, xiao.name,
+         ok ? "ok" : "FAIL");
+  return failures;
+}
+
+static double percentile(std::vector<double> v, double p) {
+  std::sort(v.begin(), v.end());
+  size_t i = (size_t)(p * (v.size() - 1) + 0.5);
+  return v[i];
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--verbose") == 0) sim::serialEcho() = true;
+  }
+
+  printf("PitchComm sim bench — %d calls per receiver, one per %u ms (virtual)\n\n",
+         CALLS, (unsigned)CALL_SPACING_MS);
+
+  for (int t = 0; t < TARGET_COUNT; t++) TARGETS[t].setup();
+
+  int failures = checkProfiles();
+
+  printf("%-15s %9s %9s %9s %10s %11s %7s %9s\n",
+         "receiver", "cpu mean", "cpu p99", "cpu max", "bus B", "blocked ms", "allocs", "rendered");
+  printf("%-15s %9s %9s %9s %10s %11s %7s %9s\n",
+         "", "(us)", "(us)", "(us)", "/call", "/call", "/call", "");
+
+  for (int t = 0; t < TARGET_COUNT; t++) {
+    Result r = run(TARGETS[t]);
+    double sum = 0;
+    for (size_t i = 0; i < r.cpuNs.size(); i++) sum += r.cpuNs[i];
+    bool ok = r.rendered == CALLS && r.allocs == 0;
+    if (!ok) failures++;
+    char allocs[16] = "-";
+    if (HEAP_PROBE_ENABLED) snprintf(allocs, sizeof(allocs), "%.2f", r.allocs / CALLS);
+    printf("%-15s %9.2f %9.2f %9.2f %10.0f %11.1f %7s %5d/%d%s\n",
+           TARGETS[t].name,
+           sum / r.cpuNs.size() / 1000.0,
+           percentile(r.cpuNs, 0.99) / 1000.0,
+           percentile(r.cpuNs, 1.0) / 1000.0,
+           r.busBytes / CALLS,
+           r.blockedMs / CALLS,
+           allocs,
+           r.rendered, CALLS, ok ? "" : "  FAIL");
+  }
+
+  printf("\n%-15s %8s %7s %12s %10s %10s\n",
+         "radio", "injected", "missed", "overwritten", "deaf mean", "deaf max");
+  for (int t = 0; t < TARGET_COUNT; t++) {
+    const SX1262* radio = TARGETS[t].radio;
+    printf("%-15s %8lu %7lu %12lu %8.1fms %8.1fms\n", TARGETS[t].name,
+           radio->injected, radio->missed, radio->overwritten,
+           radio->injected ? radio->deafUsTotal / 1000.0 / radio->injected : 0.0,
+           radio->deafUsMax / 1000.0);
+  }
+
+  // Armband waveforms, BUSY as the GxEPD2 fake models it: stock OTP partial
+  // vs. the FastLut213 RAM table (frames at 50 Hz)
+  armband::lutBench(10);
+  const pitchcomm::LatencyStats* waves[2] = {
+    &armband::display.epd2.standardStats(), &armband::display.epd2.fastStats()
+  };
+  const char* waveNames[2] = { "stock partial", "fast LUT" };
+  printf("\n%-15s %8s %8s %8s\n", "ePaper wave", "min ms", "mean ms", "max ms");
+  for (int w = 0; w < 2; w++) {
+    printf("%-15s %8.1f %8.1f %8.1f\n", waveNames[w], waves[w]->minUs() / 1000.0,
+           waves[w]->meanUs() / 1000.0, waves[w]->maxUs() / 1000.0);
+  }
+
+  printf("\n%s\n", failures ? "FAIL" : "OK");
+  return failures ? 1 : 0;
+}
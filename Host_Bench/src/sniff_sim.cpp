@@ -0,0 +1,238 @@
+/*
+ * ============================================================================
+ * SNIFF SIM — RX duty cycle on the HUD and armband: misses, latency, RX time
+ * ============================================================================
+ * Runs the unmodified XIAO HUD and armband sketches (sim/SimFirmware.h) with
+ * their SniffListener set to each coach preamble length in turn, 0 being
+ * today's continuous RX. The coach sends every call as COPIES copies, each
+ * with that preamble. Call start times are jittered to the microsecond, so
+ * calls land at every phase of the receiver's sleep / window cycle. The fake
+ * SX1262 hears a packet only if a whole window falls inside its preamble
+ * (sim/RadioLib.h).
+ *
+ * The "short" row shows receivers sniffing for a 64-symbol preamble while
+ * the coach still sends 8 symbols. That is why the mode is opt-in on both
+ * ends.
+ *
+ * Columns, per receiver:
+ *
+ *   copies %   coach frames the radio heard
+ *   calls %    calls the firmware read at least once
+ *   lat ms     call start to the end of the first copy read (mean / max)
+ *   listen %   time the radio was listening (fake SX1262), vs. the model
+ *
+ * Exits 1 if, with the coach preamble matching, a receiver misses a frame,
+ * or listens noticeably longer than the model (a path left RX continuous).
+ * ============================================================================
+ */
+
+#include <SimFirmware.h>
+#include <PitchCommSniff.h>
+#include <PitchCommAirtime.h>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace pitchcomm;
+
+static const int      CALLS       = 300;
+static const uint32_t GAP_MIN_MS  = 2000;
+static const uint32_t GAP_MAX_MS  = 6000;
+static const int      COPIES      = 3;
+static const uint32_t COPY_GAP_MS = 50;
+
+// ============================================================================
+// LEVELS
+// ============================================================================
+struct Level {
+  const char* name;
+  uint16_t    listen;           // receiver's RX_SNIFF_PREAMBLE, 0 = continuous
+  uint16_t    coach;            // preamble the coach sends
+};
+
+static const Level LEVELS[] = {
+  { "off",    0,   8 },
+  { "32",    32,  32 },
+  { "64",    64,  64 },
+  { "128",  128, 128 },
+  { "256",  256, 256 },
+  { "short", 64,   8 },
+};
+static const int LEVEL_COUNT = sizeof(LEVELS) / sizeof(LEVELS[0]);
+
+// ============================================================================
+// RANDOM
+// ============================================================================
+static uint64_t rngState;
+static uint64_t rng() {
+  rngState ^= rngState >> 12;
+  rngState ^= rngState << 25;
+  rngState ^= rngState >> 27;
+  return rngState * 0x2545F4914F6CDD1DULL;
+}
+
+// ============================================================================
+// RECEIVERS
+// ============================================================================
+struct Receiver {
+  const char*            name;
+  SX1262*                radio;
+  SniffListener<SX1262>* listener;
+  void                 (*loop)();
+};
+
+static const Receiver RECEIVERS[] = {
+  { "HUD",     &hud::radio,     &hud::listener,     hud::loop     },
+  { "Armband", &armband::radio, &armband::listener, armband::loop },
+};
+static const int RX_COUNT = sizeof(RECEIVERS) / sizeof(RECEIVERS[0]);
+
+// ============================================================================
+// RUN STATE — shared with the delay / radio hooks
+// ============================================================================
+struct Copy {
+  uint64_t endUs;
+  int      call;
+  uint8_t  bytes[CALL_LENGTH];
+};
+
+struct Run {
+  const Receiver*       rx;
+  std::vector<Copy>     copies;     // in end-time order
+  size_t                next;
+  std::vector<uint64_t> startUs, firstReadUs;
+  int                   heard;
+};
+static Run cur;
+
+static void onRead(int tag, bool crcOk) {
+  if (tag < 0 || !crcOk) return;
+  const Copy& c = cur.copies[tag];
+  if (cur.firstReadUs[c.call] == 0) cur.firstReadUs[c.call] = c.endUs;
+}
+
+// Land every copy that has finished by now
+static void tick() {
+  uint64_t now = sim::clockUs();
+  while (cur.next < cur.copies.size() && cur.copies[cur.next].endUs <= now) {
+    const Copy& c = cur.copies[cur.next];
+    if (cur.rx->radio->injectPacket(c.bytes, CALL_LENGTH, -80.0f, 8.0f, true, (int)cur.next)) {
+      cur.heard++;
+    }
+    cur.next++;
+  }
+}
+
+struct Result {
+  double copiesPct, callsPct, latMean, latMax, listenPct;
+};
+
+static Result run(const Receiver& rx, const Level& lv, uint64_t seed) {
+  rngState = seed;
+  cur.rx = &rx;
+  cur.copies.clear();
+  cur.next = 0;
+  cur.heard = 0;
+  cur.startUs.assign(CALLS, 0);
+  cur.firstReadUs.assign(CALLS, 0);
+
+  rx.radio->peerPreamble = lv.coach;
+  rx.listener->setPreamble(lv.listen);
+  rx.listener->startReceive();
+  rx.radio->onRead = onRead;
+
+  // The coach's schedule: calls at random gaps and phases, copies back to back
+  uint32_t toa = timeOnAirUs(withPreamble(MODEM_CALL_SF7, lv.coach), CALL_LENGTH);
+  uint64_t base = sim::clockUs(), t = base + 2000000;
+  for (int c = 0; c < CALLS; c++) {
+    cur.startUs[c] = t;
+    CallFrame f = encodeCall(ADDR_CATCHER, (uint8_t)(CMD_FB_IN + rng() % 10), (uint8_t)c);
+    for (int k = 0; k < COPIES; k++) {
+      Copy cp;
+      cp.endUs = t + (uint64_t)k * (toa + COPY_GAP_MS * 1000) + toa;
+      cp.call  = c;
+      memcpy(cp.bytes, f.bytes, CALL_LENGTH);
+      cur.copies.push_back(cp);
+    }
+    t += ((uint64_t)GAP_MIN_MS + rng() % (GAP_MAX_MS - GAP_MIN_MS)) * 1000 + rng() % 1000;
+  }
+
+  uint64_t listen0 = rx.radio->listenUs();
+  uint64_t endUs = cur.copies.back().endUs + 10000000;
+  sim::delayHook() = tick;
+  while (sim::clockUs() < endUs) {
+    tick();
+    rx.loop();
+  }
+  sim::delayHook() = NULL;
+  rx.radio->onRead = NULL;
+
+  Result r;
+  memset(&r, 0, sizeof(r));
+  int read = 0;
+  double sum = 0;
+  for (int c = 0; c < CALLS; c++) {
+    if (!cur.firstReadUs[c]) continue;
+    double ms = (cur.firstReadUs[c] - cur.startUs[c]) / 1000.0;
+    read++;
+    sum += ms;
+    if (ms > r.latMax) r.latMax = ms;
+  }
+  r.copiesPct = 100.0 * cur.heard / cur.copies.size();
+  r.callsPct  = 100.0 * read / CALLS;
+  r.latMean   = read ? sum / read : 0;
+  r.listenPct = 100.0 * (rx.radio->listenUs() - listen0) / (sim::clockUs() - base);
+  return r;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--verbose") == 0) sim::serialEcho() = true;
+  }
+
+  hud::setup();
+  armband::setup();
+
+  printf("PitchComm sniff sim — %d calls, %u-%u s apart, %d copies %u ms apart, SF7\n",
+         CALLS, (unsigned)(GAP_MIN_MS / 1000), (unsigned)(GAP_MAX_MS / 1000),
+         COPIES, (unsigned)COPY_GAP_MS);
+  printf("window %u symbols (%.1f ms), wake-up %.1f ms inside the sleep\n\n",
+         (unsigned)SNIFF_RX_SYMBOLS, sniffRxUs(MODEM_CALL_SF7) / 1000.0, SNIFF_WAKE_US / 1000.0);
+  printf("%-9s %-8s %8s %7s %13s %15s\n", "preamble", "rx", "copies", "calls", "lat ms",
+         "listen %");
+  printf("%-9s %-8s %8s %7s %13s %15s\n", "", "", "%", "%", "mean / max", "sim / model");
+
+  int failures = 0;
+  for (int li = 0; li < LEVEL_COUNT; li++) {
+    const Level& lv = LEVELS[li];
+    uint32_t sleep = lv.listen ? sniffSleepUs(MODEM_CALL_SF7, lv.listen) : 0;
+    double model = sleep ? 100.0 * sniffRxUs(MODEM_CALL_SF7) / (sniffRxUs(MODEM_CALL_SF7) + sleep)
+                         : 100.0;
+    for (int n = 0; n < RX_COUNT; n++) {
+      Result r = run(RECEIVERS[n], lv, 0x9E3779B97F4A7C15ULL + li);
+      char lat[24], listen[24];
+      snprintf(lat, sizeof(lat), "%.0f / %.0f", r.latMean, r.latMax);
+      snprintf(listen, sizeof(listen), "%.1f / %.1f", r.listenPct, model);
+      printf("%-9s %-8s %8.1f %7.1f %13s %15s\n", n == 0 ? lv.name : "", RECEIVERS[n].name,
+             r.copiesPct, r.callsPct, lat, listen);
+      if (lv.listen == lv.coach || lv.listen == 0) {
+        bool bad = r.copiesPct < 100.0 || r.listenPct > model + 2.0;
+        if (bad) { printf("  FAIL: %s missed frames or stayed in RX\n", RECEIVERS[n].name); failures++; }
+      }
+    }
+  }
+
+  // Leave both receivers as they booted
+  for (int n = 0; n < RX_COUNT; n++) {
+    RECEIVERS[n].radio->peerPreamble = 8;
+    RECEIVERS[n].listener->setPreamble(0);
+    RECEIVERS[n].listener->startReceive();
+  }
+
+  printf("\n%s\n", failures ? "FAIL" : "OK");
+  return failures ? 1 : 0;
+}
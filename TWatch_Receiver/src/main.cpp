@@ -8,6 +8,19 @@
 #include <XPowersLib.h>
 #include <TFT_eSPI.h>
 #include <RadioLib.h>
+#include <PitchCommProtocol.h>
+#include <PitchCommRxEvent.h>
+#include <PitchCommSpscRing.h>
+#include <PitchCommScene.h>
+#include <PitchCommHeapProbe.h>
+#include <PitchCommLink.h>
+#include <PitchCommRadio.h>
+#if defined(ESP32)
+#include <esp_heap_caps.h>
+#endif
+#if __has_include("CallBitmaps.h")
+#include "CallBitmaps.h"            // generated by Host_Bench font_compiler
+#endif
 
 // =============================================================================
 // T-Watch S3 Pin Definitions
@@ -24,6 +37,7 @@
 #define LORA_RST   8
 #define LORA_DIO1  9
 #define LORA_BUSY  7
+#define LORA_TCXO_V 1.6  // RadioLib default
 
 // DRV2605L Haptic Driver I2C Address
 #define DRV2605_ADDR 0x5A
@@ -36,6 +50,30 @@ TFT_eSPI tft = TFT_eSPI();
 SPIClass radioSPI(FSPI);
 SX1262 radio = new Module(LORA_CS, LORA_DIO1, LORA_RST, LORA_BUSY, radioSPI);
 
+// =============================================================================
+// Logging / heap checks
+// =============================================================================
+// Print::printf() mallocs for any line over its 64-byte stack buffer, so the
+// receive -> render path formats its log lines here instead. Build the
+// heapcheck env (PITCHCOMM_HEAP_PROBE) to count allocations per call; with
+// PITCHCOMM_HEAP_STRICT a nonzero count stops the watch.
+void serialLog(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+void serialLog(const char *fmt, ...) {
+  char line[160];
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(line, sizeof(line), fmt, ap);
+  va_end(ap);
+  Serial.print(line);
+}
+
+void heapCheck(const pitchcomm::HeapProbe &heap, const char *path) {
+  uint32_t allocs = heap.allocs();
+  if (allocs == 0) return;
+  serialLog("[Heap] %s: %lu allocs\n", path, (unsigned long)allocs);
+  if (pitchcomm::HEAP_STRICT) abort();
+}
+
 // =============================================================================
 // DRV2605L Haptic Driver Functions
 // =============================================================================
@@ -79,74 +117,78 @@ bool drv2605_init() {
   return true;
 }
 
-void vibrate(int duration) {
-  // Use RTP (Real-Time Playback) mode for custom duration
-  drv2605_write(0x01, 0x05); // RTP mode
-  drv2605_write(0x02, 0x7F); // Full amplitude
-  delay(duration);
-  drv2605_write(0x02, 0x00); // Stop
-  drv2605_write(0x01, 0x00); // Back to internal trigger mode
-}
+// =============================================================================
+// Haptic Engine (DRV2605 waveform sequencer)
+// =============================================================================
+// Each pattern is compiled into the DRV2605's 8 sequence slots (0x04-0x0B)
+// and started with one GO write; the chip times the buzzes and gaps itself
+// and the MCU returns straight away. A slot holds a library effect ID, or
+// 0x80 | n for a wait of n x 10 ms; a 0 slot ends the sequence early.
+//
+// hapticPlay() always preempts whatever is still playing (GO cleared, slots
+// reloaded, GO set), so an urgent pickoff cuts off a pitch pattern at once.
+#define DRV2605_REG_GO   0x0C
+#define DRV2605_REG_SEQ  0x04
+#define HAPTIC_SLOTS     8
+#define HAPTIC_WAIT(ms)  (uint8_t)(0x80 | ((ms) / 10))
 
-void vibrateEffect(uint8_t effect) {
-  // Play a waveform from library
-  drv2605_write(0x04, effect); // Set waveform
-  drv2605_write(0x05, 0x00);   // End sequence
-  drv2605_write(0x01, 0x00);   // Internal trigger mode
-  drv2605_write(0x0C, 0x01);   // GO!
-}
+// ERM library effect IDs (TS2200 library A)
+#define HAPTIC_CLICK     1             // Strong Click 100%
+#define HAPTIC_BUZZ_LONG 14            // Strong Buzz 100%
+#define HAPTIC_ALERT     15            // 750 ms Alert 100%
+#define HAPTIC_BUZZ      47            // Buzz 1 100%
 
-void vibratePattern(int count, int onTime, int offTime) {
-  for (int i = 0; i < count; i++) {
-    vibrate(onTime);
-    if (i < count - 1) delay(offTime);
-  }
+#define HAPTIC_PULSES_4  HAPTIC_CLICK, HAPTIC_WAIT(70), HAPTIC_CLICK, HAPTIC_WAIT(70), \
+                         HAPTIC_CLICK, HAPTIC_WAIT(70), HAPTIC_CLICK
+
+typedef uint8_t HapticPattern[HAPTIC_SLOTS];
+
+const HapticPattern HAPTIC_PITCH[] = {
+  { HAPTIC_BUZZ_LONG },                                            // FB: 1 long buzz
+  { HAPTIC_BUZZ, HAPTIC_WAIT(100), HAPTIC_BUZZ },                  // CB: 2 short
+  { HAPTIC_BUZZ, HAPTIC_WAIT(100), HAPTIC_BUZZ,
+    HAPTIC_WAIT(100), HAPTIC_BUZZ },                               // CH: 3 short
+  { HAPTIC_BUZZ, HAPTIC_WAIT(100), HAPTIC_BUZZ_LONG },             // SL: short + long
+  { HAPTIC_PULSES_4 },                                             // PO: rapid pulses
+};
+const HapticPattern HAPTIC_PICKOFF = { HAPTIC_PULSES_4 };
+const HapticPattern HAPTIC_THIRD   = { HAPTIC_BUZZ_LONG, HAPTIC_WAIT(150), HAPTIC_BUZZ_LONG };
+const HapticPattern HAPTIC_RESET   = { HAPTIC_ALERT };
+const HapticPattern HAPTIC_DEFAULT = { HAPTIC_BUZZ };
+
+void hapticPlay(const HapticPattern &pattern) {
+  drv2605_write(DRV2605_REG_GO, 0x00);  // stop (preempt) current sequence
+
+  // All 8 slots in one auto-increment write; unused slots are 0 (end)
+  Wire.beginTransmission(DRV2605_ADDR);
+  Wire.write(DRV2605_REG_SEQ);
+  for (int i = 0; i < HAPTIC_SLOTS; i++) Wire.write(pattern[i]);
+  Wire.endTransmission();
+
+  drv2605_write(DRV2605_REG_GO, 0x01);  // GO!
 }
 
-void vibratePitch(uint8_t pitch) {
-  switch (pitch) {
-    case 0: // FB - Fastball: 1 long buzz
-      vibrate(300);
-      break;
-    case 1: // CB - Curveball: 2 short buzzes
-      vibratePattern(2, 150, 100);
-      break;
-    case 2: // CH - Changeup: 3 short buzzes
-      vibratePattern(3, 100, 100);
-      break;
-    case 3: // SL - Slider: 1 short + 1 long
-      vibrate(100);
-      delay(100);
-      vibrate(250);
-      break;
-    case 4: // PO - Pickoff: rapid pulses
-      vibratePattern(4, 75, 75);
-      break;
-    default:
-      vibrate(200);
-      break;
+void hapticPitch(uint8_t pitch) {
+  if (pitch < sizeof(HAPTIC_PITCH) / sizeof(HAPTIC_PITCH[0])) {
+    hapticPlay(HAPTIC_PITCH[pitch]);
+  } else {
+    hapticPlay(HAPTIC_DEFAULT);
   }
 }
 
 // =============================================================================
-// Signal Structure
+// Signal Packet (layout defined in PitchCommProtocol.h)
 // =============================================================================
-typedef struct {
-  uint8_t type;
-  uint8_t pitch;
-  uint8_t zone;
-  uint8_t pickoff;
-  uint8_t thirdSign;
-  uint16_t number;
-} PitchSignal;
+using pitchcomm::SignalView;
 
 const char* pitchNames[] = {"FB", "CB", "CH", "SL", "PO"};
 const uint16_t pitchColors[] = {TFT_RED, TFT_YELLOW, TFT_GREEN, TFT_CYAN, TFT_MAGENTA};
 
 bool loraReady = false;
 bool hapticReady = false;
-PitchSignal lastSignal;
 unsigned long lastReceived = 0;
+pitchcomm::RxEvent rxEvent;            // DIO1 ISR -> radio task wakeup
+const uint32_t IDLE_TICK_MS = 100;     // loop() idle work runs at least this often
 
 // =============================================================================
 // Display Functions
@@ -165,114 +207,402 @@ void drawStartup() {
   tft.drawString(hapticReady ? "Haptic: Ready" : "Haptic: FAILED", 120, 170);
 }
 
-void drawWaiting() {
-  tft.fillScreen(TFT_BLACK);
-  tft.setTextDatum(MC_DATUM);
-  tft.setTextColor(TFT_DARKGREY);
-  tft.setTextSize(2);
-  tft.drawString("Waiting...", 120, 120);
+// Text layout (pitchcomm::Scene slots, mirrored by font_compiler): GLCD
+// font 1 at these sizes, every string centred on x
+enum { SIZE_CALL, SIZE_ZONE, SIZE_BADGE, SIZE_RESET };
+
+const uint8_t sceneSizes[] = { 6, 4, 2, 3 };
+
+const pitchcomm::SceneStyle signalStyles[pitchcomm::SCENE_STYLES] = {
+  // SCENE_PITCH: pitch above, zone below
+  { { SIZE_CALL, pitchcomm::SCENE_CENTER, 120, 80 },
+    { SIZE_CALL, pitchcomm::SCENE_CENTER, 120, 80 },
+    { SIZE_ZONE, pitchcomm::SCENE_CENTER, 120, 150 } },
+  // SCENE_RESET, SCENE_PICKOFF, SCENE_THIRD
+  { pitchcomm::SCENE_NO_SLOT, { SIZE_RESET, pitchcomm::SCENE_CENTER, 120, 120 }, pitchcomm::SCENE_NO_SLOT },
+  { pitchcomm::SCENE_NO_SLOT, { SIZE_CALL,  pitchcomm::SCENE_CENTER, 120, 120 }, pitchcomm::SCENE_NO_SLOT },
+  { pitchcomm::SCENE_NO_SLOT, { SIZE_CALL,  pitchcomm::SCENE_CENTER, 120, 120 }, pitchcomm::SCENE_NO_SLOT },
+};
+
+// "#n" is drawNumber()'s overlay (kept out of the frame cache); PK bottom
+// centre, 3rd top-right
+const pitchcomm::SceneLayout signalLayout = {
+  signalStyles, pitchcomm::SCENE_STYLES, false,
+  { pitchcomm::SCENE_NO_SLOT,
+    { SIZE_BADGE, pitchcomm::SCENE_CENTER, 120, 200 },
+    { SIZE_BADGE, pitchcomm::SCENE_CENTER, 200, 20 } }
+};
+
+// Once Host_Bench font_compiler has generated CallBitmaps.h (it mirrors the
+// layout above), every string is one prebuilt drawBitmap(): no textWidth(),
+// no scaled glyph rectangles.
+#ifdef PITCHCOMM_CALL_BITMAPS
+void drawArt(TFT_eSPI &g, const pitchcomm::PackedBitmap &art, uint16_t color) {
+  if (!art.empty()) g.drawBitmap(art.x, art.y, art.bits, art.w, art.h, color);
 }
 
-void drawSignal(PitchSignal &sig) {
-  if (sig.type == 1) {
-    tft.fillScreen(TFT_BLACK);
-    tft.setTextDatum(MC_DATUM);
-    tft.setTextColor(TFT_WHITE);
-    tft.setTextSize(3);
-    tft.drawString("RESET", 120, 120);
-    if (hapticReady) vibrate(500);
+void drawSignalArt(TFT_eSPI &g, const SignalView &sig) {
+  if (sig.isReset()) {
+    drawArt(g, resetBitmap, TFT_WHITE);
     return;
   }
 
-  bool hasPitch = (sig.pitch < 5);
-
-  if (sig.pickoff > 0 && !hasPitch) {
-    tft.fillScreen(TFT_BLACK);
-    tft.setTextDatum(MC_DATUM);
-    tft.setTextColor(TFT_RED);
-    tft.setTextSize(6);
-    tft.drawString("PK" + String(sig.pickoff), 120, 120);
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextSize(1);
-    tft.setTextColor(TFT_DARKGREY);
-    tft.drawString("#" + String(sig.number), 5, 5);
-    if (hapticReady) vibratePattern(4, 75, 75);
+  uint8_t pitch = sig.pitch();
+  bool hasPitch = pitch < pitchcomm::PITCH_COUNT;
+  uint8_t pickoff = sig.pickoff();
+  uint8_t third = sig.thirdSign();
+
+  if (pickoff > 0 && !hasPitch) {
+    if (pickoff <= pitchcomm::PICKOFF_MAX) drawArt(g, pickoffOnlyBitmaps[pickoff], TFT_RED);
     return;
   }
 
-  if (sig.thirdSign > 0 && !hasPitch) {
-    const char* thirdNames[] = {"", "3A", "3B", "3C", "3D"};
-    tft.fillScreen(TFT_BLACK);
-    tft.setTextDatum(MC_DATUM);
-    tft.setTextColor(TFT_BLUE);
-    tft.setTextSize(6);
-    if (sig.thirdSign <= 4) {
-      tft.drawString(thirdNames[sig.thirdSign], 120, 120);
-    } else {
-      tft.drawString("3?", 120, 120);
+  if (third > 0 && !hasPitch) {
+    drawArt(g, thirdOnlyBitmaps[third <= 4 ? third : pitchcomm::THIRD_MAX + 1], TFT_BLUE);
+    return;
+  }
+
+  if (hasPitch) drawArt(g, pitchBitmaps[pitch], pitchColors[pitch]);
+  if (sig.zone() > 0 && sig.zone() <= 9) drawArt(g, zoneBitmaps[sig.zone()], TFT_WHITE);
+  if (pickoff > 0 && pickoff <= pitchcomm::PICKOFF_MAX) drawArt(g, pickoffBitmaps[pickoff], TFT_RED);
+  if (third > 0 && third <= 4) drawArt(g, thirdBitmaps[third], TFT_BLUE);
+}
+#endif
+
+// What this receiver shows for a signal (Host_Bench scene_bench renders it too)
+void buildScene(const SignalView &sig, pitchcomm::Scene &scene) {
+  pitchcomm::signalScene(sig, pitchNames, pitchColors, scene);
+}
+
+// Signal screen without the "#n" overlay. g is the panel, a back buffer or
+// a frame-cache sprite (TFT_eSprite is a TFT_eSPI).
+void renderSignal(TFT_eSPI &g, const SignalView &sig) {
+  pitchcomm::Scene scene;
+  buildScene(sig, scene);
+#ifdef PITCHCOMM_CALL_BITMAPS
+  scene.clear(scene.style);             // every string is prebuilt art below
+#endif
+  pitchcomm::SceneBackend<TFT_eSPI> panel(g, sceneSizes, TFT_BLACK);
+  pitchcomm::renderScene(panel, scene, signalLayout);
+#ifdef PITCHCOMM_CALL_BITMAPS
+  drawSignalArt(g, sig);
+#endif
+}
+
+void drawNumber(TFT_eSPI &g, uint16_t number) {
+  g.setTextDatum(TL_DATUM);
+  g.setTextSize(1);
+  g.setTextColor(TFT_DARKGREY);
+  pitchcomm::SceneText text;
+  text.number("#", number);
+  g.drawString(text.text, 5, 5);
+}
+
+void signalHaptic(const SignalView &sig) {
+  if (!hapticReady) return;
+  if (sig.isReset())               hapticPlay(HAPTIC_RESET);
+  else if (sig.hasPitch())         hapticPitch(sig.pitch());
+  else if (sig.pickoff() > 0)      hapticPlay(HAPTIC_PICKOFF);
+  else if (sig.thirdSign() > 0)    hapticPlay(HAPTIC_THIRD);
+}
+
+// =============================================================================
+// Frame Buffers (PSRAM)
+// =============================================================================
+// Screens are composed off-panel in one of two 240x240 16-bit back buffers
+// and sent with pushImageDMA(), so the panel never shows a half-drawn screen
+// and the UI task does not wait on SPI. The next screen goes into the other
+// buffer while the first is still on the wire; a screen composed before its
+// predecessor was pushed simply replaces it (newest wins).
+//
+// The SPI DMA cannot read PSRAM: handed a PSRAM buffer, the IDF driver
+// mallocs a DMA-capable bounce copy of the whole transfer on every push
+// (and TFT_eSPI asserts when that fails). So the back buffer goes out in
+// FRAME_BAND_LINES-row bands through two buffers in internal DMA RAM,
+// allocated once: the next band is copied out of PSRAM while the previous
+// one is on the wire, and framePump() queues it when the wire is free.
+//
+// FRAME_PACING picks when a composed screen is pushed:
+//   PACE_ASAP      as soon as the previous DMA has finished
+//   PACE_INTERVAL  additionally no more than once per FRAME_INTERVAL_MS
+//
+// Render time (compose into the back buffer) and DMA time (push start to
+// transfer complete) are logged per screen as [TFT] render= dma=.
+//
+// All sprites are created before tft.initDMA(): TFT_eSprite falls back to
+// internal RAM for sprites created once DMA is enabled. Without PSRAM, or
+// without room for the bands, everything draws straight to the panel.
+#define PACE_ASAP     0
+#define PACE_INTERVAL 1
+
+#ifndef FRAME_PACING
+#define FRAME_PACING PACE_ASAP
+#endif
+#ifndef FRAME_INTERVAL_MS
+#define FRAME_INTERVAL_MS 40
+#endif
+#ifndef FRAME_BAND_LINES
+#define FRAME_BAND_LINES 20            // must divide TFT_HEIGHT
+#endif
+
+const size_t FRAME_BYTES = (size_t)TFT_WIDTH * TFT_HEIGHT * 2;
+const size_t BAND_PIXELS = (size_t)TFT_WIDTH * FRAME_BAND_LINES;
+const uint8_t FRAME_BANDS = TFT_HEIGHT / FRAME_BAND_LINES;
+
+TFT_eSprite *backBuf[2] = { NULL, NULL };
+uint16_t *dmaBand[2] = { NULL, NULL }; // internal DMA RAM, ping-pong
+uint8_t  backDraw = 0;                 // buffer being composed
+bool     framePending = false;         // backBuf[backDraw] composed, not pushed
+bool     dmaActive = false;            // backBuf[backDraw ^ 1] going out
+uint8_t  bandNext = 0;                 // next band to queue
+bool     bandReady = false;            // bandNext copied into its dmaBand
+uint32_t renderStartUs = 0, renderUs = 0;
+const char* frameSource = "";          // hit / miss / render / direct / idle
+uint32_t dmaStartUs = 0;
+uint32_t dmaRenderUs = 0;              // of the screen on the wire
+const char* dmaSource = "";
+unsigned long lastPushMs = 0;
+pitchcomm::LatencyStats renderStats, dmaStats;
+
+TFT_eSprite *newFrameSprite() {
+  TFT_eSprite *s = new TFT_eSprite(&tft);
+  s->setColorDepth(16);
+  if (s->createSprite(TFT_WIDTH, TFT_HEIGHT) == NULL) {
+    delete s;
+    return NULL;
+  }
+  return s;
+}
+
+// Target for the next screen: the free back buffer, or the panel itself
+TFT_eSPI &frameBegin() {
+  renderStartUs = micros();
+  if (backBuf[0] == NULL) return tft;
+  return *backBuf[backDraw];
+}
+
+// Copies the next band ahead and queues it once the wire is free; starts
+// the composed back buffer when pacing allows and notes DMA completion.
+// Call from loop() every iteration.
+void framePump() {
+  while (dmaActive) {
+    if (!bandReady && bandNext < FRAME_BANDS) {
+      const uint16_t *src = backBuf[backDraw ^ 1]->getPointer() + bandNext * BAND_PIXELS;
+      memcpy(dmaBand[bandNext & 1], src, BAND_PIXELS * 2);
+      bandReady = true;
     }
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextSize(1);
-    tft.setTextColor(TFT_DARKGREY);
-    tft.drawString("#" + String(sig.number), 5, 5);
-    if (hapticReady) vibratePattern(2, 200, 150);
+    if (tft.dmaBusy()) return;
+    if (bandNext == FRAME_BANDS) {
+      tft.endWrite();
+      dmaActive = false;
+      uint32_t dmaUs = micros() - dmaStartUs;
+      dmaStats.add(dmaUs);
+      serialLog("[TFT] render=%luus dma=%luus (max %lu/%lu) %s\n",
+        (unsigned long)dmaRenderUs, (unsigned long)dmaUs,
+        (unsigned long)renderStats.maxUs(), (unsigned long)dmaStats.maxUs(),
+        dmaSource);
+      break;
+    }
+    tft.pushImageDMA(0, bandNext * FRAME_BAND_LINES, TFT_WIDTH, FRAME_BAND_LINES,
+                     dmaBand[bandNext & 1]);
+    bandNext++;
+    bandReady = false;
+  }
+  if (!framePending) return;
+#if FRAME_PACING == PACE_INTERVAL
+  if (lastPushMs != 0 && millis() - lastPushMs < FRAME_INTERVAL_MS) return;
+#endif
+
+  tft.startWrite();
+  dmaStartUs = micros();
+  dmaRenderUs = renderUs;
+  dmaSource = frameSource;
+  lastPushMs = millis();
+  dmaActive = true;
+  framePending = false;
+  bandNext = 0;
+  bandReady = false;
+  backDraw ^= 1;
+  framePump();
+}
+
+void frameEnd() {
+  renderUs = micros() - renderStartUs;
+  renderStats.add(renderUs);
+  if (backBuf[0] == NULL) {
+    serialLog("[TFT] render=%luus %s\n", (unsigned long)renderUs, frameSource);
     return;
   }
+  framePending = true;
+  framePump();
+}
 
-  tft.fillScreen(TFT_BLACK);
-  tft.setTextDatum(MC_DATUM);
-  if (hasPitch) {
-    tft.setTextColor(pitchColors[sig.pitch]);
-    tft.setTextSize(6);
-    tft.drawString(pitchNames[sig.pitch], 120, 80);
-    if (hapticReady) vibratePitch(sig.pitch);
+// loop() wait: short while a push is queued or on the wire so completion
+// and paced pushes are picked up promptly
+uint32_t frameWaitMs() {
+  return (framePending || dmaActive) ? 1 : IDLE_TICK_MS;
+}
+
+// =============================================================================
+// Frame Cache (PSRAM)
+// =============================================================================
+// drawSignal() can only produce a few hundred distinct screens, each costing
+// a fillScreen plus scaled GLCD text. The screens are rendered once into
+// sprites and copied into the back buffer; only the "#n" overlay is drawn
+// per call. 8 MB cannot hold every combination, so the 50 pitch x zone
+// screens are rendered at boot and the remaining slots fill on first use,
+// least recently used evicted.
+//
+// Build with -DFRAME_CACHE_SLOTS=0 to render every screen from scratch.
+#ifndef FRAME_CACHE_SLOTS
+#define FRAME_CACHE_SLOTS 56
+#endif
+
+struct CachedFrame {
+  TFT_eSprite *sprite;
+  uint32_t     key;
+  uint32_t     lastUse;                // 0 = empty
+};
+
+#if FRAME_CACHE_SLOTS > 0
+CachedFrame frameCache[FRAME_CACHE_SLOTS];
+#endif
+uint8_t  frameSlots = 0;               // sprites actually allocated
+uint32_t frameClock = 0;
+uint32_t frameHits = 0, frameMisses = 0;
+
+// Fields a screen does not show are dropped, so e.g. every PK2-only call
+// maps to one frame whatever its zone.
+uint32_t frameKey(const SignalView &sig) {
+  if (sig.isReset()) return 0xFFFFFFFFu;
+  uint32_t pitch = sig.hasPitch() ? sig.pitch() : 0xFF;
+  if (!sig.hasPitch() && sig.pickoff() > 0)   return (pitch << 24) | ((uint32_t)sig.pickoff() << 8);
+  if (!sig.hasPitch() && sig.thirdSign() > 0) return (pitch << 24) | sig.thirdSign();
+  uint32_t zone = sig.zone() <= 9 ? sig.zone() : 0;
+  return (pitch << 24) | (zone << 16) | ((uint32_t)sig.pickoff() << 8) | sig.thirdSign();
+}
+
+// Sprite showing sig, rendered into the LRU slot on a miss. NULL when the
+// cache is off.
+TFT_eSprite *frameFor(const SignalView &sig) {
+#if FRAME_CACHE_SLOTS > 0
+  if (frameSlots == 0) return NULL;
+  uint32_t key = frameKey(sig);
+  CachedFrame *victim = &frameCache[0];
+  for (uint8_t i = 0; i < frameSlots; i++) {
+    CachedFrame &f = frameCache[i];
+    if (f.lastUse != 0 && f.key == key) {
+      f.lastUse = ++frameClock;
+      frameHits++;
+      return f.sprite;
+    }
+    if (f.lastUse < victim->lastUse) victim = &f;
   }
-  
-  if (sig.zone > 0 && sig.zone <= 9) {
-    tft.setTextColor(TFT_WHITE);
-    tft.setTextSize(4);
-    tft.drawString(String(sig.zone), 120, 150);
+  frameMisses++;
+  victim->key = key;
+  victim->lastUse = ++frameClock;
+  renderSignal(*victim->sprite, sig);
+  return victim->sprite;
+#else
+  (void)sig;
+  return NULL;
+#endif
+}
+
+// DMA bands and back buffers first, then as many cache slots as PSRAM holds
+void framesBegin() {
+#if defined(ESP32)
+  if (!psramFound()) {
+    Serial.println("[Frames] No PSRAM, drawing direct");
+    return;
   }
-  
-  if (sig.pickoff > 0) {
-    tft.setTextSize(2);
-    tft.setTextColor(TFT_RED);
-    tft.drawString("PK" + String(sig.pickoff), 120, 200);
+#endif
+  unsigned long t0 = millis();
+  dmaBand[0] = (uint16_t*)heap_caps_malloc(BAND_PIXELS * 2, MALLOC_CAP_DMA);
+  dmaBand[1] = (uint16_t*)heap_caps_malloc(BAND_PIXELS * 2, MALLOC_CAP_DMA);
+  backBuf[0] = newFrameSprite();
+  backBuf[1] = newFrameSprite();
+  if (dmaBand[0] == NULL || dmaBand[1] == NULL || backBuf[0] == NULL || backBuf[1] == NULL) {
+    heap_caps_free(dmaBand[0]);
+    heap_caps_free(dmaBand[1]);
+    delete backBuf[0];
+    delete backBuf[1];
+    dmaBand[0] = dmaBand[1] = NULL;
+    backBuf[0] = backBuf[1] = NULL;
+    Serial.println("[Frames] Back buffers failed, drawing direct");
+    return;
   }
-  
-  if (sig.thirdSign > 0) {
-    const char* thirdNames[] = {"", "3A", "3B", "3C", "3D"};
-    tft.setTextSize(2);
-    tft.setTextColor(TFT_BLUE);
-    if (sig.thirdSign <= 4) {
-      tft.drawString(thirdNames[sig.thirdSign], 200, 20);
+#if FRAME_CACHE_SLOTS > 0
+  while (frameSlots < FRAME_CACHE_SLOTS) {
+    TFT_eSprite *s = newFrameSprite();
+    if (s == NULL) break;
+    frameCache[frameSlots].sprite = s;
+    frameCache[frameSlots].lastUse = 0;
+    frameSlots++;
+  }
+#endif
+  tft.initDMA();
+
+  for (uint8_t p = 0; p < pitchcomm::PITCH_COUNT; p++) {
+    for (uint8_t z = 0; z <= 9 && frameClock < frameSlots; z++) {
+      pitchcomm::SignalFrame f = pitchcomm::encodeSignal(pitchcomm::SIGNAL_PITCH, p, z, 0, 0, 0);
+      frameFor(SignalView(f.bytes, pitchcomm::SIGNAL_LENGTH));
     }
   }
-  
-  tft.setTextDatum(TL_DATUM);
-  tft.setTextSize(1);
-  tft.setTextColor(TFT_DARKGREY);
-  tft.drawString("#" + String(sig.number), 5, 5);
+  frameMisses = 0;
+  Serial.printf("[Frames] 2 back buffers, %u x %u-line DMA bands, %u cache slots, "
+    "%lu prerendered in %lums, pacing %s\n",
+    FRAME_BANDS, FRAME_BAND_LINES, frameSlots, (unsigned long)frameClock, millis() - t0,
+    FRAME_PACING == PACE_INTERVAL ? "interval" : "asap");
+}
+
+// =============================================================================
+// Screens
+// =============================================================================
+void drawWaiting() {
+  TFT_eSPI &g = frameBegin();
+  frameSource = "idle";
+  g.fillScreen(TFT_BLACK);
+  g.setTextDatum(MC_DATUM);
+  g.setTextColor(TFT_DARKGREY);
+  g.setTextSize(2);
+  g.drawString("Waiting...", 120, 120);
+  frameEnd();
+}
+
+void drawSignal(const SignalView &sig) {
+  signalHaptic(sig);                   // ERM spin-up overlaps the redraw
+
+  TFT_eSPI &g = frameBegin();
+  uint32_t hits = frameHits;
+  TFT_eSprite *cached = frameFor(sig);
+  if (cached != NULL && &g != &tft) {
+    memcpy(backBuf[backDraw]->getPointer(), cached->getPointer(), FRAME_BYTES);
+    frameSource = frameHits != hits ? "hit" : "miss";
+  } else {
+    renderSignal(g, sig);
+    frameSource = &g == &tft ? "direct" : "render";
+  }
+  if (!sig.isReset()) drawNumber(g, sig.number());
+  frameEnd();
 }
 
 // =============================================================================
 // LoRa Setup
 // =============================================================================
 void setFlag(void);
+void startRadioTask();
+int beginRadio();
 
 void setupLoRa() {
   Serial.println("[LoRa] Initializing...");
   radioSPI.begin(LORA_SCK, LORA_MISO, LORA_MOSI, LORA_CS);
   
-  int state = radio.begin(915.0);
+  int state = beginRadio();
   
   if (state == RADIOLIB_ERR_NONE) {
     Serial.println("[LoRa] SX1262 init OK");
-    radio.setSpreadingFactor(10);
-    radio.setBandwidth(125.0);
-    radio.setCodingRate(8);
-    radio.setSyncWord(0x12);
-    radio.setOutputPower(22);
+    rxEvent.begin();
     radio.setDio1Action(setFlag);
     state = radio.startReceive();
     if (state == RADIOLIB_ERR_NONE) {
@@ -320,60 +650,228 @@ void setup() {
   
   setupLoRa();
   drawStartup();
+  unsigned long bootMs = millis();
+  framesBegin();
   
   // Test vibration
   if (hapticReady) {
     Serial.println("Testing vibration...");
-    vibrate(200);
+    hapticPlay(HAPTIC_DEFAULT);
   }
   
-  delay(2000);
+  // Startup screen stays up 2 s, prerendering included
+  unsigned long shownMs = millis() - bootMs;
+  if (shownMs < 2000) delay(2000 - shownMs);
   
   if (loraReady) {
     drawWaiting();
+    startRadioTask();
   }
   
   Serial.println("=== Ready ===\n");
 }
 
 // =============================================================================
-// Loop
+// Radio -> UI pipeline
 // =============================================================================
-volatile bool receivedFlag = false;
+// On the dual-core S3 a high-priority radio task on core 0 owns the SX1262:
+// it wakes on DIO1, reads the packet, re-arms RX straight away and pushes
+// the raw frame into a lock-free SPSC ring. loop() is the UI task (core 1):
+// it pops frames and runs drawSignal(), which therefore no longer keeps the
+// radio deaf. Without a second core
+// (host sim) loop() runs both halves in turn, radio first.
+#if defined(ESP32) && !CONFIG_FREERTOS_UNICORE
+#define RADIO_TASK 1
+#else
+#define RADIO_TASK 0
+#endif
+
+struct RxPacket {
+  uint8_t  data[pitchcomm::MAX_PACKET_LENGTH];
+  uint8_t  len;
+  uint32_t deafUs;                     // DIO1 -> RX re-armed
+};
+
+pitchcomm::SpscRing<RxPacket, 8> rxRing;
+pitchcomm::LatencyStats deafStats;     // UI task only
+volatile uint32_t rxDropped = 0;       // ring full
+uint32_t rxSuperseded = 0;             // newer frame arrived before drawing
+
+#if RADIO_TASK
+TaskHandle_t uiTask = NULL;
+#endif
 
 #if defined(ESP8266) || defined(ESP32)
   ICACHE_RAM_ATTR
 #endif
 void setFlag(void) {
-  receivedFlag = true;
+  rxEvent.notifyFromIsr();
+}
+
+// Link adaptation (PitchCommLink.h), radio half only: link commands are
+// answered here and never reach the ring. LINK_NODE is the report slot,
+// unique among the signal receivers.
+#ifndef LINK_NODE
+#define LINK_NODE 2
+#endif
+#define LINK_TICK_MS 20                // radio task wakeup for due reports
+
+pitchcomm::LinkFollower adr(pitchcomm::LINK_SIGNAL, LINK_NODE);
+
+void serviceLink() {
+  if (pitchcomm::sendLinkReport(radio, adr, millis(), setFlag)) {
+    serialLog("[LINK] report step=%u\n", adr.step());
+  }
+  if (adr.fallback(millis())) {
+    pitchcomm::tuneLink(radio, adr);
+    serialLog("[LINK] Coach silent, back to SF%u\n", adr.current().sf);
+  }
 }
 
+// Radio profile (PitchCommRadio.h), kept in NVS. RADIO_PROFILE is the
+// factory setting; "profile <name>" on USB serial stores another and
+// retunes from the radio task. Must match the coach.
+#ifndef RADIO_PROFILE
+#define RADIO_PROFILE pitchcomm::PROFILE_LONG_RANGE
+#endif
+
+pitchcomm::ProfileStore profileStore;
+pitchcomm::ProfileConsole profileConsole;
+
+int beginRadio() {
+  const pitchcomm::RadioProfile& p = pitchcomm::radioProfile(profileStore.load(RADIO_PROFILE));
+  Serial.printf("[LoRa] Profile %s\n", p.name);
+  int state = pitchcomm::beginProfile(radio, p, LORA_TCXO_V);
+  if (state == RADIOLIB_ERR_NONE) adr.setFamily(pitchcomm::linkFamily(p));
+  return state;
+}
+
+void serviceProfile() {
+  uint8_t id;
+  if (!profileConsole.poll(Serial, id)) return;
+  const pitchcomm::RadioProfile& p = pitchcomm::radioProfile(id);
+  if (!profileStore.save(id)) serialLog("[LoRa] Profile not saved\n");
+  int state = pitchcomm::applyProfile(radio, p);
+  adr.setFamily(pitchcomm::linkFamily(p));
+  radio.startReceive();
+  serialLog("[LoRa] Profile %s SF%u: %d\n", p.name, p.modem.sf, state);
+}
+
+// Link command from the coach: report SNR, maybe step SF. Not on the call
+// path, so outside the heap probe (RadioLib's reconfiguration is not ours).
+void linkCommand(const pitchcomm::LinkCommandView &cmd) {
+  // Packet status still holds the last packet's SNR after re-arming
+  int16_t snrQ4 = (int16_t)(radio.getSNR() * 4);
+  if (adr.onCommand(cmd, snrQ4, (int16_t)radio.getRSSI(), millis())) {
+    pitchcomm::tuneLink(radio, adr);
+  }
+  // Quarter dB as integers: no %f (newlib's dtoa may allocate)
+  serialLog("[LINK] step=%u SF%u SNR=%s%d.%02d\n", adr.step(), adr.current().sf,
+            snrQ4 < 0 ? "-" : "", abs(snrQ4) / 4, abs(snrQ4) % 4 * 25);
+}
+
+// Radio half: read one packet, re-arm RX, queue it. False on timeout.
+bool radioService(uint32_t timeoutMs) {
+  if (!rxEvent.wait(timeoutMs)) return false;
+
+  pitchcomm::HeapProbe heap;
+  RxPacket pkt;
+  size_t len = radio.getPacketLength();
+  if (len > sizeof(pkt.data)) len = sizeof(pkt.data);
+  int state = radio.readData(pkt.data, len);
+  radio.startReceive();
+  pkt.deafUs = micros() - rxEvent.isrUs();
+  pkt.len = (uint8_t)len;
+
+  pitchcomm::LinkCommandView cmd(pkt.data, len);
+  if (state == RADIOLIB_ERR_NONE && cmd.valid()) {
+    linkCommand(cmd);                  // not the call path: no heap check
+    return true;
+  }
+  if (state == RADIOLIB_ERR_NONE) {
+    if (SignalView(pkt.data, pkt.len).valid()) adr.onTraffic(millis());
+    if (rxRing.push(pkt)) {
+#if RADIO_TASK
+      xTaskNotifyGive(uiTask);
+#endif
+    } else {
+      rxDropped++;
+    }
+  }
+  heapCheck(heap, "radio");
+  return true;
+}
+
+#if RADIO_TASK
+void radioTask(void *) {
+  rxEvent.begin();                     // DIO1 wakeups now come to this task
+  for (;;) {
+    radioService(LINK_TICK_MS);
+    serviceLink();
+    serviceProfile();
+  }
+}
+#endif
+
+void startRadioTask() {
+#if RADIO_TASK
+  uiTask = xTaskGetCurrentTaskHandle();
+  xTaskCreatePinnedToCore(radioTask, "radio", 4096, NULL,
+                          configMAX_PRIORITIES - 2, NULL, 0);
+  Serial.println("[LoRa] Radio task on core 0");
+#endif
+}
+
+// =============================================================================
+// Loop (UI task)
+// =============================================================================
 void loop() {
   if (!loraReady) {
     delay(1000);
     return;
   }
-  
-  if (receivedFlag) {
-    receivedFlag = false;
-    int state = radio.readData((uint8_t*)&lastSignal, sizeof(lastSignal));
-    
-    if (state == RADIOLIB_ERR_NONE) {
-      Serial.printf("RX: type=%d pitch=%d zone=%d pick=%d 3rd=%d #%d\n",
-        lastSignal.type, lastSignal.pitch, lastSignal.zone,
-        lastSignal.pickoff, lastSignal.thirdSign, lastSignal.number);
-      
-      drawSignal(lastSignal);
-      lastReceived = millis();
-    }
-    
-    radio.startReceive();
+
+#if RADIO_TASK
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(frameWaitMs()));
+#else
+  radioService(frameWaitMs());
+  serviceLink();
+  serviceProfile();
+#endif
+
+  // Only the newest signal is worth drawing after a slow redraw
+  pitchcomm::HeapProbe heap;
+  RxPacket pkt, latest;
+  bool have = false;
+  while (rxRing.pop(pkt)) {
+    deafStats.add(pkt.deafUs);
+    if (!SignalView(pkt.data, pkt.len).valid()) continue;
+    if (have) rxSuperseded++;
+    latest = pkt;
+    have = true;
   }
-  
+
+  if (have) {
+    SignalView sig(latest.data, latest.len);
+    serialLog("RX: type=%d pitch=%d zone=%d pick=%d 3rd=%d #%d wake=%luus deaf=%luus (max %lu) drop=%lu skip=%lu\n",
+      sig.type(), sig.pitch(), sig.zone(),
+      sig.pickoff(), sig.thirdSign(), sig.number(),
+      (unsigned long)rxEvent.lastUs(), (unsigned long)latest.deafUs,
+      (unsigned long)deafStats.maxUs(), (unsigned long)rxDropped,
+      (unsigned long)rxSuperseded);
+
+    drawSignal(sig);
+    lastReceived = millis();
+  }
+  heapCheck(heap, "RX->render");
+
   if (lastReceived > 0 && millis() - lastReceived > 30000) {
     drawWaiting();
     lastReceived = 0;
   }
-  
-  delay(10);
+
+  // The band pushes run here too: a bounce buffer would show up as an alloc
+  heap.reset();
+  framePump();
+  heapCheck(heap, "DMA push");
 }
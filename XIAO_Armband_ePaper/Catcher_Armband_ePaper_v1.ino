@@ -7,14 +7,20 @@
  * Mount:     Forearm armband — low-profile linear enclosure
  * 
  * RF LINK:   Matched to T-Deck Plus Coach Transmitter
- *            915.0 MHz | SF7 | BW125 | CR4/5 | Sync 0x34
+ *            LowLatency profile: 915.0 MHz | SF7 | BW125 | CR4/5 | Sync 0x34
+ *            "profile <name>" on USB serial stores another (PitchCommRadio.h)
  *            6-byte packet: [0xCC][0x01][0x01][CMD][SEQ][XOR]
+ *            14-byte FEC packet (Hamming 8,4 + CRC-8) decoded transparently
+ *            Optional RX duty cycle on a long coach preamble (RX_SNIFF_PREAMBLE)
  * 
- * DISPLAY:   Partial refresh for sub-500ms pitch call updates
- *            Full refresh every 20 cycles to prevent ghosting
+ * DISPLAY:   Partial refresh: calls on the glass <600ms worst case
+ *            Optional fast waveform LUT for calls (FAST_CALL_LUT)
+ *            Ghost cleanup (full refresh) only in idle windows, never on
+ *            the path of an incoming call
  * 
  * SPI BUS:   SHARED between SX1262 (D4 CS) and ePaper (D0 CS)
  *            Only one device active at a time — CS arbitration
+ *            Radio is serviced during ePaper BUSY (GxEPD2 busy callback)
  * 
  * PIN ALLOCATION (ALL 11 GPIO USED):
  *   D0  = ePaper CS (chip select)
@@ -36,7 +42,20 @@
 #include <SPI.h>
 #include <RadioLib.h>
 #include <GxEPD2_BW.h>
+#include <PitchCommProtocol.h>
+#include <PitchCommFec.h>
+#include <PitchCommRxEvent.h>
+#include <PitchCommFastLut.h>
+#include <PitchCommScene.h>
+#include <PitchCommLink.h>
+#include <PitchCommArq.h>
+#include <PitchCommSniff.h>
+#include <PitchCommRadio.h>
+#if __has_include("CallBitmaps.h")
+#include "CallBitmaps.h"        // generated by Host_Bench font_compiler
+#else
 #include <Fonts/FreeSansBold24pt7b.h>
+#endif
 #include <Fonts/FreeSansBold12pt7b.h>
 #include <Fonts/FreeSansBold9pt7b.h>
 #include <Fonts/FreeSans9pt7b.h>
@@ -64,48 +83,47 @@
 // MOSI = D10 (shared)
 
 // ============================================================================
-// RF PARAMETERS — IDENTICAL TO T-DECK PLUS COACH TRANSMITTER
+// RF PROFILE — IDENTICAL TO T-DECK PLUS COACH TRANSMITTER
 // ============================================================================
-#define RF_FREQ         915.0
-#define RF_BW           125.0
-#define RF_SF           7
-#define RF_CR           5
-#define RF_SYNC         0x34
-#define RF_POWER        22
-#define RF_PREAMBLE     8
+// Factory setting (PitchCommRadio.h); a profile stored over USB serial
+// takes precedence.
+#define RADIO_PROFILE   PROFILE_LOW_LATENCY
 #define RF_TCXO_V       1.8
 
-// ============================================================================
-// PACKET PROTOCOL — MATCHED TO COACH TX
-// ============================================================================
-#define PKT_MAGIC       0xCC
-#define PKT_VERSION     0x01
-#define ADDR_CATCHER    0x01
-#define PKT_LENGTH      6
+// Link adaptation (PitchCommLink.h): report slot among the call receivers
+#define LINK_NODE       1
+
+// Call addressing: device id (unicast and mask bit) and groups joined.
+// ADDR_PITCHER on the pitcher's unit, ADDR_FIELDER + n on a fielder's.
+#define CALL_DEVICE     ADDR_CATCHER
+#define CALL_GROUPS     ((1UL << GROUP_BATTERY) | (1UL << GROUP_DEFENSE))
+
+// RX duty cycle (PitchCommSniff.h): the coach's preamble in symbols, which
+// must match the coach. Longer saves more current and delays every call
+// more: 64 at SF7 = +57 ms, radio awake 25 %. 0 = always listening.
+#define RX_SNIFF_PREAMBLE   0
 
 // ============================================================================
-// COMMAND TABLE — MATCHED TO T-DECK PLUS COACH TRANSMITTER
+// PACKET PROTOCOL + COMMAND TABLE — see PitchCommProtocol.h (shared with TX)
 // ============================================================================
-#define CMD_FB_IN       0x01
-#define CMD_FB_OUT      0x02
-#define CMD_CURVE       0x03
-#define CMD_CHANGE      0x04
-#define CMD_SLIDER      0x05
-#define CMD_CUTTER      0x06
-#define CMD_SPLIT       0x07
-#define CMD_SCREW       0x08
-#define CMD_PICK1       0x09
-#define CMD_PICK2       0x0A
-#define CMD_PITCHOUT    0x10
-#define CMD_TIMEOUT     0xFF
+using namespace pitchcomm;
 
 // ============================================================================
 // DISPLAY CONFIGURATION
 // ============================================================================
-#define PARTIAL_REFRESH_LIMIT   20    // Full refresh every N partial updates
+#define PARTIAL_REFRESH_LIMIT   20    // Partial updates before ghost cleanup is due
+#define GHOST_IDLE_WEAR         5     // Wear worth cleaning in a long idle gap
+#define GHOST_IDLE_GAP_MS       20000 // No call for this long = between batters
 #define DISPLAY_HOLD_MS         8000  // Hold pitch call for 8 seconds
+#define IDLE_TICK_MS            100   // loop() idle work runs at least this often
+#define FAST_CALL_LUT           0     // 1 = calls use the short custom waveform
+#define FAST_LUT_FRAMES         6     // Frames of the fast waveform (tune on bench)
+#define FAST_LUT_WEAR           2     // Ghosting of one fast update, in partials
+#define LUT_BENCH               0     // 1 = time both waveforms at boot (serial)
 #define SCREEN_WIDTH            250
 #define SCREEN_HEIGHT           122
+#define FRAME_STRIDE            ((SCREEN_WIDTH + 7) / 8)
+#define FRAME_BYTES             (FRAME_STRIDE * SCREEN_HEIGHT)
 
 // ============================================================================
 // DEVICE INSTANCES
@@ -114,20 +132,48 @@
 // LoRa radio — SX1262 on shared SPI
 SX1262 radio = new Module(LORA_NSS, LORA_DIO1, LORA_RESET, LORA_BUSY);
 
+// Re-arms RX: continuous, or sniffing when RX_SNIFF_PREAMBLE is set
+SniffListener<SX1262> listener(radio, MODEM_CALL_SF7, RX_SNIFF_PREAMBLE);
+
 // ePaper display — 2.13" BN (black/white, SSD1680 driver)
-// Constructor: GxEPD2_213_BN(CS, DC, RST, BUSY)
-GxEPD2_BW<GxEPD2_213_BN, GxEPD2_213_BN::HEIGHT> display(
-    GxEPD2_213_BN(EPAPER_CS, EPAPER_DC, EPAPER_RST, EPAPER_BUSY)
+// FastLut213 is GxEPD2_213_BN plus the optional fast call waveform
+// Constructor: FastLut213(CS, DC, RST, BUSY)
+GxEPD2_BW<FastLut213, FastLut213::HEIGHT> display(
+    FastLut213(EPAPER_CS, EPAPER_DC, EPAPER_RST, EPAPER_BUSY)
 );
 
+// Screens are drawn here first (1 = white); only pixels that differ from
+// what is on the glass are pushed to the panel
+GFXcanvas1 frame(SCREEN_WIDTH, SCREEN_HEIGHT);
+uint8_t glass[FRAME_BYTES];
+
 // ============================================================================
 // STATE TRACKING
 // ============================================================================
-volatile bool rxFlag = false;
-uint8_t lastSeq = 0xFF;
+RxEvent rxEvent;                // DIO1 ISR -> loop() wakeup
+const CallAddress myAddress = { CALL_DEVICE, CALL_GROUPS };
+bool haveCall = false;           // Any call accepted since boot
+uint8_t lastSeq = 0;
+uint8_t lastCmd = 0;
+unsigned long lastRxTime = 0;    // When lastSeq/lastCmd were accepted
 unsigned long lastCallTime = 0;
 bool displayingCall = false;
-int partialCount = 0;
+int partialCount = 0;            // Partial refreshes since the last full one
+LatencyStats inkLatency;        // DIO1 ISR -> call on the glass
+LinkFollower adr(LINK_CALL, LINK_NODE);   // coach's SF step, see serviceLink()
+CallAcker ack(LINK_NODE);                 // ARQ calls, see serviceAck()
+
+// Newest accepted call not yet on the glass; a correction that arrives
+// during a refresh replaces one that is still waiting
+struct QueuedCall {
+    uint8_t  cmd;
+    uint8_t  seq;
+    int16_t  rssi;
+    uint32_t isrUs;             // DIO1 time, for call-to-ink latency
+};
+QueuedCall nextCall;
+bool callQueued = false;
+uint8_t shownSeq = 0xFF;        // Sequence of the call on the glass
 int16_t lastRSSI = 0;
 bool systemReady = false;
 
@@ -135,7 +181,7 @@ bool systemReady = false;
 // RX INTERRUPT HANDLER
 // ============================================================================
 void rxISR(void) {
-    rxFlag = true;
+    rxEvent.notifyFromIsr();
 }
 
 // ============================================================================
@@ -182,187 +228,380 @@ PitchInfo decodePitch(uint8_t cmd) {
 }
 
 // ============================================================================
-// ePAPER DISPLAY FUNCTIONS
+// FRAME PUSH — refresh only the window that changed
 // ============================================================================
+// Every screen is drawn into `frame`, then diffed against `glass` (what the
+// panel shows). A partial update sends and refreshes only the bounding box
+// of the changed bytes, so an RSSI digit or a detail line costs a strip of
+// the panel instead of all of it.
 
-void displayBootScreen() {
-    selectEPaper();
-    display.setFullWindow();
-    display.firstPage();
-    do {
-        display.fillScreen(GxEPD_WHITE);
-        
-        // Title
-        display.setFont(&FreeSansBold12pt7b);
-        display.setTextColor(GxEPD_BLACK);
-        
-        // Center "PITCHCOMM" 
-        int16_t x1, y1;
-        uint16_t w, h;
-        display.getTextBounds("PITCHCOMM", 0, 0, &x1, &y1, &w, &h);
-        display.setCursor((SCREEN_WIDTH - w) / 2, 45);
-        display.print("PITCHCOMM");
-        
-        // Subtitle
-        display.setFont(&FreeSans9pt7b);
-        display.getTextBounds("ARMBAND RX v1.0", 0, 0, &x1, &y1, &w, &h);
-        display.setCursor((SCREEN_WIDTH - w) / 2, 72);
-        display.print("ARMBAND RX v1.0");
-        
-        // Frequency info
-        display.getTextBounds("915 MHz LoRa", 0, 0, &x1, &y1, &w, &h);
-        display.setCursor((SCREEN_WIDTH - w) / 2, 95);
-        display.print("915 MHz LoRa");
-        
-        // Border
-        display.drawRect(2, 2, SCREEN_WIDTH - 4, SCREEN_HEIGHT - 4, GxEPD_BLACK);
-        display.drawRect(4, 4, SCREEN_WIDTH - 8, SCREEN_HEIGHT - 8, GxEPD_BLACK);
-        
-    } while (display.nextPage());
+struct Window {
+    int16_t x, y, w, h;
+};
+
+// Bounding box of the bytes that differ; false when the frames match
+bool changedWindow(Window& win) {
+    const uint8_t* buf = frame.getBuffer();
+    int16_t bx0 = FRAME_STRIDE, bx1 = -1, y0 = SCREEN_HEIGHT, y1 = -1;
+    for (int16_t y = 0; y < SCREEN_HEIGHT; y++) {
+        const uint8_t* row = buf + y * FRAME_STRIDE;
+        const uint8_t* was = glass + y * FRAME_STRIDE;
+        for (int16_t bx = 0; bx < FRAME_STRIDE; bx++) {
+            if (row[bx] == was[bx]) continue;
+            if (bx < bx0) bx0 = bx;
+            if (bx > bx1) bx1 = bx;
+            if (y < y0) y0 = y;
+            y1 = y;
+        }
+    }
+    if (y1 < 0) return false;
     
-    partialCount = 0;  // Reset after full refresh
+    int16_t x1 = (bx1 + 1) * 8;
+    if (x1 > SCREEN_WIDTH) x1 = SCREEN_WIDTH;
+    win.x = bx0 * 8;
+    win.y = y0;
+    win.w = x1 - win.x;
+    win.h = y1 - y0 + 1;
+    return true;
+}
+
+// Controller RAM bytes for one write of the window. Landscape screen rows
+// are panel columns, which GxEPD2 widens to whole bytes.
+uint32_t panelBytes(const Window& win) {
+    int16_t px = GxEPD2_213_BN::WIDTH - win.y - win.h;
+    int16_t pw = win.h + px % 8;
+    return (uint32_t)((pw + 7) / 8) * win.w;
 }
 
-void displayStandby() {
+enum RefreshMode {
+    REFRESH_FULL,       // boot, error, ghost cleanup — stock waveform
+    REFRESH_PARTIAL,    // stock partial waveform
+    REFRESH_FAST        // FastLut213 waveform (black/white only)
+};
+
+void pushFrame(RefreshMode mode) {
     selectEPaper();
     
-    // Use partial refresh for standby screen
-    if (partialCount >= PARTIAL_REFRESH_LIMIT) {
+    bool full = mode == REFRESH_FULL;
+    Window win = { 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT };
+    if (full) {
         display.setFullWindow();
-        partialCount = 0;
+    } else if (!changedWindow(win)) {
+        Serial.println("[DISP] No change");
+        return;
     } else {
-        display.setPartialWindow(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
-        partialCount++;
+        display.setPartialWindow(win.x, win.y, win.w, win.h);
     }
     
+    display.epd2.setFast(mode == REFRESH_FAST);
+    unsigned long t0 = millis();
+    const uint8_t* buf = frame.getBuffer();
     display.firstPage();
     do {
-        display.fillScreen(GxEPD_WHITE);
-        
-        display.setFont(&FreeSansBold12pt7b);
-        display.setTextColor(GxEPD_BLACK);
-        
-        int16_t x1, y1;
-        uint16_t w, h;
-        display.getTextBounds("READY", 0, 0, &x1, &y1, &w, &h);
-        display.setCursor((SCREEN_WIDTH - w) / 2, 55);
-        display.print("READY");
-        
-        // Signal indicator
-        display.setFont(&FreeSans9pt7b);
-        if (lastRSSI != 0) {
-            char rssiStr[20];
-            snprintf(rssiStr, sizeof(rssiStr), "RSSI: %d dBm", lastRSSI);
-            display.getTextBounds(rssiStr, 0, 0, &x1, &y1, &w, &h);
-            display.setCursor((SCREEN_WIDTH - w) / 2, 85);
-            display.print(rssiStr);
-        } else {
-            display.getTextBounds("Awaiting signal...", 0, 0, &x1, &y1, &w, &h);
-            display.setCursor((SCREEN_WIDTH - w) / 2, 85);
-            display.print("Awaiting signal...");
+        // Row by row, so only the window's pixels are converted
+        for (int16_t y = win.y; y < win.y + win.h; y++) {
+            display.drawBitmap(win.x, y, buf + y * FRAME_STRIDE + win.x / 8,
+                               win.w, 1, GxEPD_WHITE, GxEPD_BLACK);
         }
-        
-        // Thin border
-        display.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, GxEPD_BLACK);
-        
     } while (display.nextPage());
+    memcpy(glass, buf, FRAME_BYTES);
+    
+    if (full) {
+        partialCount = 0;
+    } else {
+        partialCount += mode == REFRESH_FAST ? FAST_LUT_WEAR : 1;
+    }
+    
+    // Partial updates also write the window into the "previous" RAM
+    static const char* const MODE_NAMES[] = { "Full", "Partial", "Fast" };
+    uint32_t bytes = panelBytes(win) * (full ? 1 : 2);
+    Serial.print("[DISP] ");
+    Serial.print(MODE_NAMES[mode]);
+    Serial.print(" ");
+    Serial.print(win.w);
+    Serial.print("x");
+    Serial.print(win.h);
+    Serial.print(" at ");
+    Serial.print(win.x);
+    Serial.print(",");
+    Serial.print(win.y);
+    Serial.print(" ");
+    Serial.print(bytes);
+    Serial.print(" B ");
+    Serial.print(millis() - t0);
+    Serial.println("ms");
 }
 
-void displayPitchCall(PitchInfo pitch) {
-    selectEPaper();
+// ============================================================================
+// ePAPER DISPLAY FUNCTIONS
+// ============================================================================
+
+void displayBootScreen() {
+    frame.fillScreen(GxEPD_WHITE);
     
-    // Force full refresh periodically to clear ghosting
-    if (partialCount >= PARTIAL_REFRESH_LIMIT) {
-        display.setFullWindow();
-        partialCount = 0;
+    // Title
+    frame.setFont(&FreeSansBold12pt7b);
+    frame.setTextColor(GxEPD_BLACK);
+    
+    // Center "PITCHCOMM" 
+    int16_t x1, y1;
+    uint16_t w, h;
+    frame.getTextBounds("PITCHCOMM", 0, 0, &x1, &y1, &w, &h);
+    frame.setCursor((SCREEN_WIDTH - w) / 2, 45);
+    frame.print("PITCHCOMM");
+    
+    // Subtitle
+    frame.setFont(&FreeSans9pt7b);
+    frame.getTextBounds("ARMBAND RX v1.0", 0, 0, &x1, &y1, &w, &h);
+    frame.setCursor((SCREEN_WIDTH - w) / 2, 72);
+    frame.print("ARMBAND RX v1.0");
+    
+    // Frequency info
+    frame.getTextBounds("915 MHz LoRa", 0, 0, &x1, &y1, &w, &h);
+    frame.setCursor((SCREEN_WIDTH - w) / 2, 95);
+    frame.print("915 MHz LoRa");
+    
+    // Border
+    frame.drawRect(2, 2, SCREEN_WIDTH - 4, SCREEN_HEIGHT - 4, GxEPD_BLACK);
+    frame.drawRect(4, 4, SCREEN_WIDTH - 8, SCREEN_HEIGHT - 8, GxEPD_BLACK);
+    
+    pushFrame(REFRESH_FULL);
+}
+
+// full = ghost cleanup: the standby screen is redrawn with a full refresh,
+// which takes ~2 s and clears the wear of all earlier partial updates
+void displayStandby(bool full) {
+    frame.fillScreen(GxEPD_WHITE);
+    
+    frame.setFont(&FreeSansBold12pt7b);
+    frame.setTextColor(GxEPD_BLACK);
+    
+    int16_t x1, y1;
+    uint16_t w, h;
+    frame.getTextBounds("READY", 0, 0, &x1, &y1, &w, &h);
+    frame.setCursor((SCREEN_WIDTH - w) / 2, 55);
+    frame.print("READY");
+    
+    // Signal indicator
+    frame.setFont(&FreeSans9pt7b);
+    if (lastRSSI != 0) {
+        char rssiStr[20];
+        snprintf(rssiStr, sizeof(rssiStr), "RSSI: %d dBm", lastRSSI);
+        frame.getTextBounds(rssiStr, 0, 0, &x1, &y1, &w, &h);
+        frame.setCursor((SCREEN_WIDTH - w) / 2, 85);
+        frame.print(rssiStr);
     } else {
-        display.setPartialWindow(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
-        partialCount++;
+        frame.getTextBounds("Awaiting signal...", 0, 0, &x1, &y1, &w, &h);
+        frame.setCursor((SCREEN_WIDTH - w) / 2, 85);
+        frame.print("Awaiting signal...");
     }
     
-    display.firstPage();
-    do {
-        if (pitch.urgent) {
-            // INVERTED — white text on black background for urgency
-            display.fillScreen(GxEPD_BLACK);
-            display.setTextColor(GxEPD_WHITE);
-        } else {
-            display.fillScreen(GxEPD_WHITE);
-            display.setTextColor(GxEPD_BLACK);
-        }
-        
-        int16_t x1, y1;
-        uint16_t w, h;
-        
-        // Primary pitch call — LARGE
-        display.setFont(&FreeSansBold24pt7b);
-        display.getTextBounds(pitch.line1, 0, 0, &x1, &y1, &w, &h);
-        int16_t primaryX = (SCREEN_WIDTH - w) / 2;
-        int16_t primaryY;
-        
-        if (strlen(pitch.line2) > 0) {
-            primaryY = 52;  // Higher if there's a second line
-        } else {
-            primaryY = 70;  // Centered vertically if single line
-        }
-        display.setCursor(primaryX, primaryY);
-        display.print(pitch.line1);
-        
-        // Secondary detail line
-        if (strlen(pitch.line2) > 0) {
-            display.setFont(&FreeSansBold12pt7b);
-            display.getTextBounds(pitch.line2, 0, 0, &x1, &y1, &w, &h);
-            display.setCursor((SCREEN_WIDTH - w) / 2, 90);
-            display.print(pitch.line2);
-        }
-        
-        // RSSI bar in bottom-right corner
-        display.setFont(NULL);  // Default 6x8 font
-        char rssiStr[12];
-        snprintf(rssiStr, sizeof(rssiStr), "%ddBm", lastRSSI);
-        if (pitch.urgent) {
-            display.setTextColor(GxEPD_WHITE);
-        }
-        display.setCursor(SCREEN_WIDTH - 48, SCREEN_HEIGHT - 12);
-        display.print(rssiStr);
-        
-        // Border — double for urgent
-        if (pitch.urgent) {
-            display.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, GxEPD_WHITE);
-            display.drawRect(2, 2, SCREEN_WIDTH - 4, SCREEN_HEIGHT - 4, GxEPD_WHITE);
-            display.drawRect(4, 4, SCREEN_WIDTH - 8, SCREEN_HEIGHT - 8, GxEPD_WHITE);
-        } else {
-            display.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, GxEPD_BLACK);
-            display.drawRect(2, 2, SCREEN_WIDTH - 4, SCREEN_HEIGHT - 4, GxEPD_BLACK);
-        }
-        
-    } while (display.nextPage());
+    // Thin border
+    frame.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, GxEPD_BLACK);
+    
+    pushFrame(full ? REFRESH_FULL : REFRESH_PARTIAL);
+}
+
+// The call layout is mirrored in Host_Bench/src/font_compiler.cpp. With its
+// generated CallBitmaps.h both lines are prebuilt bitmaps, nothing is
+// measured at runtime and FreeSansBold24pt7b is no longer linked.
+#ifdef PITCHCOMM_CALL_BITMAPS
+const CallArt& callArtFor(uint8_t cmd) {
+    for (uint8_t i = 0; i < CALL_ART_COUNT; i++) {
+        if (callArt[i].cmd == cmd) return callArt[i];
+    }
+    return unknownArt;
+}
+
+void drawArt(const PackedBitmap& art, uint16_t color) {
+    if (!art.empty()) frame.drawBitmap(art.x, art.y, art.bits, art.w, art.h, color);
+}
+#endif
+
+// Call layout (Scene slots): line 1 higher when there is a line 2, RSSI
+// in the bottom-right corner in the built-in 6x8 font
+const GFXfont* const sceneFonts[] = {
+#ifdef PITCHCOMM_CALL_BITMAPS
+    NULL,                               // both lines are prebuilt art
+#else
+    &FreeSansBold24pt7b,
+#endif
+    &FreeSansBold12pt7b,
+    NULL
+};
+
+const SceneStyle callStyle = {
+    { 0, SCENE_CENTER, SCREEN_WIDTH / 2, 52 },
+    { 0, SCENE_CENTER, SCREEN_WIDTH / 2, 70 },
+    { 1, SCENE_CENTER, SCREEN_WIDTH / 2, 90 },
+};
+
+const SceneLayout callLayout = {
+    &callStyle, 1, false,
+    { { 2, SCENE_LEFT, SCREEN_WIDTH - 48, SCREEN_HEIGHT - 12 }, SCENE_NO_SLOT, SCENE_NO_SLOT }
+};
+
+SceneBackend<Adafruit_GFX> panel(frame, sceneFonts, GxEPD_BLACK, GxEPD_WHITE);
+
+// What the armband shows for a call (Host_Bench scene_bench renders it too).
+// Urgent calls are inverted — white text on black background.
+void buildScene(PitchInfo pitch, Scene& scene) {
+    callScene(pitch.line1, pitch.line2, pitch.urgent, scene);
+    snprintf(scene.badge[0].text, SCENE_TEXT_MAX, "%ddBm", lastRSSI);
+}
+
+void drawCallScreen(uint8_t cmd, PitchInfo pitch) {
+    Scene scene;
+    buildScene(pitch, scene);
+#ifdef PITCHCOMM_CALL_BITMAPS
+    scene.primary.text[0] = scene.detail.text[0] = '\0';    // prebuilt art below
+#endif
+    renderScene(panel, scene, callLayout);
+
+#ifdef PITCHCOMM_CALL_BITMAPS
+    const CallArt& art = callArtFor(cmd);
+    uint16_t ink = pitch.urgent ? GxEPD_WHITE : GxEPD_BLACK;
+    drawArt(art.line1, ink);
+    drawArt(art.line2, ink);
+#else
+    (void)cmd;
+#endif
+    
+    // Border — double for urgent
+    if (pitch.urgent) {
+        frame.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, GxEPD_WHITE);
+        frame.drawRect(2, 2, SCREEN_WIDTH - 4, SCREEN_HEIGHT - 4, GxEPD_WHITE);
+        frame.drawRect(4, 4, SCREEN_WIDTH - 8, SCREEN_HEIGHT - 8, GxEPD_WHITE);
+    } else {
+        frame.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, GxEPD_BLACK);
+        frame.drawRect(2, 2, SCREEN_WIDTH - 4, SCREEN_HEIGHT - 4, GxEPD_BLACK);
+    }
+}
+
+void displayPitchCall(uint8_t cmd, PitchInfo pitch) {
+    drawCallScreen(cmd, pitch);
+    
+    // Calls are always partial; ghost cleanup waits for an idle window
+    pushFrame(FAST_CALL_LUT ? REFRESH_FAST : REFRESH_PARTIAL);
 }
 
 void displayError(const char* msg) {
-    selectEPaper();
-    display.setFullWindow();
-    display.firstPage();
-    do {
-        display.fillScreen(GxEPD_WHITE);
-        display.setFont(&FreeSansBold9pt7b);
-        display.setTextColor(GxEPD_BLACK);
-        
-        int16_t x1, y1;
-        uint16_t w, h;
-        display.getTextBounds("RF ERROR", 0, 0, &x1, &y1, &w, &h);
-        display.setCursor((SCREEN_WIDTH - w) / 2, 40);
-        display.print("RF ERROR");
-        
-        display.setFont(&FreeSans9pt7b);
-        display.getTextBounds(msg, 0, 0, &x1, &y1, &w, &h);
-        display.setCursor((SCREEN_WIDTH - w) / 2, 70);
-        display.print(msg);
-        
-        display.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, GxEPD_BLACK);
-    } while (display.nextPage());
+    frame.fillScreen(GxEPD_WHITE);
+    frame.setFont(&FreeSansBold9pt7b);
+    frame.setTextColor(GxEPD_BLACK);
+    
+    int16_t x1, y1;
+    uint16_t w, h;
+    frame.getTextBounds("RF ERROR", 0, 0, &x1, &y1, &w, &h);
+    frame.setCursor((SCREEN_WIDTH - w) / 2, 40);
+    frame.print("RF ERROR");
+    
+    frame.setFont(&FreeSans9pt7b);
+    frame.getTextBounds(msg, 0, 0, &x1, &y1, &w, &h);
+    frame.setCursor((SCREEN_WIDTH - w) / 2, 70);
+    frame.print(msg);
+    
+    frame.drawRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, GxEPD_BLACK);
+    
+    pushFrame(REFRESH_FULL);
+}
+
+// ============================================================================
+// GHOST CLEANUP SCHEDULER
+// ============================================================================
+// A full refresh blocks for ~2 s, so it is never taken on a call. Wear
+// builds up one partial per call/standby update and is cleaned only when
+// the standby screen is due anyway:
+//   - hold expiry, once wear reaches PARTIAL_REFRESH_LIMIT
+//   - a long gap between batters, once wear reaches GHOST_IDLE_WEAR
+// Heavy back-to-back play can run past the limit; that costs some ghosting,
+// never call latency.
+
+bool ghostCleanupDue(bool holdExpired) {
+    if (holdExpired) return partialCount >= PARTIAL_REFRESH_LIMIT;
+    if (displayingCall || partialCount < GHOST_IDLE_WEAR) return false;
+    return millis() - lastCallTime >= GHOST_IDLE_GAP_MS;
+}
+
+void ghostCleanup() {
+    int wear = partialCount;
+    unsigned long t0 = millis();
+    displayStandby(true);
+    
+    Serial.print("[DISP] Ghost cleanup after ");
+    Serial.print(wear);
+    Serial.print(" partials, idle ");
+    Serial.print((millis() - lastCallTime) / 1000);
+    Serial.print("s, took ");
+    Serial.print(millis() - t0);
+    Serial.println("ms");
+}
+
+// ============================================================================
+// WAVEFORM BENCH — BUSY time of the stock and fast partial waveforms
+// ============================================================================
+// Alternates two calls `rounds` times per waveform and prints refresh()
+// time (update command + BUSY) for each, then leaves a clean standby
+// screen. Enable with LUT_BENCH or call from a test build.
+void lutBench(uint8_t rounds) {
+    static const uint8_t CMDS[2] = { CMD_FB_IN, CMD_CHANGE };
+    static const RefreshMode MODES[2] = { REFRESH_PARTIAL, REFRESH_FAST };
+    static const char* const NAMES[2] = { "stock", "fast " };
     
-    partialCount = 0;
+    Serial.println("[BENCH] Waveform refresh time (command + BUSY)");
+    display.epd2.resetStats();
+    for (uint8_t m = 0; m < 2; m++) {
+        for (uint8_t i = 0; i < rounds; i++) {
+            uint8_t cmd = CMDS[i & 1];
+            drawCallScreen(cmd, decodePitch(cmd));
+            pushFrame(MODES[m]);
+        }
+        const LatencyStats& stats = MODES[m] == REFRESH_FAST
+            ? display.epd2.fastStats() : display.epd2.standardStats();
+        Serial.print("[BENCH] ");
+        Serial.print(NAMES[m]);
+        Serial.print(" n=");
+        Serial.print(stats.count());
+        Serial.print(" min=");
+        Serial.print(stats.minUs() / 1000);
+        Serial.print("ms mean=");
+        Serial.print(stats.meanUs() / 1000);
+        Serial.print("ms max=");
+        Serial.print(stats.maxUs() / 1000);
+        Serial.println("ms");
+    }
+    displayStandby(true);
+}
+
+// ============================================================================
+// RADIO PROFILE — kept in flash, "profile <name>" on USB serial
+// ============================================================================
+ProfileStore   profileStore;
+ProfileConsole profileConsole;
+
+// Link adaptation and the sniff timing follow the radio's profile
+void followProfile(const RadioProfile& p) {
+    adr.setFamily(linkFamily(p));
+    listener.setModem(p.modem);
+}
+
+// From loop() only, like the link reports: retuning mid-refresh is not worth it
+void serviceProfile() {
+    uint8_t id;
+    if (!profileConsole.poll(Serial, id)) return;
+    const RadioProfile& p = radioProfile(id);
+    if (!profileStore.save(id)) Serial.println("[LORA] Profile not saved");
+    selectLoRa();
+    int16_t state = applyProfile(radio, p);
+    followProfile(p);
+    listener.startReceive();
+    Serial.print("[LORA] Profile ");
+    Serial.print(p.name);
+    Serial.print(" SF");
+    Serial.print(p.modem.sf);
+    Serial.print(" (");
+    Serial.print(state);
+    Serial.println(")");
 }
 
 // ============================================================================
@@ -375,8 +614,9 @@ bool initLoRa() {
     pinMode(RF_SW_PIN, OUTPUT);
     digitalWrite(RF_SW_PIN, HIGH);
     
+    const RadioProfile& profile = radioProfile(profileStore.load(RADIO_PROFILE));
     Serial.print("[LORA] Initializing SX1262...");
-    int state = radio.begin(RF_FREQ, RF_BW, RF_SF, RF_CR, RF_SYNC, RF_POWER, RF_PREAMBLE, RF_TCXO_V);
+    int state = beginProfile(radio, profile, RF_TCXO_V);
     
     if (state != RADIOLIB_ERR_NONE) {
         Serial.print(" FAILED: ");
@@ -387,40 +627,176 @@ bool initLoRa() {
     
     // DIO2 as RF switch control — CRITICAL for Wio-SX1262
     radio.setDio2AsRfSwitch(true);
-    
-    // Enable CRC
-    radio.setCRC(true);
+    followProfile(profile);
     
     // Set interrupt on DIO1
+    rxEvent.begin();
     radio.setPacketReceivedAction(rxISR);
     
-    // Start continuous receive
-    state = radio.startReceive();
+    // Start receive: continuous, or sniffing (RX_SNIFF_PREAMBLE)
+    state = listener.startReceive();
     if (state != RADIOLIB_ERR_NONE) {
         Serial.print("[LORA] RX start failed: ");
         Serial.println(state);
         return false;
     }
     
-    Serial.println("[LORA] RX active — listening on 915.0 MHz");
+    Serial.print("[LORA] RX active — ");
+    Serial.print(profile.name);
+    Serial.print(" on ");
+    Serial.print(profile.freqMhz, 1);
+    Serial.println(" MHz");
+    if (listener.sniffing()) {
+        Serial.print("[LORA] Sniff ");
+        Serial.print(listener.rxUs());
+        Serial.print(" us RX / ");
+        Serial.print(listener.sleepUs());
+        Serial.println(" us sleep");
+    }
     return true;
 }
 
 // ============================================================================
-// PACKET VALIDATION
+// RADIO SERVICE — runs from loop() and from inside every ePaper BUSY wait
 // ============================================================================
-bool validatePacket(uint8_t* data, size_t len) {
-    if (len != PKT_LENGTH) return false;
-    if (data[0] != PKT_MAGIC) return false;
-    if (data[1] != PKT_VERSION) return false;
-    if (data[2] != ADDR_CATCHER) return false;
+// Reads the packet DIO1 announced, queues a new call and re-arms RX at
+// once, so the radio is only deaf for the SPI readout.
+void serviceRadio() {
+    selectLoRa();
+    
+    uint8_t data[MAX_PACKET_LENGTH];
+    size_t len = radio.getPacketLength();
+    if (len > sizeof(data)) len = sizeof(data);
+    int state = radio.readData(data, len);
+    uint32_t isrUs = rxEvent.isrUs();
+    int16_t rssi = radio.getRSSI();
+    float snr = radio.getSNR();
+    listener.startReceive();
     
-    // XOR checksum over bytes 0..4
-    uint8_t xorCheck = 0;
-    for (int i = 0; i < PKT_LENGTH - 1; i++) {
-        xorCheck ^= data[i];
+    // FEC frames can still be recovered when the LoRa CRC fails
+    if (state == RADIOLIB_ERR_CRC_MISMATCH && len == FEC_LENGTH) {
+        state = RADIOLIB_ERR_NONE;
+    }
+    
+    if (state != RADIOLIB_ERR_NONE) {
+        Serial.print("[RX] Read error: ");
+        Serial.println(state);
+        return;
+    }
+    
+    LinkCommandView link(data, len);
+    if (link.valid()) {
+        if (adr.onCommand(link, (int16_t)(snr * 4), rssi, millis())) {
+            tuneLink(listener, adr);
+        }
+        Serial.print("[LINK] Step ");
+        Serial.print(adr.step());
+        Serial.print(" SF");
+        Serial.println(adr.current().sf);
+        return;
+    }
+    if (LinkReportView(data, len).valid()) return;     // another receiver's report
+    if (CallAckView(data, len).valid()) return;        // or ACK
+    
+    Serial.print("[RX] Packet: ");
+    for (size_t i = 0; i < len && i < 8; i++) {
+        Serial.print(data[i], HEX);
+        Serial.print(" ");
+    }
+    Serial.print(" RSSI=");
+    Serial.print(rssi);
+    Serial.print(" dBm wake=");
+    Serial.print(rxEvent.lastUs());
+    Serial.println("us");
+    
+    uint8_t fecBuf[CALL_LENGTH];
+    uint8_t fixed = 0;
+    CallView rx = openCall(data, len, fecBuf, &fixed);
+    if (fixed > 0) {
+        Serial.print("[RX] FEC corrected bits: ");
+        Serial.println(fixed);
+    }
+    if (!rx.wellFormed()) {
+        Serial.println("[RX] Invalid packet — checksum/format mismatch");
+        return;
+    }
+    adr.onTraffic(millis());
+    if (!rx.addressedTo(myAddress)) return;   // another device's call
+    // Duplicates too: a resend means the coach missed our ACK
+    ack.onCall(rx, rssi, millis(), callAckSlotMs(linkModem(adr.family(), adr.step())));
+    
+    // Duplicate suppression — coach sends triple-redundant packets
+    // (a single packet in FEC mode). Same window as the HUD, so the next
+    // call after a sequence wrap, or a repeat of an old call, still shows.
+    uint8_t seq = rx.seq();
+    uint8_t cmd = rx.cmd();
+    if (haveCall && seq == lastSeq && cmd == lastCmd && (millis() - lastRxTime < 500)) return;
+    haveCall   = true;
+    lastSeq    = seq;
+    lastCmd    = cmd;
+    lastRxTime = millis();
+    
+    if (callQueued) {
+        Serial.print("[CALL] superseded #");
+        Serial.print(nextCall.seq);
+        if (displayingCall) {
+            Serial.print(", glass still #");
+            Serial.println(shownSeq);
+        } else {
+            Serial.println(", glass on standby");
+        }
+    }
+    nextCall.cmd   = cmd;
+    nextCall.seq   = seq;
+    nextCall.rssi  = rssi;
+    nextCall.isrUs = isrUs;
+    callQueued = true;
+}
+
+// ============================================================================
+// LINK ADAPTATION — SNR reports to the coach, SF steps from it
+// ============================================================================
+// Commands are handled in serviceRadio() (BUSY waits included); reports go
+// out from loop() only, never mid-refresh. Home step again whenever the
+// coach goes quiet; see PitchCommLink.h.
+void serviceLink() {
+    selectLoRa();
+    if (sendLinkReport(listener, adr, millis(), rxISR)) {
+        Serial.print("[LINK] Report step ");
+        Serial.println(adr.step());
+    }
+    if (adr.fallback(millis())) {
+        tuneLink(listener, adr);
+        Serial.print("[LINK] Coach silent — back to SF");
+        Serial.println(adr.current().sf);
+    }
+}
+
+// ============================================================================
+// CALL ACK — answers calls the coach sent in ARQ mode (ver 0x02)
+// ============================================================================
+// Unlike reports, ACKs also go out mid-refresh: the coach's resend deadline
+// is far shorter than a refresh. See PitchCommArq.h.
+void serviceAck() {
+    if (!ack.due(millis())) return;
+    selectLoRa();
+    if (sendCallAck(listener, ack, millis(), rxISR)) {
+        Serial.print("[ACK] Sent #");
+        Serial.println(ack.acks());
+    }
+}
+
+// GxEPD2 calls this in place of delay(1) while it waits on EPAPER_BUSY.
+// The panel is refreshing with its CS high, so the bus is the radio's.
+void epaperBusy(const void*) {
+    if (rxEvent.wait(1)) {
+        serviceRadio();
+        selectEPaper();
+    }
+    if (ack.due(millis())) {
+        serviceAck();
+        selectEPaper();
     }
-    return (xorCheck == data[PKT_LENGTH - 1]);
 }
 
 // ============================================================================
@@ -449,6 +825,8 @@ void setup() {
     selectEPaper();
     display.init(0);    // 0 = no debug output on serial
     display.setRotation(1);   // Landscape — 250 wide × 122 tall
+    display.epd2.setBusyCallback(epaperBusy);
+    display.epd2.setFastFrames(FAST_LUT_FRAMES);
     Serial.println(" OK");
     
     // Boot screen (full refresh)
@@ -461,8 +839,12 @@ void setup() {
         while (1) { delay(1000); }  // Halt
     }
     
-    // Show standby screen
-    displayStandby();
+    if (LUT_BENCH) {
+        lutBench(10);
+    }
+    
+    // Show standby screen (boot screen was a full refresh)
+    displayStandby(false);
     systemReady = true;
     
     Serial.println("[SYS] System ready — awaiting pitch calls");
@@ -471,74 +853,58 @@ void setup() {
 // ============================================================================
 // MAIN LOOP
 // ============================================================================
+// One display update per pass. A refresh still returns only after BUSY
+// drops, but the radio is serviced throughout it (epaperBusy), so a call
+// that lands mid-refresh is queued and drawn on the very next pass.
 void loop() {
-    // Check for received packet
-    if (rxFlag) {
-        rxFlag = false;
+    // Sleep (WFE) until DIO1 fires or the idle tick passes
+    if (rxEvent.wait(callQueued ? 0 : IDLE_TICK_MS)) {
+        serviceRadio();
+    }
+    serviceAck();
+    serviceLink();
+    serviceProfile();
+    
+    if (callQueued) {
+        QueuedCall call = nextCall;
+        callQueued = false;
         
-        // Temporarily select LoRa for packet read
-        selectLoRa();
+        PitchInfo pitch = decodePitch(call.cmd);
+        lastRSSI = call.rssi;
         
-        uint8_t data[16];
-        size_t len = sizeof(data);
-        int state = radio.readData(data, len);
+        Serial.print("[CALL] #");
+        Serial.print(call.seq);
+        Serial.print(" ");
+        Serial.print(pitch.line1);
+        Serial.print(" ");
+        Serial.println(pitch.line2);
         
-        if (state == RADIOLIB_ERR_NONE) {
-            lastRSSI = radio.getRSSI();
-            
-            Serial.print("[RX] Packet: ");
-            for (size_t i = 0; i < len && i < 8; i++) {
-                Serial.print(data[i], HEX);
-                Serial.print(" ");
-            }
-            Serial.print(" RSSI=");
-            Serial.print(lastRSSI);
-            Serial.println(" dBm");
-            
-            if (validatePacket(data, len)) {
-                uint8_t cmd = data[3];
-                uint8_t seq = data[4];
-                
-                // Duplicate suppression — coach sends triple-redundant packets
-                if (seq != lastSeq) {
-                    lastSeq = seq;
-                    
-                    PitchInfo pitch = decodePitch(cmd);
-                    
-                    Serial.print("[CALL] ");
-                    Serial.print(pitch.line1);
-                    Serial.print(" ");
-                    Serial.println(pitch.line2);
-                    
-                    // Update ePaper display with pitch call
-                    displayPitchCall(pitch);
-                    
-                    lastCallTime = millis();
-                    displayingCall = true;
-                }
-            } else {
-                Serial.println("[RX] Invalid packet — checksum/format mismatch");
-            }
-        } else {
-            Serial.print("[RX] Read error: ");
-            Serial.println(state);
-        }
+        // Returns once BUSY drops, so the call is on the glass
+        displayPitchCall(call.cmd, pitch);
+        shownSeq = call.seq;
+        inkLatency.add(micros() - call.isrUs);
         
-        // Restart receive
-        selectLoRa();
-        radio.startReceive();
+        Serial.print("[CALL] ink=");
+        Serial.print(inkLatency.lastUs() / 1000);
+        Serial.print("ms worst=");
+        Serial.print(inkLatency.maxUs() / 1000);
+        Serial.print("ms wear=");
+        Serial.println(partialCount);
+        
+        lastCallTime = millis();
+        displayingCall = true;
+        return;     // idle work only on a pass with nothing to show
     }
     
-    // Revert to standby after hold time expires
+    // Revert to standby after hold time expires — cleanup rides along if due
     if (displayingCall && (millis() - lastCallTime > DISPLAY_HOLD_MS)) {
-        displayStandby();
+        if (ghostCleanupDue(true)) {
+            ghostCleanup();
+        } else {
+            displayStandby(false);
+        }
         displayingCall = false;
-        
-        // Restart receive after display update
-        selectLoRa();
-        radio.startReceive();
+    } else if (ghostCleanupDue(false)) {
+        ghostCleanup();
     }
-    
-    // Low-power idle
-    delay(10);
 }
@@ -7,8 +7,11 @@
  * Mount:     All-Star catcher mask — HUD configuration
  * 
  * RF LINK:   Matched to T-Deck Plus Coach Transmitter
- *            915.0 MHz | SF7 | BW125 | CR4/5 | Sync 0x34
+ *            LowLatency profile: 915.0 MHz | SF7 | BW125 | CR4/5 | Sync 0x34
+ *            "profile <name>" on USB serial stores another (PitchCommRadio.h)
  *            6-byte packet: [0xCC][0x01][0x01][CMD][SEQ][XOR]
+ *            14-byte FEC packet (Hamming 8,4 + CRC-8) decoded transparently
+ *            Optional RX duty cycle on a long coach preamble (RX_SNIFF_PREAMBLE)
  * 
  * NO VIBRATION — display-only pitch call system
  * 
@@ -19,8 +22,8 @@
  *   D3  = SX1262 BUSY
  *   D4  = SX1262 NSS (chip select)
  *   D5  = RF Switch (PE4259)
- *   D6  = OLED SDA (software I2C)
- *   D7  = OLED SCL (software I2C)
+ *   D6  = OLED SDA (TWIM1 + EasyDMA; U8g2 SW I2C at init)
+ *   D7  = OLED SCL (TWIM1 + EasyDMA; U8g2 SW I2C at init)
  *   D8  = SPI SCK  (to SX1262)
  *   D9  = SPI MISO (to SX1262)
  *   D10 = SPI MOSI (to SX1262)
@@ -30,6 +33,18 @@
 #include <SPI.h>
 #include <RadioLib.h>
 #include <U8g2lib.h>
+#include <PitchCommProtocol.h>
+#include <PitchCommFec.h>
+#include <PitchCommRxEvent.h>
+#include <PitchCommTwimOled.h>
+#include <PitchCommScene.h>
+#include <PitchCommLink.h>
+#include <PitchCommArq.h>
+#include <PitchCommSniff.h>
+#include <PitchCommRadio.h>
+#if __has_include("CallBitmaps.h")
+#include "CallBitmaps.h"        // generated by Host_Bench font_compiler
+#endif
 
 // ============================================================================
 // HARDWARE PIN DEFINITIONS — XIAO nRF52840 + Wio-SX1262
@@ -42,57 +57,56 @@
 
 #define OLED_SDA        D6
 #define OLED_SCL        D7
+#define OLED_I2C_HZ     400000  // TWIM rate; 1000000 works on short tethers, out of spec
 
 // ============================================================================
-// RF PARAMETERS — IDENTICAL TO T-DECK PLUS COACH TRANSMITTER
+// RF PROFILE — IDENTICAL TO T-DECK PLUS COACH TRANSMITTER
 // ============================================================================
-#define RF_FREQ         915.0
-#define RF_BW           125.0
-#define RF_SF           7
-#define RF_CR           5
-#define RF_SYNC         0x34
-#define RF_POWER        22
-#define RF_PREAMBLE     8
+// Factory setting (PitchCommRadio.h); a profile stored over USB serial
+// takes precedence.
+#define RADIO_PROFILE   PROFILE_LOW_LATENCY
 #define RF_TCXO_V       1.8
 
-// ============================================================================
-// PACKET PROTOCOL — MATCHED TO COACH TX
-// ============================================================================
-#define PKT_MAGIC       0xCC
-#define PKT_VERSION     0x01
-#define ADDR_CATCHER    0x01
-#define PKT_LENGTH      6
+#define IDLE_TICK_MS    100     // loop() idle work runs at least this often
+
+// Link adaptation (PitchCommLink.h): report slot among the call receivers
+#define LINK_NODE       0
+
+// Call addressing: device id (unicast and mask bit) and groups joined.
+// ADDR_PITCHER on the pitcher's unit, ADDR_FIELDER + n on a fielder's.
+#define CALL_DEVICE     ADDR_CATCHER
+#define CALL_GROUPS     ((1UL << GROUP_BATTERY) | (1UL << GROUP_DEFENSE))
+
+// RX duty cycle (PitchCommSniff.h): the coach's preamble in symbols, which
+// must match the coach. Longer saves more current and delays every call
+// more: 64 at SF7 = +57 ms, radio awake 25 %. 0 = always listening.
+#define RX_SNIFF_PREAMBLE   0
 
 // ============================================================================
-// COMMAND TABLE — MATCHED TO T-DECK PLUS COACH TRANSMITTER
+// PACKET PROTOCOL + COMMAND TABLE — see PitchCommProtocol.h (shared with TX)
 // ============================================================================
-#define CMD_FB_IN       0x01
-#define CMD_FB_OUT      0x02
-#define CMD_CURVE       0x03
-#define CMD_CHANGE      0x04
-#define CMD_SLIDER      0x05
-#define CMD_CUTTER      0x06
-#define CMD_SPLIT       0x07
-#define CMD_SCREW       0x08
-#define CMD_PICK1       0x09
-#define CMD_PICK2       0x0A
-#define CMD_PITCHOUT    0x10
-#define CMD_TIMEOUT     0xFF
+using namespace pitchcomm;
 
 // ============================================================================
-// DISPLAY — HiLetgo 0.49" SSD1306 64x32 via Software I2C
+// DISPLAY — HiLetgo 0.49" SSD1306 64x32
 // ============================================================================
+// U8g2 draws into its full buffer and runs the init sequence over software
+// I2C; after that, frames go out through the hardware TWIM with EasyDMA
+// and flushDisplay() returns as soon as the transfer is started.
 U8G2_SSD1306_64X32_1F_F_SW_I2C display(
     U8G2_R0,
     /* clock=*/ OLED_SCL,
     /* data=*/  OLED_SDA,
     /* reset=*/ U8X8_PIN_NONE
 );
+TwimOled<64, 32> oled;
 
 // ============================================================================
 // RADIO — SX1262
 // ============================================================================
 SX1262 radio = new Module(LORA_NSS, LORA_DIO1, LORA_RESET, LORA_BUSY);
+// Re-arms RX: continuous, or sniffing when RX_SNIFF_PREAMBLE is set
+SniffListener<SX1262> listener(radio, MODEM_CALL_SF7, RX_SNIFF_PREAMBLE);
 
 // ============================================================================
 // PITCH DISPLAY LOOKUP
@@ -123,7 +137,8 @@ const uint8_t CALL_COUNT = sizeof(callTable) / sizeof(callTable[0]);
 // ============================================================================
 // STATE
 // ============================================================================
-volatile bool   rxFlag      = false;
+RxEvent         rxEvent;                // DIO1 ISR -> loop() wakeup
+const CallAddress myAddress = { CALL_DEVICE, CALL_GROUPS };
 uint8_t         lastSeq     = 0;
 uint8_t         lastCmd     = 0;
 int16_t         lastRSSI    = 0;
@@ -138,41 +153,138 @@ uint32_t        errCount    = 0;
 // ISR
 // ============================================================================
 void onReceive() {
-    rxFlag = true;
+    rxEvent.notifyFromIsr();
 }
 
 // ============================================================================
-// DISPLAY FUNCTIONS
+// LINK ADAPTATION — SNR reports to the coach, SF steps from it
 // ============================================================================
+// Home step again whenever the coach goes quiet; see PitchCommLink.h.
+LinkFollower adr(LINK_CALL, LINK_NODE);
 
-void showCall(const char* line1, const char* line2, bool invert) {
-    display.clearBuffer();
+void serviceLink() {
+    if (sendLinkReport(listener, adr, millis(), onReceive)) {
+        Serial.printf("[LINK] Report step %u\n", adr.step());
+    }
+    if (adr.fallback(millis())) {
+        tuneLink(listener, adr);
+        Serial.printf("[LINK] Coach silent — back to SF%u\n", adr.current().sf);
+    }
+}
 
-    if (invert) {
-        display.drawBox(0, 0, 64, 32);
-        display.setDrawColor(0);
-    } else {
-        display.setDrawColor(1);
+// ============================================================================
+// CALL ACK — answers calls the coach sent in ARQ mode (ver 0x02)
+// ============================================================================
+// Same node id and slot order as the link reports; see PitchCommArq.h.
+CallAcker ack(LINK_NODE);
+
+void serviceAck() {
+    if (sendCallAck(listener, ack, millis(), onReceive)) {
+        Serial.printf("[ACK] Sent #%lu\n", (unsigned long)ack.acks());
     }
+}
+
+// ============================================================================
+// RADIO PROFILE — kept in flash, "profile <name>" on USB serial
+// ============================================================================
+ProfileStore   profileStore;
+ProfileConsole profileConsole;
 
-    if (line2[0] != '\0') {
-        // Two-line layout
-        display.setFont(u8g2_font_helvB14_tr);
-        int16_t w1 = display.getStrWidth(line1);
-        display.drawStr((64 - w1) / 2, 16, line1);
+// Link adaptation and the sniff timing follow the radio's profile
+void followProfile(const RadioProfile& p) {
+    adr.setFamily(linkFamily(p));
+    listener.setModem(p.modem);
+}
+
+void serviceProfile() {
+    uint8_t id;
+    if (!profileConsole.poll(Serial, id)) return;
+    const RadioProfile& p = radioProfile(id);
+    if (!profileStore.save(id)) Serial.println("[RADIO] Profile not saved");
+    int16_t state = applyProfile(radio, p);
+    followProfile(p);
+    listener.startReceive();
+    Serial.printf("[RADIO] Profile %s SF%u SYNC:0x%02X (%d)\n", p.name, p.modem.sf, p.syncWord, state);
+}
 
-        display.setFont(u8g2_font_helvB10_tr);
-        int16_t w2 = display.getStrWidth(line2);
-        display.drawStr((64 - w2) / 2, 30, line2);
+// ============================================================================
+// DISPLAY FUNCTIONS
+// ============================================================================
+void flushDisplay() {
+    if (oled.ready()) {
+        oled.send(display.getBufferPtr());
     } else {
-        // Single-line — vertically centered
-        display.setFont(u8g2_font_helvB14_tr);
-        int16_t w1 = display.getStrWidth(line1);
-        display.drawStr((64 - w1) / 2, 22, line1);
+        display.sendBuffer();
     }
+}
 
-    display.setDrawColor(1);
-    display.sendBuffer();
+
+// Call and splash layouts are mirrored in Host_Bench/src/font_compiler.cpp.
+// Once it has generated CallBitmaps.h, every known call is a prebuilt frame
+// copied into U8g2's buffer and the helvB fonts are no longer linked.
+const uint8_t* callScreen(uint8_t cmd) {
+#ifdef PITCHCOMM_CALL_BITMAPS
+    for (uint8_t i = 0; i < CALL_SCREEN_COUNT; i++) {
+        if (callScreens[i].cmd == cmd) return callScreens[i].frame;
+    }
+#else
+    (void)cmd;
+#endif
+    return NULL;
+}
+
+// Call layout (Scene slots; font_compiler mirrors it). With CallBitmaps.h
+// helvB14 / helvB10 are not linked: only unknown commands are drawn, with
+// unknownLayout in the status-screen font.
+enum { FONT_LINE1, FONT_LINE2, FONT_STATUS };
+
+const uint8_t* const sceneFonts[] = {
+#ifdef PITCHCOMM_CALL_BITMAPS
+    NULL, NULL,
+#else
+    u8g2_font_helvB14_tr, u8g2_font_helvB10_tr,
+#endif
+    u8g2_font_5x7_tr
+};
+
+const SceneStyle callStyle = {
+    { FONT_LINE1, SCENE_CENTER, 32, 16 },   // line 1 over line 2
+    { FONT_LINE1, SCENE_CENTER, 32, 22 },   // line 1 alone, vertically centred
+    { FONT_LINE2, SCENE_CENTER, 32, 30 },   // line 2
+};
+
+const SceneLayout callLayout = {
+    &callStyle, 1, false, { SCENE_NO_SLOT, SCENE_NO_SLOT, SCENE_NO_SLOT }
+};
+
+#ifdef PITCHCOMM_CALL_BITMAPS
+const SceneStyle unknownStyle = {
+    { FONT_STATUS, SCENE_CENTER, 32, 14 },  // line 1 over line 2
+    { FONT_STATUS, SCENE_CENTER, 32, 14 },  // line 1 alone
+    { FONT_STATUS, SCENE_CENTER, 32, 26 },  // line 2
+};
+
+const SceneLayout unknownLayout = {
+    &unknownStyle, 1, false, { SCENE_NO_SLOT, SCENE_NO_SLOT, SCENE_NO_SLOT }
+};
+#endif
+
+SceneBackend<U8G2> panel(display, sceneFonts);
+
+void showCall(uint8_t cmd, const char* line1, const char* line2, bool invert) {
+    const uint8_t* frame = callScreen(cmd);
+    if (frame != NULL) {
+        memcpy(display.getBufferPtr(), frame, oled.FRAME_BYTES);
+    } else {
+        Scene scene;
+        callScene(line1, line2, invert, scene);
+#ifdef PITCHCOMM_CALL_BITMAPS
+        renderScene(panel, scene, unknownLayout);
+#else
+        renderScene(panel, scene, callLayout);
+#endif
+    }
+    flushDisplay();
 
     showing   = true;
     clearTime = millis() + 5000;
@@ -197,11 +309,14 @@ void showStandby() {
         }
     }
 
-    display.sendBuffer();
+    flushDisplay();
     showing = false;
 }
 
 void showSplash() {
+#ifdef PITCHCOMM_CALL_BITMAPS
+    memcpy(display.getBufferPtr(), splashFrame, oled.FRAME_BYTES);
+#else
     display.clearBuffer();
     display.setDrawColor(1);
     display.setFont(u8g2_font_helvB10_tr);
@@ -210,7 +325,8 @@ void showSplash() {
     display.setFont(u8g2_font_5x7_tr);
     const char* v = "v2.0";
     display.drawStr((64 - display.getStrWidth(v)) / 2, 28, v);
-    display.sendBuffer();
+#endif
+    flushDisplay();
     delay(1200);
 }
 
@@ -219,7 +335,7 @@ void showSyncing() {
     display.setFont(u8g2_font_5x7_tr);
     display.drawStr(2, 14, "RF SYNC");
     display.drawStr(2, 26, "915 MHz");
-    display.sendBuffer();
+    flushDisplay();
 }
 
 void showError(const char* msg) {
@@ -230,24 +346,36 @@ void showError(const char* msg) {
     display.drawStr(2, 10, "ERROR");
     display.drawStr(2, 24, msg);
     display.setDrawColor(1);
-    display.sendBuffer();
+    flushDisplay();
 }
 
-// ============================================================================
-// PACKET VALIDATION
-// ============================================================================
-bool validatePacket(uint8_t* pkt, uint8_t len) {
-    if (len != PKT_LENGTH)      return false;
-    if (pkt[0] != PKT_MAGIC)    return false;
-    if (pkt[1] != PKT_VERSION)  return false;
-    if (pkt[2] != ADDR_CATCHER) return false;
+// Times the same frame over U8g2's SW I2C and over TWIM, then hands the
+// panel to TWIM for good
+void startDisplayDma() {
+    uint32_t t0 = micros();
+    display.sendBuffer();
+    uint32_t swUs = micros() - t0;
+
+    if (!oled.begin(OLED_SDA, OLED_SCL, OLED_I2C_HZ, display.getU8x8()->x_offset)) {
+        Serial.printf("[DISPLAY] SW I2C %uB frame %luus (no TWIM)\n",
+            oled.FRAME_BYTES, (unsigned long)swUs);
+        return;
+    }
 
-    uint8_t chk = pkt[0] ^ pkt[1] ^ pkt[2] ^ pkt[3] ^ pkt[4];
-    if (pkt[5] != chk)          return false;
+    t0 = micros();
+    oled.send(display.getBufferPtr());
+    uint32_t cpuUs = micros() - t0;
+    oled.wait();
+    uint32_t hwUs = micros() - t0;
 
-    return true;
+    Serial.printf("[DISPLAY] %uB frame: SW I2C %luus (CPU blocked) | TWIM %lukHz %luus, CPU %luus\n",
+        oled.FRAME_BYTES, (unsigned long)swUs, (unsigned long)(OLED_I2C_HZ / 1000),
+        (unsigned long)hwUs, (unsigned long)cpuUs);
 }
 
+// ============================================================================
+// CALL LOOKUP
+// ============================================================================
 const CallInfo* lookupCall(uint8_t cmd) {
     for (uint8_t i = 0; i < CALL_COUNT; i++) {
         if (callTable[i].cmd == cmd) return &callTable[i];
@@ -259,33 +387,65 @@ const CallInfo* lookupCall(uint8_t cmd) {
 // PROCESS RECEIVED PACKET
 // ============================================================================
 void processPacket() {
-    uint8_t pkt[16];
-    int state = radio.readData(pkt, PKT_LENGTH);
-
-    if (state != RADIOLIB_ERR_NONE) {
+    uint8_t pkt[MAX_PACKET_LENGTH];
+    size_t len = radio.getPacketLength();
+    if (len > sizeof(pkt)) len = sizeof(pkt);
+    int state = radio.readData(pkt, len);
+
+    // FEC frames can still be recovered when the LoRa CRC fails
+    bool fecFrame = (len == FEC_LENGTH);
+    if (state != RADIOLIB_ERR_NONE
+        && !(fecFrame && state == RADIOLIB_ERR_CRC_MISMATCH)) {
         Serial.printf("[RX] READ ERR: %d\n", state);
         errCount++;
-        radio.startReceive();
+        listener.startReceive();
         return;
     }
 
     lastRSSI = radio.getRSSI();
     lastSNR  = radio.getSNR();
 
-    if (!validatePacket(pkt, PKT_LENGTH)) {
-        Serial.printf("[RX] BAD PKT: %02X %02X %02X %02X %02X %02X\n",
-            pkt[0], pkt[1], pkt[2], pkt[3], pkt[4], pkt[5]);
+    LinkCommandView link(pkt, len);
+    if (link.valid()) {
+        if (adr.onCommand(link, (int16_t)(lastSNR * 4), lastRSSI, millis())) {
+            tuneLink(listener, adr);
+        } else {
+            listener.startReceive();
+        }
+        Serial.printf("[LINK] Step %u SF%u SNR:%.1f\n", adr.step(), adr.current().sf, lastSNR);
+        return;
+    }
+    if (LinkReportView(pkt, len).valid()        // another receiver's report
+        || CallAckView(pkt, len).valid()) {     // or ACK
+        listener.startReceive();
+        return;
+    }
+
+    uint8_t fecBuf[CALL_LENGTH];
+    uint8_t fixed = 0;
+    CallView rx = openCall(pkt, len, fecBuf, &fixed);
+    if (!rx.wellFormed()) {
+        Serial.printf("[RX] BAD PKT (%u):", (unsigned)len);
+        for (size_t i = 0; i < len && i < CALL_LENGTH; i++) Serial.printf(" %02X", pkt[i]);
+        Serial.println();
         errCount++;
-        radio.startReceive();
+        listener.startReceive();
         return;
     }
 
-    uint8_t cmd = pkt[3];
-    uint8_t seq = pkt[4];
+    adr.onTraffic(millis());
+    if (!rx.addressedTo(myAddress)) {           // another device's call
+        listener.startReceive();
+        return;
+    }
+    // Duplicates too: a resend means the coach missed our ACK
+    ack.onCall(rx, lastRSSI, millis(), callAckSlotMs(linkModem(adr.family(), adr.step())));
+    uint8_t cmd = rx.cmd();
+    uint8_t seq = rx.seq();
 
-    // Duplicate suppression — coach sends 3 copies per call
+    // Duplicate suppression — coach sends 3 copies per call (1 in FEC mode)
     if (seq == lastSeq && cmd == lastCmd && (millis() - lastRxTime < 500)) {
-        radio.startReceive();
+        listener.startReceive();
         return;
     }
 
@@ -296,18 +456,22 @@ void processPacket() {
 
     const CallInfo* call = lookupCall(cmd);
 
+    if (fixed > 0) {
+        Serial.printf("[RX] FEC corrected %d bit(s)\n", fixed);
+    }
+
     if (call != NULL) {
         Serial.printf("[RX] %s %s (0x%02X) SEQ:%d RSSI:%d SNR:%.1f\n",
             call->line1, call->line2, cmd, seq, lastRSSI, lastSNR);
-        showCall(call->line1, call->line2, call->invert);
+        showCall(cmd, call->line1, call->line2, call->invert);
     } else {
         Serial.printf("[RX] UNK 0x%02X SEQ:%d RSSI:%d\n", cmd, seq, lastRSSI);
         char hexBuf[6];
         snprintf(hexBuf, sizeof(hexBuf), "0x%02X", cmd);
-        showCall(hexBuf, "???", true);
+        showCall(cmd, hexBuf, "???", true);
     }
 
-    radio.startReceive();
+    listener.startReceive();
 }
 
 // ============================================================================
@@ -319,8 +483,8 @@ bool initRadio() {
     pinMode(RF_SW_PIN, OUTPUT);
     digitalWrite(RF_SW_PIN, HIGH);
 
-    int state = radio.begin(RF_FREQ, RF_BW, RF_SF, RF_CR,
-                            RF_SYNC, RF_POWER, RF_PREAMBLE, RF_TCXO_V);
+    const RadioProfile& profile = radioProfile(profileStore.load(RADIO_PROFILE));
+    int state = beginProfile(radio, profile, RF_TCXO_V);
 
     if (state != RADIOLIB_ERR_NONE) {
         Serial.printf("[RADIO] INIT FAIL: %d\n", state);
@@ -329,17 +493,23 @@ bool initRadio() {
 
     radio.setDio2AsRfSwitch(true);
     radio.setCurrentLimit(140.0);
-    radio.setCRC(2);
+    followProfile(profile);
+    rxEvent.begin();
     radio.setDio1Action(onReceive);
 
-    state = radio.startReceive();
+    state = listener.startReceive();
     if (state != RADIOLIB_ERR_NONE) {
         Serial.printf("[RADIO] RX START FAIL: %d\n", state);
         return false;
     }
 
-    Serial.printf("[RADIO] OK %.1fMHz SF%d BW%.0f CR4/%d SYNC:0x%02X\n",
-        RF_FREQ, RF_SF, RF_BW, RF_CR, RF_SYNC);
+    Serial.printf("[RADIO] OK %s %.1fMHz SF%d BW%.0f CR4/%d SYNC:0x%02X\n",
+        profile.name, profile.freqMhz, profile.modem.sf, profile.modem.bwHz / 1000.0,
+        profile.modem.cr, profile.syncWord);
+    if (listener.sniffing()) {
+        Serial.printf("[RADIO] Sniff %lu us RX / %lu us sleep\n",
+            (unsigned long)listener.rxUs(), (unsigned long)listener.sleepUs());
+    }
     return true;
 }
 
@@ -363,6 +533,7 @@ void setup() {
     Serial.println("[DISPLAY] SSD1306 64x32 OK");
 
     showSplash();
+    startDisplayDma();
     showSyncing();
 
     if (!initRadio()) {
@@ -379,10 +550,13 @@ void setup() {
 // MAIN LOOP
 // ============================================================================
 void loop() {
-    if (rxFlag) {
-        rxFlag = false;
+    // Sleep (WFE) until DIO1 fires or the idle tick passes
+    if (rxEvent.wait(IDLE_TICK_MS)) {
         processPacket();
     }
+    serviceAck();
+    serviceLink();
+    serviceProfile();
 
     if (showing && millis() > clearTime) {
         showStandby();
@@ -399,13 +573,13 @@ void loop() {
             display.setFont(u8g2_font_5x7_tr);
             display.drawStr(4, 14, "NO LINK");
             display.drawStr(4, 26, "CHECK TX");
-            display.sendBuffer();
+            flushDisplay();
             showing = false;
         }
 
-        Serial.printf("[STAT] RX:%lu ERR:%lu RSSI:%d SNR:%.1f\n",
-            rxCount, errCount, lastRSSI, lastSNR);
+        Serial.printf("[STAT] RX:%lu ERR:%lu RSSI:%d SNR:%.1f WAKE:%lu/%lu/%luus\n",
+            rxCount, errCount, lastRSSI, lastSNR,
+            (unsigned long)rxEvent.minUs(), (unsigned long)rxEvent.meanUs(),
+            (unsigned long)rxEvent.maxUs());
     }
-
-    delay(1);
 }
@@ -0,0 +1,81 @@
+/*
+ * ============================================================================
+ * PITCHCOMM AIRTIME — LoRa time-on-air for SX126x / SX127x
+ * ============================================================================
+ * Semtech AN1200.13 formula, integer arithmetic only, constexpr so profile
+ * tables can be checked at compile time:
+ *
+ *   Tsym     = 2^SF / BW
+ *   Tpre     = (Npreamble + 4.25) * Tsym
+ *   Npayload = 8 + max(ceil((8PL - 4SF + 28 + 16CRC - 20IH) / (4(SF - 2DE))), 0) * CR
+ *
+ * CR is the RadioLib coding-rate denominator (5..8 for 4/5..4/8). DE (low
+ * data rate optimize) follows RadioLib's automatic rule: on when Tsym >= 16ms.
+ * Valid for SF7..SF12; the SX126x SF5/SF6 variant is not modelled.
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_AIRTIME_H
+#define PITCHCOMM_AIRTIME_H
+
+#include <stdint.h>
+
+namespace pitchcomm {
+
+struct LoRaModem {
+  uint8_t  sf;              // 7..12
+  uint32_t bwHz;            // 125000, 250000, 500000 ...
+  uint8_t  cr;              // 5..8 → 4/5..4/8
+  uint16_t preamble;        // programmed preamble symbols
+  bool     crc;             // payload CRC on
+  bool     implicitHeader;  // no explicit PHY header
+};
+
+// Symbol duration in nanoseconds
+constexpr uint32_t symbolTimeNs(uint8_t sf, uint32_t bwHz) {
+  return (uint32_t)(((uint64_t)1000000000ULL << sf) / bwHz);
+}
+
+constexpr bool lowDataRateOptimize(const LoRaModem& m) {
+  return symbolTimeNs(m.sf, m.bwHz) >= 16000000UL;
+}
+
+namespace detail {
+constexpr int32_t ceilDiv(int32_t num, int32_t den) {
+  return num <= 0 ? 0 : (num + den - 1) / den;
+}
+}
+
+constexpr uint32_t payloadSymbols(const LoRaModem& m, uint8_t payloadLen) {
+  return 8 + (uint32_t)detail::ceilDiv(
+      8 * (int32_t)payloadLen - 4 * m.sf + 28 + (m.crc ? 16 : 0) - (m.implicitHeader ? 20 : 0),
+      4 * (m.sf - (lowDataRateOptimize(m) ? 2 : 0))) * m.cr;
+}
+
+// Preamble in quarter symbols: (Npreamble + 4.25) * 4
+constexpr uint32_t preambleQuarterSymbols(const LoRaModem& m) {
+  return 4UL * m.preamble + 17;
+}
+
+// Total time on air in microseconds
+constexpr uint32_t timeOnAirUs(const LoRaModem& m, uint8_t payloadLen) {
+  return (uint32_t)(((uint64_t)symbolTimeNs(m.sf, m.bwHz)
+                     * (preambleQuarterSymbols(m) + 4 * payloadSymbols(m, payloadLen))
+                     / 4 + 500) / 1000);
+}
+
+// ============================================================================
+// MODEMS IN USE TODAY
+// ============================================================================
+// setupLoRa() on Heltec / Stick / T-Watch (RadioLib default CRC on)
+constexpr LoRaModem MODEM_SIGNAL_SF10 = { 10, 125000, 8, 8, true, false };
+// initRadio() / initLoRa() on the XIAO HUD and armband
+constexpr LoRaModem MODEM_CALL_SF7    = {  7, 125000, 5, 8, true, false };
+
+// Reference values from the Semtech LoRa calculator
+static_assert(timeOnAirUs(MODEM_SIGNAL_SF10, 8) == 296960, "SF10 8-byte airtime");
+static_assert(timeOnAirUs(MODEM_CALL_SF7, 6)   == 36096,  "SF7 6-byte airtime");
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_AIRTIME_H
@@ -0,0 +1,197 @@
+/*
+ * ============================================================================
+ * PITCHCOMM ARQ — acknowledged call delivery with measured round trip
+ * ============================================================================
+ * Call frames normally go out as three blind copies, and the coach never
+ * learns whether the catcher got the call. In ARQ mode the coach sends one
+ * copy with ver 0x02 (encodeCall(..., true)). Every receiver answers with a
+ * 4-byte CALL ACK carrying the seq and the RSSI it heard the call at:
+ *
+ *   coach     CALL ──────────────────────────────────── (resend) CALL ...
+ *   node 0          ACK
+ *   node 1               ACK          node n answers n slots after the call
+ *                        |<-- deadline -->|
+ *
+ * If an expected receiver has not acked by the deadline, the coach sends
+ * the call again, up to ARQ_MAX_SENDS times in all. At worst that is the
+ * airtime of the three blind copies. Usually it is one copy plus the ACKs.
+ * Round trip is measured per receiver from the first send to its ACK, so a
+ * resend shows up in the number.
+ *
+ *   deadline = call airtime + ARQ_TURNAROUND_MS + slots * callAckSlotMs()
+ *
+ * Receivers ACK duplicates too: a resend means their ACK was lost. The mode
+ * is the coach's choice per call; receivers never ACK a ver 0x01 frame.
+ * Host_Bench arq_sim compares it with blind copies on the HUD and armband.
+ *
+ * Receiver usage (see the HUD's processPacket() / serviceAck()):
+ *   pitchcomm::CallAcker ack(LINK_NODE);
+ *   if (call.valid()) ack.onCall(call, rssi, millis(), callAckSlotMs(modem));
+ *   sendCallAck(radio, ack, millis(), onReceive);     // from loop()
+ *
+ * Coach usage (the T-Deck TX source is not in this tree; see arq_sim):
+ *   pitchcomm::CallArq arq(modem, 0x03);              // nodes 0 and 1 ack
+ *   arq.start(encodeCall(ADDR_CATCHER, cmd, seq, true), millis());
+ *   if (arq.poll(millis(), frame)) send frame;        // every pass
+ *   if (ack.valid()) arq.onAck(ack, millis());
+ *   if (!arq.pending()) show arq.rttMs(node) per node
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_ARQ_H
+#define PITCHCOMM_ARQ_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <PitchCommProtocol.h>
+#include <PitchCommAirtime.h>
+#include <PitchCommReply.h>
+
+namespace pitchcomm {
+
+const uint8_t  ARQ_MAX_NODES     = 8;      // node ids 0..7 (3 bits in the ACK)
+const uint8_t  ARQ_MAX_SENDS     = 3;      // first send included
+const uint32_t ARQ_TURNAROUND_MS = 40;     // receiver read, draw and loop pass
+const uint32_t ARQ_GUARD_MS      = 20;     // between ACK slots
+
+// One ACK plus guard: node n answers n slots after the call
+constexpr uint32_t callAckSlotMs(const LoRaModem& m) {
+  return timeOnAirUs(m, CALL_ACK_LENGTH) / 1000 + 1 + ARQ_GUARD_MS;
+}
+
+// ============================================================================
+// RECEIVER SIDE
+// ============================================================================
+class CallAcker {
+public:
+  explicit CallAcker(uint8_t node)
+    : _node(node), _seq(0), _rssi(0), _due(false), _dueMs(0), _acks(0) {}
+
+  uint8_t  node() const { return _node; }
+  uint32_t acks() const { return _acks; }
+
+  // A valid call, duplicates included. Schedules the ACK if asked for one.
+  void onCall(const CallView& call, int16_t rssi, uint32_t nowMs, uint32_t slotMs) {
+    if (!call.ackRequested()) return;
+    _seq   = call.seq();
+    _rssi  = (int8_t)(rssi < -128 ? -128 : (rssi > 127 ? 127 : rssi));
+    _dueMs = nowMs + _node * slotMs;
+    _due   = true;
+  }
+
+  bool due(uint32_t nowMs) const { return _due && (int32_t)(nowMs - _dueMs) >= 0; }
+
+  bool ackDue(uint32_t nowMs, CallAckFrame& out) {
+    if (!due(nowMs)) return false;
+    _due = false;
+    _acks++;
+    out = encodeCallAck(_node, _seq, _rssi);
+    return true;
+  }
+
+private:
+  uint8_t  _node, _seq;
+  int8_t   _rssi;
+  bool     _due;
+  uint32_t _dueMs;
+  uint32_t _acks;
+};
+
+// Send a due ACK (sendReply(): DIO1 detached, RX re-armed)
+template <typename Radio>
+bool sendCallAck(Radio& radio, CallAcker& acker, uint32_t nowMs, void (*dio1)(void)) {
+  CallAckFrame ack;
+  if (!acker.ackDue(nowMs, ack)) return false;
+  sendReply(radio, ack.bytes, CALL_ACK_LENGTH, dio1);
+  return true;
+}
+
+// ============================================================================
+// COACH SIDE
+// ============================================================================
+class CallArq {
+public:
+  // expected: bitmask of the node ids that must ACK each call
+  CallArq(const LoRaModem& modem, uint8_t expected)
+    : _modem(modem), _expected(expected), _acked(0), _sends(0), _pending(false),
+      _firstMs(0), _deadlineMs(0), _calls(0), _confirmed(0), _resends(0),
+      _unconfirmed(0) {
+    _slots = 0;
+    for (uint8_t i = 0; i < ARQ_MAX_NODES; i++) {
+      if (expected & (1 << i)) _slots = (uint8_t)(i + 1);
+      _rttMs[i] = 0;
+      _rssi[i]  = 0;
+    }
+  }
+
+  // The coach retuned (link adaptation): deadlines follow the new airtime
+  void setModem(const LoRaModem& modem) { _modem = modem; }
+
+  // A new call; an unfinished one is dropped and counted unconfirmed
+  void start(const CallFrame& frame, uint32_t nowMs) {
+    if (_pending) _unconfirmed++;
+    _frame   = frame;
+    _acked   = 0;
+    _sends   = 0;
+    _pending = true;
+    _firstMs = nowMs;
+    _calls++;
+    for (uint8_t i = 0; i < ARQ_MAX_NODES; i++) _rttMs[i] = 0;
+  }
+
+  // The frame to send now, if any. Call every pass.
+  bool poll(uint32_t nowMs, CallFrame& out) {
+    if (!_pending) return false;
+    if (_sends > 0 && (int32_t)(nowMs - _deadlineMs) < 0) return false;
+    if (_sends == ARQ_MAX_SENDS) {
+      _pending = false;
+      _unconfirmed++;
+      return false;
+    }
+    if (_sends > 0) _resends++;
+    _sends++;
+    _deadlineMs = nowMs + timeOnAirUs(_modem, CALL_LENGTH) / 1000 + 1
+                + ARQ_TURNAROUND_MS + _slots * callAckSlotMs(_modem);
+    out = _frame;
+    return true;
+  }
+
+  void onAck(const CallAckView& ack, uint32_t nowMs) {
+    uint8_t bit = (uint8_t)(1 << ack.node());
+    if (!_pending || ack.seq() != CallView(_frame.bytes, CALL_LENGTH).seq()
+        || !(_expected & bit) || (_acked & bit)) return;
+    _acked |= bit;
+    _rttMs[ack.node()] = nowMs - _firstMs;
+    _rssi[ack.node()]  = ack.rssi();
+    if (_acked == _expected) {
+      _pending = false;
+      _confirmed++;
+    }
+  }
+
+  // Waiting for ACKs: other transmissions would step on them
+  bool     pending() const             { return _pending; }
+  uint8_t  acked() const               { return _acked; }
+  uint8_t  sends() const               { return _sends; }
+  uint32_t rttMs(uint8_t node) const   { return node < ARQ_MAX_NODES ? _rttMs[node] : 0; }
+  int8_t   rssi(uint8_t node) const    { return node < ARQ_MAX_NODES ? _rssi[node] : 0; }
+
+  uint32_t calls() const       { return _calls; }
+  uint32_t confirmed() const   { return _confirmed; }
+  uint32_t resends() const     { return _resends; }
+  uint32_t unconfirmed() const { return _unconfirmed; }
+
+private:
+  LoRaModem _modem;
+  CallFrame _frame;
+  uint8_t   _expected, _acked, _sends, _slots;
+  bool      _pending;
+  uint32_t  _firstMs, _deadlineMs;
+  uint32_t  _rttMs[ARQ_MAX_NODES];
+  int8_t    _rssi[ARQ_MAX_NODES];
+  uint32_t  _calls, _confirmed, _resends, _unconfirmed;
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_ARQ_H
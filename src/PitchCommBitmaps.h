@@ -0,0 +1,49 @@
+/*
+ * ============================================================================
+ * PITCHCOMM BITMAPS — pre-rasterized call strings
+ * ============================================================================
+ * Every string a receiver shows in a large font is fixed at compile time
+ * (callTable, decodePitch, pitchNames, zone digits, PK / 3rd signs). The
+ * host tool Host_Bench/src/font_compiler.cpp lays each one out exactly as
+ * the firmware would (same font, same getStrWidth / getTextBounds / datum
+ * arithmetic, same coordinates) and writes the result into a generated
+ * CallBitmaps.h for the receiver. PlatformIO receivers generate it into
+ * their build directory on every build (Host_Bench/call_bitmaps.py); the
+ * Arduino IDE sketches get it next to the source from a manual run.
+ *
+ * A PackedBitmap is the ink of one string at its final screen position:
+ * 1 bpp, rows MSB first, each row padded to whole bytes. That is the
+ * format of Adafruit GFX / TFT_eSPI drawBitmap() and U8g2 drawBitmap(), so
+ * drawing a call is one blit per string and the large fonts are no longer
+ * referenced (and drop out at link time).
+ *
+ * Receivers include the generated header only if it exists:
+ *
+ *   #if __has_include("CallBitmaps.h")
+ *   #include "CallBitmaps.h"        // defines PITCHCOMM_CALL_BITMAPS
+ *   #endif
+ *
+ * and keep the runtime font path otherwise (custom_call_bitmaps = no, or
+ * an Arduino IDE build before the tool has been run).
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_BITMAPS_H
+#define PITCHCOMM_BITMAPS_H
+
+#include <stdint.h>
+
+namespace pitchcomm {
+
+struct PackedBitmap {
+  int16_t        x, y;           // top-left of the ink on the panel
+  uint16_t       w, h;           // 0 x 0 = nothing to draw
+  const uint8_t* bits;
+
+  uint16_t stride() const { return (w + 7) / 8; }
+  bool     empty() const  { return w == 0; }
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_BITMAPS_H
@@ -0,0 +1,105 @@
+/*
+ * ============================================================================
+ * PITCHCOMM DIRTY TILES — flush only the changed 8x8 tiles of a U8g2 frame
+ * ============================================================================
+ * U8g2 full-buffer mode keeps the frame as tile rows: byte (ty * W * 8 + x)
+ * is the vertical 8-pixel column x of tile row ty. sendBuffer() pushes all
+ * of it (1024 B on a 128x64 SSD1306) even when a call only changes the
+ * pitch or zone glyph.
+ *
+ * DirtyTiles keeps a copy of what the panel currently shows, compares the
+ * new frame against it one 8-byte tile at a time, and sends each run of
+ * changed tiles in a tile row with one updateDisplayArea(). Draw exactly as
+ * before (clearBuffer, draw..., then flush(display) instead of sendBuffer).
+ *
+ * Bus bytes are estimated per run as the tile data plus RUN_OVERHEAD bytes
+ * of I2C address, control bytes and SSD1306 page/column commands, so a full
+ * 128x64 frame counts as 8 x (1024/8 + 7) = 1080 B.
+ *
+ * Usage:
+ *   pitchcomm::DirtyTiles<16, 8> tiles;      // 128x64 = 16 x 8 tiles
+ *   display.clearBuffer(); ...draw...; tiles.flush(display);
+ *   Serial.printf("bus=%u", tiles.lastBytes());
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_DIRTY_TILES_H
+#define PITCHCOMM_DIRTY_TILES_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace pitchcomm {
+
+template <uint8_t TILES_W, uint8_t TILES_H>
+class DirtyTiles {
+public:
+  static const uint8_t RUN_OVERHEAD = 7;
+
+  DirtyTiles() : _valid(false), _lastBytes(0), _lastTiles(0), _totalBytes(0), _flushes(0) {
+    memset(_sent, 0, sizeof(_sent));
+  }
+
+  // Next flush sends every tile (panel content unknown, e.g. after a reset)
+  void invalidate() { _valid = false; }
+
+  // Sends the changed tiles of display's buffer; returns estimated bus bytes
+  template <class Display>
+  uint16_t flush(Display& display) {
+    const uint8_t* buf = display.getBufferPtr();
+    uint16_t bytes = 0, tiles = 0;
+
+    for (uint8_t ty = 0; ty < TILES_H; ty++) {
+      uint8_t tx = 0;
+      while (tx < TILES_W) {
+        if (_valid && !tileChanged(buf, tx, ty)) {
+          tx++;
+          continue;
+        }
+        uint8_t start = tx;
+        while (tx < TILES_W && (!_valid || tileChanged(buf, tx, ty))) tx++;
+        uint8_t run = tx - start;
+
+        display.updateDisplayArea(start, ty, run, 1);
+        size_t off = tileOffset(start, ty);
+        memcpy(_sent + off, buf + off, (size_t)run * 8);
+        bytes += RUN_OVERHEAD + run * 8;
+        tiles += run;
+      }
+    }
+
+    _valid = true;
+    _lastBytes = bytes;
+    _lastTiles = tiles;
+    _totalBytes += bytes;
+    _flushes++;
+    return bytes;
+  }
+
+  uint16_t lastBytes() const  { return _lastBytes; }
+  uint16_t lastTiles() const  { return _lastTiles; }
+  uint32_t totalBytes() const { return _totalBytes; }
+  uint32_t flushes() const    { return _flushes; }
+
+  // What sendBuffer() would have cost, for comparison
+  static uint16_t fullFrameBytes() { return TILES_H * (RUN_OVERHEAD + TILES_W * 8); }
+
+private:
+  static size_t tileOffset(uint8_t tx, uint8_t ty) {
+    return (size_t)ty * TILES_W * 8 + (size_t)tx * 8;
+  }
+
+  bool tileChanged(const uint8_t* buf, uint8_t tx, uint8_t ty) const {
+    size_t off = tileOffset(tx, ty);
+    return memcmp(_sent + off, buf + off, 8) != 0;
+  }
+
+  uint8_t  _sent[TILES_W * TILES_H * 8];
+  bool     _valid;
+  uint16_t _lastBytes, _lastTiles;
+  uint32_t _totalBytes, _flushes;
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_DIRTY_TILES_H
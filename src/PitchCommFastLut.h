@@ -0,0 +1,128 @@
+/*
+ * ============================================================================
+ * PITCHCOMM FAST LUT — short SSD1680 waveform for call updates (armband)
+ * ============================================================================
+ * GxEPD2_213_BN's partial update (0x22 = 0xFC) reloads the panel's OTP
+ * waveform, which spends ~300-500 ms driving every pixel through several
+ * phases. A pitch call only ever moves pixels between black and white, so
+ * FastLut213 can load a one-phase waveform over command 0x32 instead and
+ * trigger the update with 0x22 = 0xCC (clock + analog on, display mode 2,
+ * no LUT load), which keeps the RAM-loaded table.
+ *
+ * Mode 2 picks a LUT per pixel from (previous RAM, new RAM):
+ *
+ *   LUT0  B -> B   no drive          LUT2  W -> B   VSH1 for N frames
+ *   LUT1  B -> W   VSL for N frames  LUT3  W -> W   no drive
+ *
+ * so unchanged pixels are not touched at all. N (setFastFrames) is the
+ * tuning knob: fewer frames = faster but greyer blacks and more ghosting.
+ * Every standard refresh reloads the OTP table, so the next full refresh
+ * (ghost cleanup) is automatically back on the stock waveform; fast mode
+ * only loads its table again when it is next used.
+ *
+ * Drop-in for GxEPD2_213_BN as the GxEPD2_BW driver type. Both modes time
+ * refresh() (command + BUSY) into LatencyStats so the two waveforms can be
+ * compared on the bench.
+ *
+ * Voltage / VCOM bytes are the published values for this panel family
+ * (Waveshare 2.13" V3 / SSD1680); check them against the panel's datasheet
+ * before shipping a different glass.
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_FAST_LUT_H
+#define PITCHCOMM_FAST_LUT_H
+
+#include <GxEPD2_BW.h>
+#include <PitchCommRxEvent.h>
+
+namespace pitchcomm {
+
+class FastLut213 : public GxEPD2_213_BN {
+public:
+  static const uint8_t LUT_BYTES      = 153;    // command 0x32 payload
+  static const uint8_t DEFAULT_FRAMES = 6;
+
+  FastLut213(int16_t cs, int16_t dc, int16_t rst, int16_t busy)
+    : GxEPD2_213_BN(cs, dc, rst, busy),
+      _fast(false), _lutLoaded(false), _frames(DEFAULT_FRAMES) {}
+
+  // Partial refreshes use the fast waveform while set
+  void setFast(bool on) { _fast = on; }
+  bool fast() const     { return _fast; }
+
+  void setFastFrames(uint8_t frames) {
+    _frames    = frames ? frames : 1;
+    _lutLoaded = false;
+  }
+
+  void refresh(bool partial_update_mode = false) {
+    uint32_t t0 = micros();
+    GxEPD2_213_BN::refresh(partial_update_mode);
+    _lutLoaded = false;
+    (partial_update_mode ? _standard : _full).add(micros() - t0);
+  }
+
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+    uint32_t t0 = micros();
+    // The first update after init must be the driver's own (full) one
+    if (!_fast || _initial_refresh || !_using_partial_mode) {
+      bool full = _initial_refresh;
+      GxEPD2_213_BN::refresh(x, y, w, h);
+      _lutLoaded = false;
+      (full ? _full : _standard).add(micros() - t0);
+      return;
+    }
+    if (!_lutLoaded) loadLut();
+    _writeCommand(0x22);
+    _writeData(0xCC);
+    _writeCommand(0x20);
+    _waitWhileBusy("FastLut213", 20 * _frames);
+    _fastStats.add(micros() - t0);
+  }
+
+  // ---- refresh time per waveform (command + BUSY) ----
+  void resetStats() { _standard.reset(); _fastStats.reset(); _full.reset(); }
+  const LatencyStats& standardStats() const { return _standard; }
+  const LatencyStats& fastStats() const     { return _fastStats; }
+  const LatencyStats& fullStats() const     { return _full; }
+
+private:
+  void loadLut() {
+    uint8_t lut[LUT_BYTES];
+    memset(lut, 0, sizeof(lut));
+
+    // VS: 5 LUTs x 12 groups, phases A..D two bits each (01 VSH1, 10 VSL)
+    lut[1 * 12] = 0x80;                 // LUT1 B -> W: group 0 phase A VSL
+    lut[2 * 12] = 0x40;                 // LUT2 W -> B: group 0 phase A VSH1
+
+    // TP/SR/RP: 12 groups x 7 bytes; only group 0 phase A runs
+    lut[60] = _frames;
+
+    // FR (6 bytes): frame rate per group pair, XON (3 bytes): none
+    for (uint8_t i = 0; i < 6; i++) lut[144 + i] = 0x22;
+
+    _writeCommand(0x32);
+    for (uint8_t i = 0; i < LUT_BYTES; i++) _writeData(lut[i]);
+    _writeCommand(0x3F);                // end option: normal
+    _writeData(0x22);
+    _writeCommand(0x03);                // gate voltage VGH = 20 V
+    _writeData(0x17);
+    _writeCommand(0x04);                // source VSH1 15 V, VSH2, VSL -15 V
+    _writeData(0x41);
+    _writeData(0x00);
+    _writeData(0x32);
+    _writeCommand(0x2C);                // VCOM
+    _writeData(0x36);
+    _lutLoaded = true;
+  }
+
+  bool         _fast;
+  bool         _lutLoaded;
+  uint8_t      _frames;
+  LatencyStats _standard, _fastStats, _full;
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_FAST_LUT_H
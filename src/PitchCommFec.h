@@ -0,0 +1,168 @@
+/*
+ * ============================================================================
+ * PITCHCOMM FEC — single-shot error-correcting call frame
+ * ============================================================================
+ * The 6-byte call frame plus a CRC-8 of it is split into 14 nibbles, each
+ * coded as an extended Hamming(8,4) SECDED codeword (corrects 1 bit, detects
+ * 2), then bit-interleaved 14 x 8 so a burst of up to 14 consecutive bit
+ * errors — about one corrupted LoRa symbol at SF7..SF12 — lands as at most
+ * one error per codeword.
+ *
+ *   FEC frame = 14 bytes, identified by length alone
+ *
+ * Receivers try to decode FEC frames even when the LoRa payload CRC fails
+ * (RadioLib still fills the buffer and returns RADIOLIB_ERR_CRC_MISMATCH).
+ * Three or more errors in one codeword can "correct" it to the wrong
+ * nibble, so the decoded frame must match its CRC-8 (poly 0x07) before it
+ * reaches the usual magic/version/XOR checks. fec_bench counts what slips
+ * through as "Wrong".
+ *
+ * Codeword bit layout (bit 0 = Hamming position 1):
+ *   [P0][d4][d3][d2][p3][d1][p2][p1]
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_FEC_H
+#define PITCHCOMM_FEC_H
+
+#include <string.h>
+#include "PitchCommProtocol.h"
+
+namespace pitchcomm {
+
+const size_t FEC_DATA      = CALL_LENGTH + 1;     // call frame + CRC-8
+const size_t FEC_LENGTH    = 2 * FEC_DATA;
+const size_t FEC_CODEWORDS = 2 * FEC_DATA;
+
+struct FecFrame {
+  uint8_t bytes[FEC_LENGTH];
+};
+
+namespace detail {
+
+constexpr uint8_t bit(uint8_t v, uint8_t n) { return (uint8_t)((v >> n) & 1); }
+
+constexpr uint8_t parity8(uint8_t v) {
+  return (uint8_t)(bit(v, 0) ^ bit(v, 1) ^ bit(v, 2) ^ bit(v, 3)
+                 ^ bit(v, 4) ^ bit(v, 5) ^ bit(v, 6) ^ bit(v, 7));
+}
+
+constexpr uint8_t hamming74(uint8_t n) {
+  return (uint8_t)(
+      ((bit(n, 0) ^ bit(n, 1) ^ bit(n, 3)) << 0)     // p1
+    | ((bit(n, 0) ^ bit(n, 2) ^ bit(n, 3)) << 1)     // p2
+    | (bit(n, 0) << 2)                               // d1
+    | ((bit(n, 1) ^ bit(n, 2) ^ bit(n, 3)) << 3)     // p3
+    | (bit(n, 1) << 4)                               // d2
+    | (bit(n, 2) << 5)                               // d3
+    | (bit(n, 3) << 6));                             // d4
+}
+
+constexpr uint8_t hamming84(uint8_t n) {
+  return (uint8_t)(hamming74(n) | (parity8(hamming74(n)) << 7));
+}
+
+// CRC-8, poly 0x07, init 0
+constexpr uint8_t crc8Bits(uint8_t c, uint8_t bits) {
+  return bits == 0 ? c : crc8Bits((c & 0x80) ? (uint8_t)((c << 1) ^ 0x07) : (uint8_t)(c << 1),
+                                  (uint8_t)(bits - 1));
+}
+
+constexpr uint8_t crc8(const uint8_t* p, size_t n, uint8_t c = 0) {
+  return n == 0 ? c : crc8(p + 1, n - 1, crc8Bits((uint8_t)(c ^ *p), 8));
+}
+
+// Byte k of the coded data: the call frame, then its CRC-8
+constexpr uint8_t fecData(const CallFrame& f, size_t k) {
+  return k < CALL_LENGTH ? f.bytes[k] : crc8(f.bytes, CALL_LENGTH);
+}
+
+// Codeword i: high nibble of data byte i/2 first
+constexpr uint8_t fecCodeword(const CallFrame& f, size_t i) {
+  return hamming84((i & 1) ? (fecData(f, i / 2) & 0x0F) : (fecData(f, i / 2) >> 4));
+}
+
+// Interleaved stream bit b comes from codeword (b % 14), bit (b / 14)
+constexpr uint8_t fecStreamBit(const CallFrame& f, size_t b) {
+  return bit(fecCodeword(f, b % FEC_CODEWORDS), (uint8_t)(b / FEC_CODEWORDS));
+}
+
+constexpr uint8_t fecByte(const CallFrame& f, size_t k) {
+  return (uint8_t)(
+      (fecStreamBit(f, 8 * k + 0) << 0) | (fecStreamBit(f, 8 * k + 1) << 1)
+    | (fecStreamBit(f, 8 * k + 2) << 2) | (fecStreamBit(f, 8 * k + 3) << 3)
+    | (fecStreamBit(f, 8 * k + 4) << 4) | (fecStreamBit(f, 8 * k + 5) << 5)
+    | (fecStreamBit(f, 8 * k + 6) << 6) | (fecStreamBit(f, 8 * k + 7) << 7));
+}
+
+// Returns the data nibble, or -1 for an uncorrectable (double) error.
+// *fixed is incremented when a single-bit error was repaired.
+inline int8_t decodeHamming84(uint8_t c, uint8_t* fixed) {
+  uint8_t s = (uint8_t)(
+      ((bit(c, 0) ^ bit(c, 2) ^ bit(c, 4) ^ bit(c, 6)) << 0)
+    | ((bit(c, 1) ^ bit(c, 2) ^ bit(c, 5) ^ bit(c, 6)) << 1)
+    | ((bit(c, 3) ^ bit(c, 4) ^ bit(c, 5) ^ bit(c, 6)) << 2));
+  uint8_t p = parity8(c);
+
+  if (s != 0 && p == 0) return -1;           // two errors
+  if (p != 0) {                              // one error: position s (0 = P0)
+    if (s != 0) c ^= (uint8_t)(1 << (s - 1));
+    (*fixed)++;
+  }
+  return (int8_t)(bit(c, 2) | (bit(c, 4) << 1) | (bit(c, 5) << 2) | (bit(c, 6) << 3));
+}
+
+} // namespace detail
+
+constexpr FecFrame encodeFec(const CallFrame& f) {
+  return FecFrame{{ detail::fecByte(f, 0), detail::fecByte(f, 1), detail::fecByte(f, 2),
+                    detail::fecByte(f, 3), detail::fecByte(f, 4), detail::fecByte(f, 5),
+                    detail::fecByte(f, 6), detail::fecByte(f, 7), detail::fecByte(f, 8),
+                    detail::fecByte(f, 9), detail::fecByte(f, 10), detail::fecByte(f, 11),
+                    detail::fecByte(f, 12), detail::fecByte(f, 13) }};
+}
+
+constexpr FecFrame encodeFecCall(uint8_t addr, uint8_t cmd, uint8_t seq, bool ack = false) {
+  return encodeFec(encodeCall(addr, cmd, seq, ack));
+}
+
+// Deinterleave + correct a 14-byte FEC frame into out[CALL_LENGTH].
+// Returns false on length mismatch, any uncorrectable codeword, or a
+// CRC-8 mismatch (miscorrection).
+inline bool decodeFec(const uint8_t* in, size_t len, uint8_t* out, uint8_t* fixed = NULL) {
+  uint8_t dummy = 0;
+  if (fixed == NULL) fixed = &dummy;
+  *fixed = 0;
+  if (len != FEC_LENGTH) return false;
+
+  uint8_t data[FEC_DATA];
+  for (size_t i = 0; i < FEC_CODEWORDS; i++) {
+    uint8_t c = 0;
+    for (uint8_t j = 0; j < 8; j++) {
+      size_t b = j * FEC_CODEWORDS + i;
+      c |= (uint8_t)(((in[b >> 3] >> (b & 7)) & 1) << j);
+    }
+    int8_t n = detail::decodeHamming84(c, fixed);
+    if (n < 0) return false;
+    if (i & 1) data[i / 2] |= (uint8_t)n;
+    else       data[i / 2]  = (uint8_t)(n << 4);
+  }
+  if (detail::crc8(data, CALL_LENGTH) != data[CALL_LENGTH]) return false;
+  memcpy(out, data, CALL_LENGTH);
+  return true;
+}
+
+// Returns a view over the call frame carried by a received packet: the
+// packet itself for a plain frame, or scratch[CALL_LENGTH] holding the
+// corrected frame for an FEC frame. An undecodable FEC frame yields an
+// empty (invalid) view.
+inline CallView openCall(const uint8_t* pkt, size_t len, uint8_t* scratch,
+                         uint8_t* fixed = NULL) {
+  return len != FEC_LENGTH ? CallView(pkt, len)
+       : decodeFec(pkt, len, scratch, fixed) ? CallView(scratch, CALL_LENGTH)
+       : CallView(scratch, 0);
+}
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_FEC_H
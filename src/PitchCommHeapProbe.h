@@ -0,0 +1,176 @@
+/*
+ * ============================================================================
+ * PITCHCOMM HEAP PROBE — count heap allocations across a code path
+ * ============================================================================
+ * The receive -> render path is meant to run without touching the heap:
+ * frames live in fixed rings, screens in fixed Scene buffers, log lines in
+ * stack buffers. HeapProbe checks that on the device and in the host sim.
+ *
+ * Build with -DPITCHCOMM_HEAP_PROBE and link with
+ *
+ *   -Wl,--wrap=malloc -Wl,--wrap=calloc -Wl,--wrap=realloc
+ *
+ * (on ESP32 also -Wl,--wrap=heap_caps_malloc -Wl,--wrap=heap_caps_calloc
+ * -Wl,--wrap=heap_caps_realloc) and every malloc / calloc / realloc (and
+ * so every operator new, String or std::string built on them) bumps one
+ * global counter before going to the real allocator. On the host libstdc++ is a shared library the wrap
+ * cannot reach, so operator new / delete are replaced here as well. free()
+ * is not counted.
+ *
+ * ESP-IDF's ps_calloc() and heap_caps_*() do not go through malloc, which
+ * is why ESP32 builds wrap the heap_caps_* entry points too: PSRAM
+ * sprites, DMA buffers, and the bounce buffers the IDF SPI driver
+ * allocates when handed a non-DMA-capable buffer are all counted. The
+ * wraps reach calls made from inside the IDF's prebuilt libraries.
+ *
+ * The counter is shared by every task: a probe on the UI task also sees
+ * the radio task's allocations, which belong to the same path anyway.
+ *
+ * Without PITCHCOMM_HEAP_PROBE, HeapProbe::allocs() is a constant 0 and the
+ * checks around it compile away. With -DPITCHCOMM_HEAP_STRICT as well,
+ * HEAP_STRICT is true and firmware aborts after logging a nonzero count.
+ *
+ * Usage:
+ *   pitchcomm::HeapProbe heap;
+ *   drawSignal(sig);
+ *   if (heap.allocs()) {
+ *     Serial.printf("[Heap] %lu allocs\n", (unsigned long)heap.allocs());
+ *     if (pitchcomm::HEAP_STRICT) abort();
+ *   }
+ *
+ * The wrap hooks are defined by this header; with the probe on, include it
+ * from one translation unit only (each receiver is a single main.cpp).
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_HEAP_PROBE_H
+#define PITCHCOMM_HEAP_PROBE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+namespace pitchcomm {
+
+#ifdef PITCHCOMM_HEAP_PROBE
+const bool HEAP_PROBE_ENABLED = true;
+#else
+const bool HEAP_PROBE_ENABLED = false;
+#endif
+
+#ifdef PITCHCOMM_HEAP_STRICT
+const bool HEAP_STRICT = HEAP_PROBE_ENABLED;
+#else
+const bool HEAP_STRICT = false;
+#endif
+
+#ifdef PITCHCOMM_HEAP_PROBE
+
+namespace detail {
+// Constant-initialised, so safe to bump from the first malloc at boot
+inline std::atomic<uint32_t>& heapAllocCount() {
+  static std::atomic<uint32_t> count(0);
+  return count;
+}
+} // namespace detail
+
+// Allocations since boot
+inline uint32_t heapAllocs() {
+  return detail::heapAllocCount().load(std::memory_order_relaxed);
+}
+
+// Allocations since construction (or reset())
+class HeapProbe {
+public:
+  HeapProbe() : _start(heapAllocs()) {}
+  void     reset()        { _start = heapAllocs(); }
+  uint32_t allocs() const { return heapAllocs() - _start; }
+
+private:
+  uint32_t _start;
+};
+
+#else
+
+inline uint32_t heapAllocs() { return 0; }
+
+class HeapProbe {
+public:
+  void     reset()        {}
+  uint32_t allocs() const { return 0; }
+};
+
+#endif
+
+} // namespace pitchcomm
+
+// ============================================================================
+// HOOKS (probe builds only)
+// ============================================================================
+#ifdef PITCHCOMM_HEAP_PROBE
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* p, size_t size);
+
+void* __wrap_malloc(size_t size) {
+  pitchcomm::detail::heapAllocCount().fetch_add(1, std::memory_order_relaxed);
+  return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+  pitchcomm::detail::heapAllocCount().fetch_add(1, std::memory_order_relaxed);
+  return __real_calloc(n, size);
+}
+
+void* __wrap_realloc(void* p, size_t size) {
+  pitchcomm::detail::heapAllocCount().fetch_add(1, std::memory_order_relaxed);
+  return __real_realloc(p, size);
+}
+
+#if defined(ESP32)
+void* __real_heap_caps_malloc(size_t size, uint32_t caps);
+void* __real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* __real_heap_caps_realloc(void* p, size_t size, uint32_t caps);
+
+void* __wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+  pitchcomm::detail::heapAllocCount().fetch_add(1, std::memory_order_relaxed);
+  return __real_heap_caps_malloc(size, caps);
+}
+
+void* __wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+  pitchcomm::detail::heapAllocCount().fetch_add(1, std::memory_order_relaxed);
+  return __real_heap_caps_calloc(n, size, caps);
+}
+
+void* __wrap_heap_caps_realloc(void* p, size_t size, uint32_t caps) {
+  pitchcomm::detail::heapAllocCount().fetch_add(1, std::memory_order_relaxed);
+  return __real_heap_caps_realloc(p, size, caps);
+}
+#endif
+}
+
+#ifndef ARDUINO
+#include <stdlib.h>
+#include <new>
+
+void* operator new(size_t size) {
+  pitchcomm::detail::heapAllocCount().fetch_add(1, std::memory_order_relaxed);
+  void* p = __real_malloc(size ? size : 1);
+  if (p == NULL) throw std::bad_alloc();
+  return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+#if defined(__GNUC__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"   // new above is malloc
+#endif
+void operator delete(void* p) noexcept             { free(p); }
+void operator delete[](void* p) noexcept           { free(p); }
+void operator delete(void* p, size_t) noexcept     { free(p); }
+void operator delete[](void* p, size_t) noexcept   { free(p); }
+#endif
+
+#endif // PITCHCOMM_HEAP_PROBE
+
+#endif // PITCHCOMM_HEAP_PROBE_H
@@ -0,0 +1,544 @@
+/*
+ * ============================================================================
+ * PITCHCOMM LINK — adaptive data rate between the coach and its receivers
+ * ============================================================================
+ * Both radio families run one fixed setting whatever the distance: SF10 for
+ * signal frames, SF7 for call frames. Dugout to plate usually leaves far
+ * more SNR than SF10 needs, so most of its airtime is wasted. With link
+ * adaptation the coach moves along a ladder of steps, and the receivers
+ * follow:
+ *
+ *   step   0      1      2      3      4      5      6
+ *   SF     10     9      8      7      7      7      7
+ *   TX     22     22     22     22     18     14     10  dBm (coach)
+ *
+ * Only the SF changes on the receivers. Bandwidth, CR, preamble and sync
+ * word stay the family's. A family's home step is the setting it used
+ * before adaptation: step 0 for signal receivers, step 3 for call receivers.
+ * Receivers boot at home, so a coach without adaptation still reaches them.
+ *
+ * Steps 4..6 only save coach power, so they are used only when the coach
+ * asks for power saving. The call family's home is already the fastest
+ * SF: without power saving its adapter never polls.
+ *
+ * Protocol (frames in PitchCommProtocol.h):
+ *
+ *   poll     every LINK_BEACON_MS the coach sends a LINK COMMAND for its
+ *            current step. Each receiver answers with a LINK REPORT that
+ *            carries the command's SNR. Node n answers n slots after the
+ *            command, so the reports do not collide. At home, while the
+ *            worst receiver is nowhere near the next step up, the interval
+ *            doubles up to LINK_BEACON_MAX_MS: those polls would only
+ *            confirm that nothing can change.
+ *   step     the coach picks the fastest step at which the worst receiver
+ *            keeps LINK_MARGIN_Q4 over that SF's demodulation floor. Going
+ *            faster needs fresh reports from every receiver, and no step
+ *            down in the last LINK_RETRY_MS (doubled for each further step
+ *            down within LINK_RETRY_MAX_MS, up to that). It goes one step
+ *            slower as soon as the margin drops LINK_HYSTERESIS_Q4 below
+ *            target. A change is sent LINK_COMMAND_REPEATS times at the old
+ *            step (`left` counts down), then the coach switches.
+ *   confirm  every receiver must report from the new step within
+ *            LINK_CONFIRM_MS. If one does not after a step up, the coach
+ *            switches back to the step it came from, and does not try that
+ *            step again for LINK_HOLDOFF_MS. After a step down it stays,
+ *            and repeats the command at the step it came from (up to
+ *            LINK_COMMAND_REPEATS times, each with a fresh confirm).
+ *
+ * Rendezvous, so a lost frame never strands anyone:
+ *
+ *   receiver  after LINK_FALLBACK_MS (two missed beacons) with no valid
+ *             coach frame (command, signal or call) away from home, it
+ *             returns to home. Away from home the coach never backs off.
+ *   coach     a receiver that has not reported for three poll intervals
+ *             sends the coach home, and keeps it from going faster until it
+ *             reports again (or LINK_FORGET_MS passes: it was switched
+ *             off). Away from home the coach also sends a command at the
+ *             home step every LINK_JOIN_MS while a receiver is not
+ *             following (every LINK_BEACON_MAX_MS otherwise), so a receiver
+ *             that fell back or booted late finds the current step.
+ *             After a failed confirm or a lost receiver, the command goes
+ *             out at the step the coach left and once more at the step it
+ *             is on, followed at once by a join if that is not home.
+ *
+ * A receiver is therefore back in step within LINK_FALLBACK_MS +
+ * LINK_JOIN_MS in the worst case. Host_Bench link_sim runs the receiver
+ * sketches against LinkAdapter over faded channels, and reports airtime per
+ * call, the share of calls sent at each SF and how long any receiver was
+ * out of step.
+ *
+ * Receiver usage (see any receiver's serviceLink()):
+ *   pitchcomm::LinkFollower link(pitchcomm::LINK_SIGNAL, LINK_NODE);
+ *   if (cmd.valid() && link.onCommand(cmd, snrQ4, rssi, millis())) tuneLink(radio, link);
+ *   if (frame.valid()) link.onTraffic(millis());
+ *   sendLinkReport(radio, link, millis(), setFlag);  // from loop()
+ *   if (link.fallback(millis())) tuneLink(radio, link);
+ *
+ * Coach usage (the T-Deck TX source is not in this tree; see link_sim):
+ *   pitchcomm::LinkAdapter adapter(pitchcomm::LINK_SIGNAL);   // , true: power saving
+ *   if (report.valid()) adapter.onReport(report, millis());
+ *   if (!adapter.quiet(millis())) {
+ *     send calls at adapter.step();
+ *     if (adapter.poll(millis(), cmd, atStep)) send cmd at atStep;
+ *   }
+ *   listen at adapter.step()
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_LINK_H
+#define PITCHCOMM_LINK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <PitchCommProtocol.h>
+#include <PitchCommAirtime.h>
+#include <PitchCommReply.h>
+
+namespace pitchcomm {
+
+// ============================================================================
+// LADDER
+// ============================================================================
+struct LinkStep {
+  uint8_t sf;
+  int8_t  powerDbm;         // coach TX power
+};
+
+const uint8_t LINK_STEPS = 7;
+const int8_t  LINK_FULL_POWER_DBM = 22;
+
+constexpr LinkStep LINK_LADDER[LINK_STEPS] = {
+  { 10, 22 }, { 9, 22 }, { 8, 22 }, { 7, 22 }, { 7, 18 }, { 7, 14 }, { 7, 10 },
+};
+
+// First step at the fastest SF; the ones above it only cut coach power
+const uint8_t LINK_FAST_STEP = 3;
+
+static_assert(LINK_LADDER[LINK_FAST_STEP].sf == LINK_LADDER[LINK_STEPS - 1].sf
+           && LINK_LADDER[LINK_FAST_STEP - 1].sf > LINK_LADDER[LINK_FAST_STEP].sf,
+              "LINK_FAST_STEP must be the first step at the fastest SF");
+
+// A family's home modem; ladder steps only change its SF
+struct LinkFamily {
+  LoRaModem modem;
+  uint8_t   homeStep;
+};
+
+constexpr LinkFamily LINK_SIGNAL = { MODEM_SIGNAL_SF10, 0 };
+constexpr LinkFamily LINK_CALL   = { MODEM_CALL_SF7,    3 };
+
+constexpr LoRaModem linkModem(const LinkFamily& f, uint8_t step) {
+  return LoRaModem{ LINK_LADDER[step].sf, f.modem.bwHz, f.modem.cr,
+                    f.modem.preamble, f.modem.crc, f.modem.implicitHeader };
+}
+
+// SX126x demodulation floor in quarter dB: -7.5 dB at SF7, -2.5 dB per SF
+constexpr int16_t snrFloorQ4(uint8_t sf) {
+  return (int16_t)(40 - 10 * sf);
+}
+
+static_assert(LINK_LADDER[LINK_SIGNAL.homeStep].sf == MODEM_SIGNAL_SF10.sf
+           && LINK_LADDER[LINK_CALL.homeStep].sf == MODEM_CALL_SF7.sf,
+              "home steps must match the families' fixed settings");
+
+// ============================================================================
+// TIMING
+// ============================================================================
+const uint8_t  LINK_MAX_NODES       = 8;      // node ids 0..7 per family
+const uint8_t  LINK_COMMAND_REPEATS = 2;
+const uint32_t LINK_BEACON_MS       = 30000;
+const uint32_t LINK_BEACON_MAX_MS   = 180000; // backed-off poll, at home only
+const uint32_t LINK_CONFIRM_MS      = 4000;
+const uint32_t LINK_FALLBACK_MS     = 2 * LINK_BEACON_MS + 5000;
+const uint32_t LINK_JOIN_MS         = 60000;
+const uint32_t LINK_HOLDOFF_MS      = 120000;
+const uint32_t LINK_RETRY_MS        = 180000; // after a step down, before going up
+const uint32_t LINK_RETRY_MAX_MS    = 720000; // ... doubled while the link flaps
+const uint32_t LINK_FORGET_MS       = 600000; // missing receiver, e.g. switched off
+const uint32_t LINK_GUARD_MS        = 20;     // between report slots
+const int16_t  LINK_MARGIN_Q4       = 10 * 4; // target margin over the floor
+const int16_t  LINK_HYSTERESIS_Q4   = 4 * 4;
+
+static_assert(3 * LINK_BEACON_MAX_MS + LINK_CONFIRM_MS < LINK_FORGET_MS,
+              "a receiver must be missed before it is forgotten");
+
+// One report plus guard at a step: node n answers n slots after a command
+constexpr uint32_t linkSlotMs(const LinkFamily& f, uint8_t step) {
+  return timeOnAirUs(linkModem(f, step), LINK_REPORT_LENGTH) / 1000 + 1 + LINK_GUARD_MS;
+}
+
+// ============================================================================
+// RECEIVER SIDE
+// ============================================================================
+class LinkFollower {
+public:
+  LinkFollower(const LinkFamily& family, uint8_t node)
+    : _family(family), _node(node), _step(family.homeStep), _epoch(0),
+      _rxStep(family.homeStep), _snrQ4(0), _rssi(0), _reportDue(false),
+      _reportAtMs(0), _heardMs(0), _fallbacks(0) {}
+
+  uint8_t           node() const      { return _node; }
+  const LinkFamily& family() const    { return _family; }
+  uint8_t           step() const      { return _step; }
+  const LinkStep&   current() const   { return LINK_LADDER[_step]; }
+  bool              atHome() const    { return _step == _family.homeStep; }
+  uint32_t          fallbacks() const { return _fallbacks; }
+
+  // Start over on another family (radio profile change): back at its home
+  // step, with any pending report dropped
+  void setFamily(const LinkFamily& family) {
+    _family    = family;
+    _step      = _rxStep = family.homeStep;
+    _reportDue = false;
+  }
+
+  // A valid LINK COMMAND from the coach. Schedules the report; true when
+  // the step changed and the radio must be retuned.
+  bool onCommand(const LinkCommandView& cmd, int16_t snrQ4, int16_t rssi, uint32_t nowMs) {
+    if (cmd.step() >= LINK_STEPS) return false;
+    onTraffic(nowMs);
+    uint8_t was = _step;
+    _rxStep = _step;
+    _snrQ4  = snrQ4;
+    _rssi   = rssi;
+    _epoch  = cmd.epoch();
+    _step   = cmd.step();
+
+    // Wait out the coach's remaining repeats, then this node's slot
+    uint32_t repeatMs = timeOnAirUs(linkModem(_family, was), LINK_COMMAND_LENGTH) / 1000 + 1;
+    _reportAtMs = nowMs + cmd.left() * repeatMs + _node * linkSlotMs(_family, _step);
+    _reportDue  = true;
+    return _step != was;
+  }
+
+  // Any valid frame from the coach keeps the current step alive
+  void onTraffic(uint32_t nowMs) { _heardMs = nowMs; }
+
+  // The report to send now, if one is due
+  bool reportDue(uint32_t nowMs, LinkReportFrame& out) {
+    if (!_reportDue || (int32_t)(nowMs - _reportAtMs) < 0) return false;
+    _reportDue = false;
+    int16_t snr  = _snrQ4 < -128 ? -128 : (_snrQ4 > 127 ? 127 : _snrQ4);
+    int16_t rssi = _rssi < -128 ? -128 : (_rssi > 127 ? 127 : _rssi);
+    out = encodeLinkReport(_node, _step, _rxStep, _epoch, (int8_t)snr, (int8_t)rssi);
+    return true;
+  }
+
+  // True once when the coach has gone quiet away from home; the follower
+  // is then back at home and the radio must be retuned.
+  bool fallback(uint32_t nowMs) {
+    if (atHome() || nowMs - _heardMs < LINK_FALLBACK_MS) return false;
+    _step      = _family.homeStep;
+    _reportDue = false;
+    _heardMs   = nowMs;
+    _fallbacks++;
+    return true;
+  }
+
+private:
+  LinkFamily _family;
+  uint8_t    _node;
+  uint8_t    _step, _epoch, _rxStep;
+  int16_t    _snrQ4, _rssi;
+  bool       _reportDue;
+  uint32_t   _reportAtMs, _heardMs;
+  uint32_t   _fallbacks;
+};
+
+// Retune a receiver's radio to the follower's step and keep listening
+template <typename Radio>
+void tuneLink(Radio& radio, const LinkFollower& link) {
+  radio.setSpreadingFactor(link.current().sf);
+  radio.startReceive();
+}
+
+// Send a due report (sendReply(): DIO1 detached, RX re-armed)
+template <typename Radio>
+bool sendLinkReport(Radio& radio, LinkFollower& link, uint32_t nowMs, void (*dio1)(void)) {
+  LinkReportFrame report;
+  if (!link.reportDue(nowMs, report)) return false;
+  sendReply(radio, report.bytes, LINK_REPORT_LENGTH, dio1);
+  return true;
+}
+
+// ============================================================================
+// COACH SIDE
+// ============================================================================
+class LinkAdapter {
+public:
+  // powerSave: also use the steps that only cut coach TX power
+  explicit LinkAdapter(const LinkFamily& family, bool powerSave = false)
+    : _family(family), _step(family.homeStep), _from(family.homeStep),
+      _target(family.homeStep), _epoch(0), _left(0), _confirming(false),
+      _recover(false), _fetches(0), _top(powerSave ? LINK_STEPS - 1 : LINK_FAST_STEP),
+      _ceiling(_top), _switchMs(0), _beaconMs(0), _joinMs(0), _pollMs(LINK_BEACON_MS),
+      _retryMs(LINK_RETRY_MS), _downMs(0), _holdUntilMs(0), _upAfterMs(0), _quietUntilMs(0),
+      _slots(1), _changes(0), _failures(0) {
+    for (uint8_t i = 0; i < LINK_MAX_NODES; i++) _nodes[i] = LinkNode();
+  }
+
+  // Step the coach sends calls at (and listens for reports on)
+  uint8_t         step() const     { return _step; }
+  const LinkStep& current() const  { return LINK_LADDER[_step]; }
+  uint8_t         epoch() const    { return _epoch; }
+  uint32_t        changes() const  { return _changes; }
+  uint32_t        failures() const { return _failures; }   // unconfirmed steps
+  uint32_t        pollMs() const   { return _pollMs; }     // current poll interval
+
+  // Nothing to adapt: home is already the fastest step allowed
+  bool idle() const { return _family.homeStep >= _top; }
+
+  // Reports may be on the air: hold calls and link frames, the coach is
+  // half duplex and a receiver sending its report cannot hear a call
+  bool quiet(uint32_t nowMs) const { return (int32_t)(nowMs - _quietUntilMs) < 0; }
+
+  // A LINK REPORT the coach received
+  void onReport(const LinkReportView& r, uint32_t nowMs) {
+    if (r.node() >= LINK_MAX_NODES || r.rxStep() >= LINK_STEPS) return;
+    if (r.node() >= _slots) _slots = (uint8_t)(r.node() + 1);
+    LinkNode& n = _nodes[r.node()];
+    n.known   = true;
+    n.missing = false;
+    n.heardMs = nowMs;
+    n.epoch   = r.epoch();
+    n.step    = r.step();
+    // Normalised to full power so steps with less power compare directly
+    n.snrQ4   = (int16_t)(r.snrQ4() + 4 * (LINK_FULL_POWER_DBM - LINK_LADDER[r.rxStep()].powerDbm));
+  }
+
+  // The link frame to send now, if any, to be sent at ladder step `atStep`.
+  // Call every pass; retune to step() after sending.
+  bool poll(uint32_t nowMs, LinkCommandFrame& out, uint8_t& atStep) {
+    if (idle()) return false;
+    if (_left > 0) return repeat(nowMs, out, atStep);
+
+    uint8_t home = _family.homeStep;
+    if (_recover) {
+      // A receiver that missed the repeats may already be at the new step
+      _recover = false;
+      _joinMs  = nowMs - LINK_JOIN_MS;          // and one that fell back, at home
+      out      = encodeLinkCommand(_step, _epoch, 0);
+      atStep   = _step;
+      listen(nowMs, atStep);
+      return true;
+    }
+
+    if (_confirming) {
+      if (allConfirmed(nowMs)) {
+        _confirming = false;
+      } else if (nowMs - _switchMs >= LINK_CONFIRM_MS) {
+        if (_fetches == 0) _failures++;
+        _confirming = false;
+        if (_step > _from) {                    // too fast: hold it off
+          _ceiling     = (uint8_t)(_step - 1);
+          _holdUntilMs = nowMs + LINK_HOLDOFF_MS;
+          return change(_from, nowMs, out, atStep, true);
+        }
+        // Slower is safe for everyone: fetch whoever stayed at the step
+        // left, confirming again each time
+        if (_fetches < LINK_COMMAND_REPEATS) {
+          _fetches++;
+          _confirming = true;
+          _switchMs   = nowMs;
+          _recover    = true;
+          out         = encodeLinkCommand(_step, _epoch, 0);
+          atStep      = _from;
+          listen(nowMs, atStep);
+          return true;
+        }
+      }
+    }
+
+    if (!_confirming && _step != home && anyLost(nowMs)) {
+      return change(home, nowMs, out, atStep, true);
+    }
+    if (_step != home && nowMs - _joinMs >= joinMs(nowMs)) {
+      _joinMs = nowMs;
+      out     = encodeLinkCommand(_step, _epoch, 0);
+      atStep  = home;
+      listen(nowMs, atStep);
+      return true;
+    }
+    if (!_confirming) {
+      uint8_t next = decide(nowMs);
+      if (next != _step) return change(next, nowMs, out, atStep, false);
+    }
+    if (nowMs - _beaconMs >= _pollMs) {
+      _beaconMs = nowMs;
+      _pollMs   = nextPollMs(nowMs);
+      out       = encodeLinkCommand(_step, _epoch, 0);
+      atStep    = _step;
+      listen(nowMs, atStep);
+      return true;
+    }
+    return false;
+  }
+
+private:
+  struct LinkNode {
+    LinkNode() : known(false), missing(false), step(0), epoch(0), snrQ4(0), heardMs(0) {}
+    bool     known, missing;
+    uint8_t  step, epoch;
+    int16_t  snrQ4;         // at full power
+    uint32_t heardMs;
+  };
+
+  // recover: a revert after a failed confirm or a lost receiver
+  bool change(uint8_t target, uint32_t nowMs, LinkCommandFrame& out, uint8_t& atStep,
+              bool recover) {
+    if (target < _step) {
+      bool flapping = _downMs != 0 && nowMs - _downMs < LINK_RETRY_MAX_MS;
+      _retryMs   = flapping ? doubled(_retryMs, LINK_RETRY_MAX_MS) : LINK_RETRY_MS;
+      _downMs    = nowMs;
+      _upAfterMs = nowMs + _retryMs;
+    }
+    _from    = _step;
+    _target  = target;
+    _recover = recover;
+    _fetches = 0;
+    _pollMs  = LINK_BEACON_MS;
+    _epoch++;
+    _left    = LINK_COMMAND_REPEATS;
+    return repeat(nowMs, out, atStep);
+  }
+
+  bool repeat(uint32_t nowMs, LinkCommandFrame& out, uint8_t& atStep) {
+    _left--;
+    out    = encodeLinkCommand(_target, _epoch, _left);
+    atStep = _step;
+    if (_left == 0) {
+      _step       = _target;
+      _switchMs   = nowMs;
+      _beaconMs   = nowMs;
+      _joinMs     = nowMs;
+      _confirming = true;
+      _changes++;
+      listen(nowMs, atStep);
+    }
+    return true;
+  }
+
+  // After the last copy of a command, reports come back at the new step
+  void listen(uint32_t nowMs, uint8_t sentAt) {
+    uint32_t commandMs = timeOnAirUs(linkModem(_family, sentAt), LINK_COMMAND_LENGTH) / 1000 + 1;
+    _quietUntilMs = nowMs + commandMs + _slots * linkSlotMs(_family, _step);
+  }
+
+  // Three polls missed, at the interval the coach is polling at
+  bool fresh(const LinkNode& n, uint32_t nowMs) const {
+    return n.known && nowMs - n.heardMs < 3 * _pollMs + LINK_CONFIRM_MS;
+  }
+
+  static uint32_t doubled(uint32_t ms, uint32_t maxMs) {
+    return ms < maxMs / 2 ? 2 * ms : maxMs;
+  }
+
+  // Join beacons are for receivers that fell back: while every known one
+  // is following, only a late boot can need one, and that can wait
+  uint32_t joinMs(uint32_t nowMs) const {
+    for (uint8_t i = 0; i < LINK_MAX_NODES; i++) {
+      const LinkNode& n = _nodes[i];
+      if (n.known && (!fresh(n, nowMs) || n.epoch != _epoch || n.step != _step)) {
+        return LINK_JOIN_MS;
+      }
+    }
+    return LINK_BEACON_MAX_MS;
+  }
+
+  // Newly lost receivers; each counts once until it reports again
+  bool anyLost(uint32_t nowMs) {
+    bool lost = false;
+    for (uint8_t i = 0; i < LINK_MAX_NODES; i++) {
+      LinkNode& n = _nodes[i];
+      if (n.known && !n.missing && !fresh(n, nowMs)) {
+        n.missing = true;
+        lost = true;
+      }
+    }
+    return lost;
+  }
+
+  bool allConfirmed(uint32_t nowMs) const {
+    for (uint8_t i = 0; i < LINK_MAX_NODES; i++) {
+      const LinkNode& n = _nodes[i];
+      if (fresh(n, nowMs) && (n.epoch != _epoch || n.step != _step)) return false;
+    }
+    return true;
+  }
+
+  // Worst receiver's margin at a step, in quarter dB
+  int16_t margin(int16_t worstQ4, uint8_t step) const {
+    return (int16_t)(worstQ4 + 4 * (LINK_LADDER[step].powerDbm - LINK_FULL_POWER_DBM)
+                     - snrFloorQ4(LINK_LADDER[step].sf));
+  }
+
+  // Worst fresh receiver's normalised SNR; false when none has reported.
+  // allCurrent: every known receiver has reported this epoch.
+  bool worstReport(uint32_t nowMs, int16_t& worst, bool& allCurrent) {
+    bool any = false;
+    worst = 0x7FFF;
+    allCurrent = true;
+    for (uint8_t i = 0; i < LINK_MAX_NODES; i++) {
+      LinkNode& n = _nodes[i];
+      if (n.known && !fresh(n, nowMs)) {
+        // Missing: nothing faster until it reports, or it is forgotten
+        if (nowMs - n.heardMs >= LINK_FORGET_MS) n.known = n.missing = false;
+        else allCurrent = false;
+        continue;
+      }
+      if (!n.known) continue;
+      any = true;
+      if (n.snrQ4 < worst) worst = n.snrQ4;
+      if (n.epoch != _epoch) allCurrent = false;
+    }
+    return any;
+  }
+
+  uint8_t decide(uint32_t nowMs) {
+    int16_t worst;
+    bool    allCurrent;
+    if (!worstReport(nowMs, worst, allCurrent)) return _step;
+
+    if (_step > 0 && margin(worst, _step) < LINK_MARGIN_Q4 - LINK_HYSTERESIS_Q4) {
+      return (uint8_t)(_step - 1);
+    }
+    if ((int32_t)(nowMs - _holdUntilMs) >= 0) _ceiling = _top;
+    if (allCurrent && _step + 1 <= _ceiling && (int32_t)(nowMs - _upAfterMs) >= 0
+        && margin(worst, (uint8_t)(_step + 1)) >= LINK_MARGIN_Q4) {
+      return (uint8_t)(_step + 1);
+    }
+    return _step;
+  }
+
+  // Poll less at home (receivers there never fall back) while nothing can
+  // change: doubled while the next step up is well out of reach or on hold,
+  // kept while it is merely out of reach, back to LINK_BEACON_MS otherwise
+  uint32_t nextPollMs(uint32_t nowMs) {
+    int16_t worst;
+    bool    allCurrent;
+    if (_step != _family.homeStep || !worstReport(nowMs, worst, allCurrent)
+        || !allCurrent || (_step > 0 && margin(worst, _step) < LINK_MARGIN_Q4)) {
+      return LINK_BEACON_MS;
+    }
+    bool    blocked = _step >= _ceiling || (int32_t)(nowMs - _upAfterMs) < 0;
+    int16_t up = blocked ? -0x7FFF : margin(worst, (uint8_t)(_step + 1));
+    if (up < LINK_MARGIN_Q4 - LINK_HYSTERESIS_Q4) return doubled(_pollMs, LINK_BEACON_MAX_MS);
+    if (up < LINK_MARGIN_Q4) return _pollMs;
+    return LINK_BEACON_MS;
+  }
+
+  LinkFamily _family;
+  LinkNode   _nodes[LINK_MAX_NODES];
+  uint8_t    _step, _from, _target, _epoch, _left;
+  bool       _confirming, _recover;
+  uint8_t    _fetches;                          // re-sends after a step down
+  uint8_t    _top, _ceiling;                    // fastest step allowed, now
+  uint32_t   _switchMs, _beaconMs, _joinMs, _pollMs, _retryMs, _downMs;
+  uint32_t   _holdUntilMs, _upAfterMs, _quietUntilMs;
+  uint8_t    _slots;                            // highest node heard + 1
+  uint32_t   _changes, _failures;
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_LINK_H
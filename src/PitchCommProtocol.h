@@ -0,0 +1,458 @@
+/*
+ * ============================================================================
+ * PITCHCOMM PROTOCOL — shared by every receiver and the coach
+ * ============================================================================
+ * Header-only, no heap, no struct casts. Decoders are thin views that read
+ * fields straight out of the radio buffer; encoders are constexpr and return
+ * the wire image by value.
+ *
+ * Two packet families are in use:
+ *
+ *   SIGNAL (T-Deck → Heltec / Stick / T-Watch), 8 bytes
+ *     [type][pitch][zone][pickoff][thirdSign][pad][number lo][number hi]
+ *     This is the ESP32 in-memory layout of the original PitchSignal struct
+ *     (uint16_t number is 2-byte aligned, hence the pad byte).
+ *
+ *   COMPACT SIGNAL (same receivers), 3 bytes, bit-packed, MSB first
+ *     byte 0: [ver:2][type:1][pitch:3][pickoff:2]
+ *     byte 1: [zone:4][thirdSign:3][seq8:1]
+ *     byte 2: [seq7..0]
+ *     pitch 7 = none. The 9-bit sequence replaces the 16-bit counter, so
+ *     number() wraps at 512 on this format.
+ *
+ *   CALL (T-Deck → XIAO HUD / Armband), 6 bytes
+ *     [0xCC][ver][addr][cmd][seq][xor]
+ *     ver 0x02 asks each receiver for a CALL ACK (PitchCommArq.h).
+ *     addr 0x01..0x7F one device, 0x80..0x9F group 0..31, 0xFF everyone.
+ *   MASK CALL (same receivers), 9 bytes
+ *     [0xCC][ver][0x00][mask lo][mask][mask hi][cmd][seq][xor]
+ *     Any subset of devices 1..24 in one frame: bit n is device n + 1.
+ *   CALL ACK (receiver → coach), 4 bytes
+ *     [0xC8 | node:3][seq][rssi][xor]
+ *
+ *   LINK COMMAND (coach → receivers, either family), 5 bytes
+ *     [0xAD][step][epoch][left][xor]
+ *   LINK REPORT (receiver → coach), 7 bytes
+ *     [0xAE][node][step:4|rxStep:4][epoch][snr q4][rssi][xor]
+ *     Adaptive data rate, see PitchCommLink.h. The lengths differ from
+ *     every call / signal format, so receivers tell them apart by size.
+ *
+ * Written for C++11 (ESP32 Arduino 2.x, Seeed nRF52) — constexpr bodies are
+ * single return expressions on purpose.
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_PROTOCOL_H
+#define PITCHCOMM_PROTOCOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace pitchcomm {
+
+// Largest packet any receiver needs to buffer
+const size_t MAX_PACKET_LENGTH = 16;
+
+// ============================================================================
+// SIGNAL PACKET — PitchSignal wire image
+// ============================================================================
+const size_t  SIGNAL_LENGTH = 8;
+
+const uint8_t SIGNAL_PITCH  = 0;
+const uint8_t SIGNAL_RESET  = 1;
+
+const uint8_t PITCH_FB      = 0;
+const uint8_t PITCH_CB      = 1;
+const uint8_t PITCH_CH      = 2;
+const uint8_t PITCH_SL      = 3;
+const uint8_t PITCH_PO      = 4;
+const uint8_t PITCH_COUNT   = 5;
+const uint8_t PITCH_NONE    = 255;
+
+const uint8_t ZONE_MAX      = 9;
+const uint8_t PICKOFF_MAX   = 3;
+const uint8_t THIRD_MAX     = 4;
+
+struct SignalFrame {
+  uint8_t bytes[SIGNAL_LENGTH];
+};
+
+constexpr SignalFrame encodeSignal(uint8_t type, uint8_t pitch, uint8_t zone,
+                                   uint8_t pickoff, uint8_t thirdSign,
+                                   uint16_t number) {
+  return SignalFrame{{ type, pitch, zone, pickoff, thirdSign, 0,
+                       (uint8_t)(number & 0xFF), (uint8_t)(number >> 8) }};
+}
+
+// ============================================================================
+// COMPACT SIGNAL — 3-byte bit-packed encoding of the same fields
+// ============================================================================
+const size_t  COMPACT_LENGTH     = 3;
+const uint8_t COMPACT_VERSION    = 1;       // 2-bit field, 0 is reserved
+const uint8_t COMPACT_PITCH_NONE = 7;
+const uint16_t COMPACT_SEQ_MASK  = 0x1FF;
+
+struct CompactFrame {
+  uint8_t bytes[COMPACT_LENGTH];
+};
+
+constexpr CompactFrame encodeCompact(uint8_t type, uint8_t pitch, uint8_t zone,
+                                     uint8_t pickoff, uint8_t thirdSign,
+                                     uint16_t number) {
+  return CompactFrame{{
+    (uint8_t)((COMPACT_VERSION << 6) | ((type & 1) << 5)
+              | ((pitch < PITCH_COUNT ? pitch : COMPACT_PITCH_NONE) << 2)
+              | (pickoff & 3)),
+    (uint8_t)(((zone & 0xF) << 4) | ((thirdSign & 7) << 1) | ((number >> 8) & 1)),
+    (uint8_t)(number & 0xFF) }};
+}
+
+// Read-only view over a received signal packet, either format. Holds a
+// pointer into the caller's buffer; the buffer must outlive the view.
+class SignalView {
+public:
+  constexpr SignalView(const uint8_t* buf, size_t len) : _buf(buf), _len(len) {}
+
+  constexpr bool isCompact() const { return _len == COMPACT_LENGTH; }
+
+  constexpr bool valid() const {
+    return isCompact()
+      ? ((_buf[0] >> 6) == COMPACT_VERSION
+         && (((_buf[0] >> 2) & 7) < PITCH_COUNT
+             || ((_buf[0] >> 2) & 7) == COMPACT_PITCH_NONE)
+         && (_buf[1] >> 4) <= ZONE_MAX
+         && ((_buf[1] >> 1) & 7) <= THIRD_MAX)
+      : (_len == SIGNAL_LENGTH && _buf[0] <= SIGNAL_RESET);
+  }
+
+  constexpr uint8_t type() const {
+    return isCompact() ? (uint8_t)((_buf[0] >> 5) & 1) : _buf[0];
+  }
+  constexpr uint8_t pitch() const {
+    return isCompact()
+      ? (((_buf[0] >> 2) & 7) == COMPACT_PITCH_NONE ? PITCH_NONE : (uint8_t)((_buf[0] >> 2) & 7))
+      : _buf[1];
+  }
+  constexpr uint8_t zone() const {
+    return isCompact() ? (uint8_t)(_buf[1] >> 4) : _buf[2];
+  }
+  constexpr uint8_t pickoff() const {
+    return isCompact() ? (uint8_t)(_buf[0] & 3) : _buf[3];
+  }
+  constexpr uint8_t thirdSign() const {
+    return isCompact() ? (uint8_t)((_buf[1] >> 1) & 7) : _buf[4];
+  }
+  constexpr uint16_t number() const {
+    return isCompact() ? (uint16_t)(((_buf[1] & 1) << 8) | _buf[2])
+                       : (uint16_t)(_buf[6] | (_buf[7] << 8));
+  }
+
+  constexpr bool isReset()  const { return type() == SIGNAL_RESET; }
+  constexpr bool hasPitch() const { return pitch() < PITCH_COUNT; }
+
+private:
+  const uint8_t* _buf;
+  size_t         _len;
+};
+
+// ============================================================================
+// CALL PACKET — [0xCC][ver][addr][cmd][seq][xor]
+//               [0xCC][ver][0x00][mask x3][cmd][seq][xor]
+// ============================================================================
+const size_t  CALL_LENGTH      = 6;
+const size_t  CALL_MASK_LENGTH = 9;
+const uint8_t CALL_MAGIC    = 0xCC;
+const uint8_t CALL_VERSION  = 0x01;
+const uint8_t CALL_VERSION_ACK = 0x02;  // same frame, receivers answer with a CALL ACK
+
+// Address byte
+const uint8_t ADDR_MASK       = 0x00;   // 24-bit device mask follows
+const uint8_t ADDR_DEVICE_MAX = 0x7F;   // 0x01..0x7F: one device
+const uint8_t ADDR_GROUP      = 0x80;   // 0x80 | g: every member of group g
+const uint8_t ADDR_GROUPS     = 32;
+const uint8_t ADDR_ALL        = 0xFF;
+const uint8_t MASK_DEVICES    = 24;     // device ids a mask call can reach
+
+const uint8_t ADDR_CATCHER  = 0x01;
+const uint8_t ADDR_PITCHER  = 0x02;
+const uint8_t ADDR_FIELDER  = 0x03;     // 0x03..0x09, one per fielder
+
+const uint8_t GROUP_BATTERY = 0;        // catcher + pitcher
+const uint8_t GROUP_DEFENSE = 1;        // everyone on the field
+
+// Who a receiver answers to: its device id and the groups it is in
+struct CallAddress {
+  uint8_t  id;
+  uint32_t groups;          // bit g = member of group g
+};
+
+constexpr uint8_t  callGroup(uint8_t group) { return (uint8_t)(ADDR_GROUP | (group & 0x1F)); }
+constexpr uint32_t deviceBit(uint8_t id)    { return id >= 1 && id <= MASK_DEVICES ? 1UL << (id - 1) : 0; }
+
+const uint8_t CMD_FB_IN     = 0x01;
+const uint8_t CMD_FB_OUT    = 0x02;
+const uint8_t CMD_CURVE     = 0x03;
+const uint8_t CMD_CHANGE    = 0x04;
+const uint8_t CMD_SLIDER    = 0x05;
+const uint8_t CMD_CUTTER    = 0x06;
+const uint8_t CMD_SPLIT     = 0x07;
+const uint8_t CMD_SCREW     = 0x08;
+const uint8_t CMD_PICK1     = 0x09;
+const uint8_t CMD_PICK2     = 0x0A;
+const uint8_t CMD_PITCHOUT  = 0x10;
+const uint8_t CMD_TIMEOUT   = 0xFF;
+
+struct CallFrame {
+  uint8_t bytes[CALL_LENGTH];
+};
+
+constexpr uint8_t callChecksum(uint8_t addr, uint8_t cmd, uint8_t seq,
+                               uint8_t ver = CALL_VERSION) {
+  return (uint8_t)(CALL_MAGIC ^ ver ^ addr ^ cmd ^ seq);
+}
+
+constexpr CallFrame encodeCall(uint8_t addr, uint8_t cmd, uint8_t seq, bool ack = false) {
+  return CallFrame{{ CALL_MAGIC, ack ? CALL_VERSION_ACK : CALL_VERSION, addr, cmd, seq,
+                     callChecksum(addr, cmd, seq, ack ? CALL_VERSION_ACK : CALL_VERSION) }};
+}
+
+struct CallMaskFrame {
+  uint8_t bytes[CALL_MASK_LENGTH];
+};
+
+// devices: OR of deviceBit(id) for every receiver the call is for
+constexpr CallMaskFrame encodeMaskCall(uint32_t devices, uint8_t cmd, uint8_t seq,
+                                       bool ack = false) {
+  return CallMaskFrame{{ CALL_MAGIC, ack ? CALL_VERSION_ACK : CALL_VERSION, ADDR_MASK,
+                         (uint8_t)devices, (uint8_t)(devices >> 8), (uint8_t)(devices >> 16),
+                         cmd, seq,
+                         (uint8_t)(callChecksum(ADDR_MASK, cmd, seq,
+                                                ack ? CALL_VERSION_ACK : CALL_VERSION)
+                                   ^ (uint8_t)devices ^ (uint8_t)(devices >> 8)
+                                   ^ (uint8_t)(devices >> 16)) }};
+}
+
+class CallView {
+public:
+  constexpr CallView(const uint8_t* buf, size_t len) : _buf(buf), _len(len) {}
+
+  // Length, magic, version and XOR checksum — address is checked separately
+  constexpr bool wellFormed() const {
+    return _len == CALL_LENGTH
+         ? _buf[0] == CALL_MAGIC
+           && (_buf[1] == CALL_VERSION || _buf[1] == CALL_VERSION_ACK)
+           && _buf[2] != ADDR_MASK
+           && _buf[5] == (uint8_t)(_buf[0] ^ _buf[1] ^ _buf[2] ^ _buf[3] ^ _buf[4])
+         : _len == CALL_MASK_LENGTH
+           && _buf[0] == CALL_MAGIC
+           && (_buf[1] == CALL_VERSION || _buf[1] == CALL_VERSION_ACK)
+           && _buf[2] == ADDR_MASK
+           && _buf[8] == (uint8_t)(_buf[0] ^ _buf[1] ^ _buf[2] ^ _buf[3] ^ _buf[4]
+                                   ^ _buf[5] ^ _buf[6] ^ _buf[7]);
+  }
+
+  // Per-device filter: unicast to me, a group I am in, my mask bit, or all
+  constexpr bool addressedTo(const CallAddress& me) const {
+    return _buf[2] == ADDR_ALL
+        || (_buf[2] == ADDR_MASK ? (mask() & deviceBit(me.id)) != 0
+          : _buf[2] <= ADDR_DEVICE_MAX ? _buf[2] == me.id
+          : _buf[2] < ADDR_GROUP + ADDR_GROUPS && ((me.groups >> (_buf[2] & 0x1F)) & 1));
+  }
+
+  constexpr bool valid(const CallAddress& me) const {
+    return wellFormed() && addressedTo(me);
+  }
+
+  // Unicast id only (and broadcast / mask), no groups
+  constexpr bool valid(uint8_t myAddr = ADDR_CATCHER) const {
+    return wellFormed()
+        && (_buf[2] == myAddr || _buf[2] == ADDR_ALL
+            || (_buf[2] == ADDR_MASK && (mask() & deviceBit(myAddr)) != 0));
+  }
+
+  constexpr uint8_t  addr() const { return _buf[2]; }
+  constexpr uint32_t mask() const {
+    return _buf[2] != ADDR_MASK ? 0
+         : (uint32_t)_buf[3] | ((uint32_t)_buf[4] << 8) | ((uint32_t)_buf[5] << 16);
+  }
+  constexpr uint8_t cmd()  const { return _buf[_buf[2] == ADDR_MASK ? 6 : 3]; }
+  constexpr uint8_t seq()  const { return _buf[_buf[2] == ADDR_MASK ? 7 : 4]; }
+  constexpr bool    ackRequested() const { return _buf[1] == CALL_VERSION_ACK; }
+
+  constexpr const uint8_t* data()   const { return _buf; }
+  constexpr size_t         length() const { return _len; }
+
+private:
+  const uint8_t* _buf;
+  size_t         _len;
+};
+
+// ============================================================================
+// CALL ACK — [0xC8 | node][seq][rssi][xor]
+// ============================================================================
+const size_t  CALL_ACK_LENGTH = 4;
+const uint8_t CALL_ACK_MAGIC  = 0xC8;     // low 3 bits carry the node id
+
+struct CallAckFrame {
+  uint8_t bytes[CALL_ACK_LENGTH];
+};
+
+constexpr CallAckFrame encodeCallAck(uint8_t node, uint8_t seq, int8_t rssi) {
+  return CallAckFrame{{ (uint8_t)(CALL_ACK_MAGIC | (node & 7)), seq, (uint8_t)rssi,
+                        (uint8_t)((CALL_ACK_MAGIC | (node & 7)) ^ seq ^ (uint8_t)rssi) }};
+}
+
+class CallAckView {
+public:
+  constexpr CallAckView(const uint8_t* buf, size_t len) : _buf(buf), _len(len) {}
+
+  constexpr bool valid() const {
+    return _len == CALL_ACK_LENGTH
+        && (_buf[0] & 0xF8) == CALL_ACK_MAGIC
+        && _buf[3] == (uint8_t)(_buf[0] ^ _buf[1] ^ _buf[2]);
+  }
+
+  constexpr uint8_t node() const { return (uint8_t)(_buf[0] & 7); }
+  constexpr uint8_t seq()  const { return _buf[1]; }
+  constexpr int8_t  rssi() const { return (int8_t)_buf[2]; }
+
+private:
+  const uint8_t* _buf;
+  size_t         _len;
+};
+
+// ============================================================================
+// LINK FRAMES — adaptive data rate (PitchCommLink.h)
+// ============================================================================
+const size_t  LINK_COMMAND_LENGTH = 5;
+const size_t  LINK_REPORT_LENGTH  = 7;
+const uint8_t LINK_COMMAND_MAGIC  = 0xAD;
+const uint8_t LINK_REPORT_MAGIC   = 0xAE;
+
+// "Listen on ladder step `step` from now on." epoch changes with every
+// step change; left counts the repeats still to come at the current step.
+struct LinkCommandFrame {
+  uint8_t bytes[LINK_COMMAND_LENGTH];
+};
+
+constexpr LinkCommandFrame encodeLinkCommand(uint8_t step, uint8_t epoch, uint8_t left) {
+  return LinkCommandFrame{{ LINK_COMMAND_MAGIC, step, epoch, left,
+                            (uint8_t)(LINK_COMMAND_MAGIC ^ step ^ epoch ^ left) }};
+}
+
+class LinkCommandView {
+public:
+  constexpr LinkCommandView(const uint8_t* buf, size_t len) : _buf(buf), _len(len) {}
+
+  constexpr bool valid() const {
+    return _len == LINK_COMMAND_LENGTH
+        && _buf[0] == LINK_COMMAND_MAGIC
+        && _buf[4] == (uint8_t)(_buf[0] ^ _buf[1] ^ _buf[2] ^ _buf[3]);
+  }
+
+  constexpr uint8_t step()  const { return _buf[1]; }
+  constexpr uint8_t epoch() const { return _buf[2]; }
+  constexpr uint8_t left()  const { return _buf[3]; }
+
+private:
+  const uint8_t* _buf;
+  size_t         _len;
+};
+
+// A receiver's answer to a command: the step it now listens on, the step
+// the command arrived on and that packet's SNR (quarter dB) and RSSI.
+struct LinkReportFrame {
+  uint8_t bytes[LINK_REPORT_LENGTH];
+};
+
+constexpr uint8_t linkReportChecksum(uint8_t node, uint8_t steps, uint8_t epoch,
+                                     uint8_t snr, uint8_t rssi) {
+  return (uint8_t)(LINK_REPORT_MAGIC ^ node ^ steps ^ epoch ^ snr ^ rssi);
+}
+
+constexpr LinkReportFrame encodeLinkReport(uint8_t node, uint8_t step, uint8_t rxStep,
+                                           uint8_t epoch, int8_t snrQ4, int8_t rssi) {
+  return LinkReportFrame{{ LINK_REPORT_MAGIC, node,
+                           (uint8_t)((step << 4) | (rxStep & 0x0F)), epoch,
+                           (uint8_t)snrQ4, (uint8_t)rssi,
+                           linkReportChecksum(node, (uint8_t)((step << 4) | (rxStep & 0x0F)),
+                                              epoch, (uint8_t)snrQ4, (uint8_t)rssi) }};
+}
+
+class LinkReportView {
+public:
+  constexpr LinkReportView(const uint8_t* buf, size_t len) : _buf(buf), _len(len) {}
+
+  constexpr bool valid() const {
+    return _len == LINK_REPORT_LENGTH
+        && _buf[0] == LINK_REPORT_MAGIC
+        && _buf[6] == linkReportChecksum(_buf[1], _buf[2], _buf[3], _buf[4], _buf[5]);
+  }
+
+  constexpr uint8_t node()   const { return _buf[1]; }
+  constexpr uint8_t step()   const { return (uint8_t)(_buf[2] >> 4); }
+  constexpr uint8_t rxStep() const { return (uint8_t)(_buf[2] & 0x0F); }
+  constexpr uint8_t epoch()  const { return _buf[3]; }
+  constexpr int8_t  snrQ4()  const { return (int8_t)_buf[4]; }
+  constexpr int8_t  rssi()   const { return (int8_t)_buf[5]; }
+
+private:
+  const uint8_t* _buf;
+  size_t         _len;
+};
+
+// ============================================================================
+// COMPILE-TIME SELF CHECK
+// ============================================================================
+namespace detail {
+constexpr SignalFrame kSignalProbe = encodeSignal(SIGNAL_PITCH, PITCH_SL, 7, 2, 3, 0x1234);
+constexpr CallFrame   kCallProbe   = encodeCall(ADDR_CATCHER, CMD_PICK2, 0x5A);
+constexpr CompactFrame kCompactProbe = encodeCompact(SIGNAL_PITCH, PITCH_NONE, 9, 3, 4, 0x1A5);
+constexpr LinkReportFrame kReportProbe = encodeLinkReport(2, 3, 1, 0x41, -30, -97);
+constexpr CallFrame   kAckCallProbe = encodeCall(ADDR_CATCHER, CMD_CURVE, 0x7E, true);
+constexpr CallAckFrame kAckProbe    = encodeCallAck(5, 0x7E, -88);
+constexpr CallMaskFrame kMaskProbe  = encodeMaskCall(deviceBit(1) | deviceBit(20), CMD_SLIDER, 0x33);
+constexpr CallFrame   kGroupProbe   = encodeCall(callGroup(3), CMD_CHANGE, 0x44);
+}
+
+static_assert(SignalView(detail::kSignalProbe.bytes, SIGNAL_LENGTH).valid()
+           && SignalView(detail::kSignalProbe.bytes, SIGNAL_LENGTH).number() == 0x1234
+           && SignalView(detail::kSignalProbe.bytes, SIGNAL_LENGTH).pitch() == PITCH_SL,
+              "signal encode/decode mismatch");
+static_assert(SignalView(detail::kCompactProbe.bytes, COMPACT_LENGTH).valid()
+           && SignalView(detail::kCompactProbe.bytes, COMPACT_LENGTH).pitch() == PITCH_NONE
+           && SignalView(detail::kCompactProbe.bytes, COMPACT_LENGTH).zone() == 9
+           && SignalView(detail::kCompactProbe.bytes, COMPACT_LENGTH).number() == 0x1A5,
+              "compact encode/decode mismatch");
+static_assert(CallView(detail::kCallProbe.bytes, CALL_LENGTH).valid()
+           && CallView(detail::kCallProbe.bytes, CALL_LENGTH).cmd() == CMD_PICK2
+           && !CallView(detail::kCallProbe.bytes, CALL_LENGTH).valid(0x02),
+              "call encode/decode mismatch");
+static_assert(CallView(detail::kAckCallProbe.bytes, CALL_LENGTH).valid()
+           && CallView(detail::kAckCallProbe.bytes, CALL_LENGTH).ackRequested()
+           && !CallView(detail::kCallProbe.bytes, CALL_LENGTH).ackRequested()
+           && CallAckView(detail::kAckProbe.bytes, CALL_ACK_LENGTH).valid()
+           && CallAckView(detail::kAckProbe.bytes, CALL_ACK_LENGTH).node() == 5
+           && CallAckView(detail::kAckProbe.bytes, CALL_ACK_LENGTH).seq() == 0x7E
+           && CallAckView(detail::kAckProbe.bytes, CALL_ACK_LENGTH).rssi() == -88,
+              "call ack encode/decode mismatch");
+static_assert(CallView(detail::kMaskProbe.bytes, CALL_MASK_LENGTH).valid(CallAddress{ 20, 0 })
+           && CallView(detail::kMaskProbe.bytes, CALL_MASK_LENGTH).valid()
+           && !CallView(detail::kMaskProbe.bytes, CALL_MASK_LENGTH).valid(CallAddress{ 2, 0 })
+           && CallView(detail::kMaskProbe.bytes, CALL_MASK_LENGTH).cmd() == CMD_SLIDER
+           && CallView(detail::kMaskProbe.bytes, CALL_MASK_LENGTH).seq() == 0x33
+           && !CallView(detail::kMaskProbe.bytes, CALL_LENGTH).wellFormed()
+           && CallView(detail::kGroupProbe.bytes, CALL_LENGTH).valid(CallAddress{ 9, 1UL << 3 })
+           && !CallView(detail::kGroupProbe.bytes, CALL_LENGTH).valid(CallAddress{ 9, 1UL << 2 })
+           && CallView(detail::kGroupProbe.bytes, CALL_LENGTH).seq() == 0x44,
+              "addressed call encode/decode mismatch");
+static_assert(LinkReportView(detail::kReportProbe.bytes, LINK_REPORT_LENGTH).valid()
+           && LinkReportView(detail::kReportProbe.bytes, LINK_REPORT_LENGTH).step() == 3
+           && LinkReportView(detail::kReportProbe.bytes, LINK_REPORT_LENGTH).rxStep() == 1
+           && LinkReportView(detail::kReportProbe.bytes, LINK_REPORT_LENGTH).snrQ4() == -30
+           && LinkReportView(detail::kReportProbe.bytes, LINK_REPORT_LENGTH).rssi() == -97,
+              "link report encode/decode mismatch");
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_PROTOCOL_H
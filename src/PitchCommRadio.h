@@ -0,0 +1,251 @@
+/*
+ * ============================================================================
+ * PITCHCOMM RADIO — named LoRa profiles shared by every firmware
+ * ============================================================================
+ * Every setting a coach and its receivers must agree on is one row of
+ * RADIO_PROFILES. beginProfile() / applyProfile() program all of it, so
+ * no firmware calls setSpreadingFactor() or keeps RF_* macros of its own:
+ *
+ *   profile      SF  BW   CR   preamble  CRC  header    LDRO  sync  dBm
+ *   LongRange    10  125  4/8     8      on   explicit  off   0x12   22
+ *   Balanced      9  125  4/5     8      on   explicit  off   0x12   22
+ *   LowLatency    7  125  4/5     8      on   explicit  off   0x34   22
+ *
+ * LongRange is what the Heltec, Stick and T-Watch ran (SF10, sync 0x12) and
+ * LowLatency what the XIAO HUD and armband ran (SF7, sync 0x34). Each stays
+ * its firmware's default, so today's coaches still reach every receiver.
+ * A profile sets the radio only, not the frame format: a signal receiver
+ * moved to LowLatency hears call frames it does not decode.
+ *
+ * The receivers take frames of several lengths, so every profile keeps the
+ * explicit header. A profile with implicitHeader needs implicitLength, the
+ * one length it carries. LDRO is forced rather than left to RadioLib, and
+ * must match the airtime model's automatic rule (static_assert below), so
+ * Host_Bench airtime numbers stay exact. Link adaptation changes only the
+ * SF, and no ladder step needs LDRO at 125 kHz.
+ *
+ * A receiver keeps its profile across power cycles in a ProfileStore:
+ *
+ *   ESP32-S3   NVS (Preferences namespace "pitchcomm", key "profile")
+ *   nRF52840   InternalFS file /profile (Adafruit LittleFS)
+ *   other      RAM (host sim)
+ *
+ * "profile <name or index>" on USB serial stores a profile and applies it
+ * at once. Link adaptation then starts over from that profile's home step.
+ *
+ * Receiver usage (see the Heltec's setupLoRa() / loop()):
+ *   pitchcomm::ProfileStore profileStore;
+ *   pitchcomm::ProfileConsole console;
+ *   const RadioProfile& p = radioProfile(profileStore.load(RADIO_PROFILE));
+ *   beginProfile(radio, p, LORA_TCXO_V);  link.setFamily(linkFamily(p));
+ *   if (console.poll(Serial, id) && profileStore.save(id)) applyProfile(radio, radioProfile(id));
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_RADIO_H
+#define PITCHCOMM_RADIO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <PitchCommAirtime.h>
+#include <PitchCommLink.h>
+
+#if defined(ESP32)
+#include <Preferences.h>
+#elif defined(ARDUINO_ARCH_NRF52)
+#include <Adafruit_LittleFS.h>
+#include <InternalFileSystem.h>
+#endif
+
+namespace pitchcomm {
+
+// ============================================================================
+// PROFILES
+// ============================================================================
+struct RadioProfile {
+  const char* name;
+  float       freqMhz;
+  LoRaModem   modem;            // SF, BW, CR, preamble, CRC, implicit header
+  uint8_t     implicitLength;   // payload length when modem.implicitHeader
+  bool        ldro;             // low data rate optimize
+  uint8_t     syncWord;
+  int8_t      powerDbm;
+};
+
+const uint8_t PROFILE_LONG_RANGE  = 0;
+const uint8_t PROFILE_BALANCED    = 1;
+const uint8_t PROFILE_LOW_LATENCY = 2;
+const uint8_t PROFILE_COUNT       = 3;
+
+constexpr RadioProfile RADIO_PROFILES[PROFILE_COUNT] = {
+  { "LongRange",  915.0f, MODEM_SIGNAL_SF10,                   0, false, 0x12, 22 },
+  { "Balanced",   915.0f, { 9, 125000, 5, 8, true, false },    0, false, 0x12, 22 },
+  { "LowLatency", 915.0f, MODEM_CALL_SF7,                      0, false, 0x34, 22 },
+};
+
+// Out-of-range ids get LongRange, the setting the oldest coach uses
+constexpr const RadioProfile& radioProfile(uint8_t id) {
+  return RADIO_PROFILES[id < PROFILE_COUNT ? id : PROFILE_LONG_RANGE];
+}
+
+namespace detail {
+constexpr bool profileConsistent(uint8_t i) {
+  return i == PROFILE_COUNT
+      || (RADIO_PROFILES[i].ldro == lowDataRateOptimize(RADIO_PROFILES[i].modem)
+          && (!RADIO_PROFILES[i].modem.implicitHeader || RADIO_PROFILES[i].implicitLength > 0)
+          && profileConsistent(i + 1));
+}
+
+constexpr uint8_t ladderStep(uint8_t sf, uint8_t step) {
+  return step == LINK_STEPS || LINK_LADDER[step].sf == sf ? step : ladderStep(sf, step + 1);
+}
+}
+
+static_assert(detail::profileConsistent(0),
+              "profile LDRO must match the airtime rule; implicit header needs a length");
+static_assert(RADIO_PROFILES[PROFILE_LONG_RANGE].modem.sf == 10
+           && RADIO_PROFILES[PROFILE_LOW_LATENCY].modem.sf == 7,
+              "LongRange / LowLatency are the settings today's coaches use");
+
+// The link adaptation family a profile starts from: its own modem, with the
+// first ladder step at its SF as home
+constexpr LinkFamily linkFamily(const RadioProfile& p) {
+  return LinkFamily{ p.modem, detail::ladderStep(p.modem.sf, 0) };
+}
+
+static_assert(detail::ladderStep(RADIO_PROFILES[PROFILE_LONG_RANGE].modem.sf, 0) == LINK_SIGNAL.homeStep
+           && detail::ladderStep(RADIO_PROFILES[PROFILE_LOW_LATENCY].modem.sf, 0) == LINK_CALL.homeStep
+           && detail::ladderStep(RADIO_PROFILES[PROFILE_BALANCED].modem.sf, 0) < LINK_STEPS,
+              "every profile's SF must be on the link ladder");
+
+// Profile by name (any case) or by index digit; NULL if none matches
+inline const RadioProfile* findProfile(const char* name, uint8_t* id = NULL) {
+  for (uint8_t i = 0; i < PROFILE_COUNT; i++) {
+    const char* a = name;
+    const char* b = RADIO_PROFILES[i].name;
+    while (*a && *b && (*a | 0x20) == (*b | 0x20)) { a++; b++; }
+    bool match = (*a == '\0' && *b == '\0') || (name[0] == '0' + i && name[1] == '\0');
+    if (match) {
+      if (id) *id = i;
+      return &RADIO_PROFILES[i];
+    }
+  }
+  return NULL;
+}
+
+// ============================================================================
+// RADIO
+// ============================================================================
+// Program every profile setting; returns the first RadioLib error (0 = OK)
+template <typename Radio>
+int16_t applyProfile(Radio& radio, const RadioProfile& p) {
+  int16_t state = radio.setFrequency(p.freqMhz);
+  if (!state) state = radio.setBandwidth(p.modem.bwHz / 1000.0f);
+  if (!state) state = radio.setSpreadingFactor(p.modem.sf);
+  if (!state) state = radio.setCodingRate(p.modem.cr);
+  if (!state) state = radio.setSyncWord(p.syncWord);
+  if (!state) state = radio.setOutputPower(p.powerDbm);
+  if (!state) state = radio.setPreambleLength(p.modem.preamble);
+  if (!state) state = radio.setCRC(p.modem.crc ? 2 : 0);
+  if (!state) state = radio.forceLDRO(p.ldro);
+  if (!state) state = p.modem.implicitHeader ? radio.implicitHeader(p.implicitLength)
+                                             : radio.explicitHeader();
+  return state;
+}
+
+// Bring the radio up on a profile. tcxoV is the board's TCXO supply.
+template <typename Radio>
+int16_t beginProfile(Radio& radio, const RadioProfile& p, float tcxoV) {
+  int16_t state = radio.begin(p.freqMhz, p.modem.bwHz / 1000.0f, p.modem.sf, p.modem.cr,
+                              p.syncWord, p.powerDbm, p.modem.preamble, tcxoV);
+  return state ? state : applyProfile(radio, p);
+}
+
+// ============================================================================
+// STORED SETTING
+// ============================================================================
+class ProfileStore {
+public:
+  ProfileStore() : _id(PROFILE_COUNT) {}
+
+  // The stored profile id, or fallback when none is stored
+  uint8_t load(uint8_t fallback) {
+    uint8_t id = PROFILE_COUNT;
+#if defined(ESP32)
+    Preferences prefs;
+    if (prefs.begin("pitchcomm", true)) {
+      id = prefs.getUChar("profile", PROFILE_COUNT);
+      prefs.end();
+    }
+#elif defined(ARDUINO_ARCH_NRF52)
+    Adafruit_LittleFS_Namespace::File f(InternalFS);
+    if (InternalFS.begin() && f.open("/profile", FILE_O_READ)) {
+      if (f.read(&id, 1) != 1) id = PROFILE_COUNT;
+      f.close();
+    }
+#else
+    id = _id;
+#endif
+    return id < PROFILE_COUNT ? id : fallback;
+  }
+
+  bool save(uint8_t id) {
+    if (id >= PROFILE_COUNT) return false;
+#if defined(ESP32)
+    Preferences prefs;
+    if (!prefs.begin("pitchcomm", false)) return false;
+    bool ok = prefs.putUChar("profile", id) == 1;
+    prefs.end();
+    return ok;
+#elif defined(ARDUINO_ARCH_NRF52)
+    if (!InternalFS.begin()) return false;
+    InternalFS.remove("/profile");
+    Adafruit_LittleFS_Namespace::File f(InternalFS);
+    if (!f.open("/profile", FILE_O_WRITE)) return false;
+    bool ok = f.write(&id, 1) == 1;
+    f.close();
+    return ok;
+#else
+    _id = id;
+    return true;
+#endif
+  }
+
+private:
+  uint8_t _id;                  // host sim only
+};
+
+// ============================================================================
+// SERIAL COMMAND
+// ============================================================================
+// Collects "profile <name or index>" lines from a serial port. Anything
+// else is dropped.
+class ProfileConsole {
+public:
+  ProfileConsole() : _len(0) {}
+
+  // True with the profile id once a valid command line has arrived
+  template <typename Port>
+  bool poll(Port& port, uint8_t& id) {
+    while (port.available() > 0) {
+      int c = port.read();
+      if (c != '\n' && c != '\r') {
+        if (_len < sizeof(_line) - 1) _line[_len++] = (char)c;
+        continue;
+      }
+      _line[_len] = '\0';
+      _len = 0;
+      if (strncmp(_line, "profile ", 8) == 0 && findProfile(_line + 8, &id)) return true;
+    }
+    return false;
+  }
+
+private:
+  char    _line[24];
+  uint8_t _len;
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_RADIO_H
@@ -0,0 +1,34 @@
+/*
+ * ============================================================================
+ * PITCHCOMM REPLY — receiver -> coach transmit between receptions
+ * ============================================================================
+ * Receivers only listen, except for the short frames they send back to the
+ * coach: link reports (PitchCommLink.h) and call ACKs (PitchCommArq.h).
+ * sendReply() is the one place that turns the radio around for them.
+ *
+ * DIO1 is detached for the transmit so TX done does not look like a
+ * received packet; RX is re-armed afterwards.
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_REPLY_H
+#define PITCHCOMM_REPLY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace pitchcomm {
+
+// Transmit bytes[len] and go back to receive; returns the RadioLib state
+template <typename Radio>
+int16_t sendReply(Radio& radio, const uint8_t* bytes, size_t len, void (*dio1)(void)) {
+  radio.clearDio1Action();
+  int16_t state = radio.transmit(bytes, len);
+  radio.setDio1Action(dio1);
+  radio.startReceive();
+  return state;
+}
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_REPLY_H
@@ -0,0 +1,155 @@
+/*
+ * ============================================================================
+ * PITCHCOMM RX EVENT — DIO1 interrupt to loop() wakeup
+ * ============================================================================
+ * Replaces "poll a volatile flag, then delay(10)" in the receivers. The DIO1
+ * ISR calls notifyFromIsr(); loop() calls wait(), which sleeps until the ISR
+ * fires or the timeout passes:
+ *
+ *   ESP32-S3   FreeRTOS direct-to-task notification to the loop task
+ *   nRF52840   FreeRTOS binary semaphore (Adafruit-based core); the idle
+ *              task parks the CPU in WFE while loop() is blocked
+ *   other      1 ms poll of a volatile flag (host sim, mbed core)
+ *
+ * wait() can return false before the timeout (poll path, or a wakeup left
+ * over from a packet already handled); callers treat false as "no packet,
+ * run idle work".
+ *
+ * The ISR stamps micros(); wait() measures ISR-to-handler latency when it
+ * returns true and keeps count / min / mean / max for logging.
+ *
+ * Usage:
+ *   pitchcomm::RxEvent rxEvent;
+ *   void setFlag() { rxEvent.notifyFromIsr(); }
+ *   setup():  rxEvent.begin(); radio.setDio1Action(setFlag);
+ *   loop():   if (rxEvent.wait(100)) { read packet ... }
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_RX_EVENT_H
+#define PITCHCOMM_RX_EVENT_H
+
+#include <Arduino.h>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#define PITCHCOMM_ISR_ATTR IRAM_ATTR
+#else
+#define PITCHCOMM_ISR_ATTR
+#endif
+
+namespace pitchcomm {
+
+// Running last / min / mean / max of a microsecond interval
+class LatencyStats {
+public:
+  LatencyStats() : _lastUs(0), _count(0), _minUs(0xFFFFFFFFu), _maxUs(0), _sumUs(0) {}
+
+  void add(uint32_t us) {
+    _lastUs = us;
+    _count++;
+    _sumUs += us;
+    if (us < _minUs) _minUs = us;
+    if (us > _maxUs) _maxUs = us;
+  }
+
+  void reset() { *this = LatencyStats(); }
+
+  uint32_t lastUs() const { return _lastUs; }
+  uint32_t count() const  { return _count; }
+  uint32_t minUs() const  { return _count ? _minUs : 0; }
+  uint32_t maxUs() const  { return _maxUs; }
+  uint32_t meanUs() const { return _count ? (uint32_t)(_sumUs / _count) : 0; }
+
+private:
+  uint32_t _lastUs;
+  uint32_t _count, _minUs, _maxUs;
+  uint64_t _sumUs;
+};
+
+class RxEvent {
+public:
+  RxEvent() : _pending(false), _isrUs(0) {
+#if defined(ESP32)
+    _task = NULL;
+#elif defined(ARDUINO_ARCH_NRF52)
+    _sem = NULL;
+#endif
+  }
+
+  // Call from the task that will wait() (setup() runs on the loop task),
+  // before attaching the ISR. Calling it again from another task moves the
+  // wakeups there.
+  void begin() {
+#if defined(ESP32)
+    _task = xTaskGetCurrentTaskHandle();
+#elif defined(ARDUINO_ARCH_NRF52)
+    if (_sem == NULL) _sem = xSemaphoreCreateBinary();
+#endif
+  }
+
+  PITCHCOMM_ISR_ATTR void notifyFromIsr() {
+    _isrUs   = micros();
+    _pending = true;
+#if defined(ESP32)
+    if (_task != NULL) {
+      BaseType_t woken = pdFALSE;
+      vTaskNotifyGiveFromISR(_task, &woken);
+      if (woken) portYIELD_FROM_ISR();
+    }
+#elif defined(ARDUINO_ARCH_NRF52)
+    if (_sem != NULL) {
+      BaseType_t woken = pdFALSE;
+      xSemaphoreGiveFromISR(_sem, &woken);
+      portYIELD_FROM_ISR(woken);
+    }
+#endif
+  }
+
+  // True when DIO1 fired since the last call that returned true
+  bool wait(uint32_t timeoutMs) {
+    if (!_pending) {
+#if defined(ESP32)
+      if (_task != NULL) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs));
+      else delay(1);
+#elif defined(ARDUINO_ARCH_NRF52)
+      if (_sem != NULL) xSemaphoreTake(_sem, pdMS_TO_TICKS(timeoutMs));
+      else delay(1);
+#else
+      (void)timeoutMs;
+      delay(1);
+#endif
+    }
+    if (!_pending) return false;
+    _pending = false;
+
+    _latency.add(micros() - _isrUs);
+    return true;
+  }
+
+  // micros() at the most recent DIO1 interrupt
+  uint32_t isrUs() const { return _isrUs; }
+
+  // ---- ISR-to-handler latency ----
+  const LatencyStats& latency() const { return _latency; }
+  uint32_t lastUs() const { return _latency.lastUs(); }
+  uint32_t count() const  { return _latency.count(); }
+  uint32_t minUs() const  { return _latency.minUs(); }
+  uint32_t maxUs() const  { return _latency.maxUs(); }
+  uint32_t meanUs() const { return _latency.meanUs(); }
+
+private:
+  volatile bool     _pending;
+  volatile uint32_t _isrUs;
+  LatencyStats      _latency;
+#if defined(ESP32)
+  TaskHandle_t      _task;
+#elif defined(ARDUINO_ARCH_NRF52)
+  SemaphoreHandle_t _sem;
+#endif
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_RX_EVENT_H
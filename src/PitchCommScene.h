@@ -0,0 +1,444 @@
+/*
+ * ============================================================================
+ * PITCHCOMM SCENE — one call description, drawn by any receiver panel
+ * ============================================================================
+ * Every receiver shows the same few things for a call: a primary string in
+ * its largest font, an optional detail (zone digit, second call line), a
+ * few small badges (#n, PK1, 3A, RSSI) and, for urgent calls, the whole
+ * screen inverted. A Scene holds exactly that, in fixed buffers; the
+ * firmware's SceneLayout says where each part goes on its panel:
+ *
+ *   Scene        what to show     signalScene() / callScene()
+ *   SceneLayout  where and how    per receiver, const data next to its
+ *                                 draw code (fonts are indices into the
+ *                                 backend's font table)
+ *   SceneBackend the panel API    specialised per graphics library
+ *
+ * renderScene() is a template over the backend, so each receiver compiles
+ * straight calls into its own library with no virtual dispatch:
+ *
+ *   SceneBackend<U8G2>          U8g2 full buffer (Heltec V3, Stick, HUD)
+ *   SceneBackend<TFT_eSPI>      TFT_eSPI, panel or sprite (T-Watch S3)
+ *   SceneBackend<Adafruit_GFX>  GFX canvas / GxEPD2 (Armband)
+ *   SceneBackend<FrameBuffer>   headless 1 bpp or RGB565 memory frame
+ *
+ * The library backends are compiled only when that library's header was
+ * included first (its include guard is defined). FrameBuffer needs nothing
+ * but this header; it draws with a built-in 5x7 font scaled per slot and is
+ * what Host_Bench scene_bench uses to time layouts and check golden images
+ * on the host.
+ *
+ * Usage:
+ *   #include <U8g2lib.h>
+ *   #include <PitchCommScene.h>
+ *   const uint8_t* const fonts[] = { u8g2_font_helvB14_tr, ... };
+ *   pitchcomm::SceneBackend<U8G2> panel(display, fonts);
+ *   pitchcomm::Scene scene;
+ *   pitchcomm::callScene("CURVE", "BALL", false, scene);
+ *   pitchcomm::renderScene(panel, scene, callLayout);
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_SCENE_H
+#define PITCHCOMM_SCENE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <PitchCommProtocol.h>
+
+namespace pitchcomm {
+
+// ============================================================================
+// SCENE — what a receiver shows for one call
+// ============================================================================
+const uint8_t  SCENE_TEXT_MAX  = 12;   // incl. NUL; "FASTBALL", "1ST BASE", "-120dBm"
+const uint8_t  SCENE_BADGE_MAX = 3;
+
+// Text colours are RGB565; 1 bpp panels only see ink or no ink
+const uint16_t SCENE_WHITE = 0xFFFF;
+const uint16_t SCENE_RED   = 0xF800;
+const uint16_t SCENE_BLUE  = 0x001F;
+
+// Layout rows for signal frames; call receivers use SCENE_CALL only
+enum SceneStyleId : uint8_t {
+  SCENE_PITCH,                          // pitch name, zone as detail
+  SCENE_RESET,
+  SCENE_PICKOFF,                        // pickoff sign alone
+  SCENE_THIRD,                          // third sign alone
+  SCENE_STYLES,
+  SCENE_CALL = 0
+};
+
+struct SceneText {
+  char     text[SCENE_TEXT_MAX];
+  uint16_t color;
+
+  bool empty() const { return text[0] == '\0'; }
+
+  void set(const char* s, uint16_t c = SCENE_WHITE) {
+    strncpy(text, s, SCENE_TEXT_MAX - 1);
+    text[SCENE_TEXT_MAX - 1] = '\0';
+    color = c;
+  }
+
+  // prefix + decimal n, truncated like set(); no printf on the render path
+  void number(const char* prefix, int n, uint16_t c = SCENE_WHITE) {
+    char digits[12];
+    uint8_t d = 0;
+    uint32_t v = n < 0 ? 0u - (uint32_t)n : (uint32_t)n;
+    do { digits[d++] = (char)('0' + v % 10); v /= 10; } while (v);
+    if (n < 0) digits[d++] = '-';
+
+    uint8_t i = 0;
+    while (*prefix && i < SCENE_TEXT_MAX - 1) text[i++] = *prefix++;
+    while (d && i < SCENE_TEXT_MAX - 1) text[i++] = digits[--d];
+    text[i] = '\0';
+    color = c;
+  }
+};
+
+struct Scene {
+  uint8_t   style;                      // SceneStyleId, row of the layout
+  bool      urgent;                     // screen filled, text knocked out
+  SceneText primary;                    // the call, largest font
+  SceneText detail;                     // "" = primary alone
+  SceneText badge[SCENE_BADGE_MAX];
+
+  void clear(uint8_t s = SCENE_CALL) {
+    memset(this, 0, sizeof(*this));
+    style = s;
+  }
+};
+
+// Call frames: line 1 is the primary, line 2 the detail
+inline void callScene(const char* line1, const char* line2, bool urgent, Scene& s) {
+  s.clear(SCENE_CALL);
+  s.urgent = urgent;
+  s.primary.set(line1);
+  s.detail.set(line2);
+}
+
+// Signal frames. Badges: [0] "#n", [1] pickoff, [2] third sign; the
+// pickoff and third badges only appear next to a pitch, alone they are
+// the primary. pitchColors may be NULL (white).
+inline void signalScene(const SignalView& sig, const char* const* pitchNames,
+                        const uint16_t* pitchColors, Scene& s) {
+  static const char* const THIRD_NAMES[] = { "", "3A", "3B", "3C", "3D" };
+  uint8_t pitch = sig.pitch(), pickoff = sig.pickoff(), third = sig.thirdSign();
+  bool hasPitch = pitch < PITCH_COUNT;
+
+  s.clear(SCENE_PITCH);
+  s.badge[0].number("#", sig.number());
+
+  if (sig.isReset()) {
+    s.style = SCENE_RESET;
+    s.primary.set("RESET");
+  } else if (pickoff > 0 && !hasPitch) {
+    s.style = SCENE_PICKOFF;
+    s.primary.number("PK", pickoff, SCENE_RED);
+  } else if (third > 0 && !hasPitch) {
+    s.style = SCENE_THIRD;
+    s.primary.set(third <= THIRD_MAX ? THIRD_NAMES[third] : "3?", SCENE_BLUE);
+  } else if (hasPitch) {
+    s.primary.set(pitchNames[pitch], pitchColors ? pitchColors[pitch] : SCENE_WHITE);
+    if (sig.zone() > 0 && sig.zone() <= ZONE_MAX) s.detail.number("", sig.zone());
+    if (pickoff > 0) s.badge[1].number("PK", pickoff, SCENE_RED);
+    if (third > 0 && third <= THIRD_MAX) s.badge[2].set(THIRD_NAMES[third], SCENE_BLUE);
+  }
+}
+
+// ============================================================================
+// LAYOUT — where each part goes on one panel
+// ============================================================================
+enum SceneAlign : uint8_t {
+  SCENE_LEFT,                           // x is the left edge
+  SCENE_CENTER,                         // x is the centre: left = (2x - w) / 2
+  SCENE_AFTER                           // detail only: x is the gap after the primary
+};
+
+const uint8_t SCENE_NO_FONT = 0xFF;
+
+// y is whatever the library's text call takes: the baseline for U8g2 and
+// GFX fonts, the top for GFX's built-in font, the middle for TFT_eSPI.
+struct SceneSlot {
+  uint8_t font;                         // backend font index, SCENE_NO_FONT = not shown
+  uint8_t align;                        // SceneAlign
+  int16_t x, y;
+};
+
+constexpr SceneSlot SCENE_NO_SLOT = { SCENE_NO_FONT, SCENE_LEFT, 0, 0 };
+
+struct SceneStyle {
+  SceneSlot primary;                    // with a detail
+  SceneSlot solo;                       // primary alone
+  SceneSlot detail;
+};
+
+struct SceneLayout {
+  const SceneStyle* styles;             // indexed by Scene::style
+  uint8_t           styleCount;
+  bool              packBadges;         // badges fill the slots in order, skipping empty ones
+  SceneSlot         badge[SCENE_BADGE_MAX];
+};
+
+// ============================================================================
+// RENDER
+// ============================================================================
+// Draws one text into its slot; returns its right edge for a SCENE_AFTER
+// detail (only measured when asked for, or when centring needs it).
+template <class Backend>
+int16_t drawSceneText(Backend& b, const SceneSlot& slot, const SceneText& t, bool urgent,
+                      bool wantRight, int16_t after) {
+  if (slot.font == SCENE_NO_FONT || t.empty()) return after;
+  int16_t x = slot.x, w = 0;
+  if (slot.align != SCENE_LEFT || wantRight) w = b.textWidth(slot.font, t.text);
+  if (slot.align == SCENE_CENTER) x = (int16_t)((2 * slot.x - w) / 2);
+  else if (slot.align == SCENE_AFTER) x = (int16_t)(after + slot.x);
+  b.text(slot.font, x, slot.y, t.text, t.color, urgent);
+  return (int16_t)(x + w);
+}
+
+template <class Backend>
+void renderScene(Backend& b, const Scene& s, const SceneLayout& l) {
+  b.clear(s.urgent);
+
+  const SceneStyle& st = l.styles[s.style < l.styleCount ? s.style : 0];
+  if (s.detail.empty()) {
+    drawSceneText(b, st.solo, s.primary, s.urgent, false, 0);
+  } else {
+    int16_t right = drawSceneText(b, st.primary, s.primary, s.urgent,
+                                  st.detail.align == SCENE_AFTER, 0);
+    drawSceneText(b, st.detail, s.detail, s.urgent, false, right);
+  }
+
+  uint8_t slot = 0;
+  for (uint8_t i = 0; i < SCENE_BADGE_MAX; i++) {
+    if (l.packBadges && s.badge[i].empty()) continue;
+    drawSceneText(b, l.badge[slot++], s.badge[i], s.urgent, false, 0);
+  }
+}
+
+// ============================================================================
+// BACKENDS
+// ============================================================================
+// Each backend provides:
+//   clear(inverted)                          blank screen, filled if inverted
+//   textWidth(font, s)                       advance of s in pixels
+//   text(font, x, y, s, color, inverted)     x is the left edge
+template <class Canvas> class SceneBackend;
+
+#ifdef U8G2LIB_HH
+// U8g2 full-buffer displays; fonts are U8g2 font tables
+template <> class SceneBackend<U8G2> {
+public:
+  typedef const uint8_t* Font;
+
+  SceneBackend(U8G2& g, const Font* fonts) : _g(g), _fonts(fonts) {}
+
+  void clear(bool inverted) {
+    _g.clearBuffer();
+    _g.setDrawColor(1);
+    if (inverted) _g.drawBox(0, 0, _g.getDisplayWidth(), _g.getDisplayHeight());
+  }
+
+  int16_t textWidth(uint8_t font, const char* s) {
+    _g.setFont(_fonts[font]);
+    return (int16_t)_g.getStrWidth(s);
+  }
+
+  void text(uint8_t font, int16_t x, int16_t y, const char* s, uint16_t, bool inverted) {
+    _g.setFont(_fonts[font]);
+    _g.setDrawColor(inverted ? 0 : 1);
+    _g.drawStr(x, y, s);
+    _g.setDrawColor(1);
+  }
+
+private:
+  U8G2&       _g;
+  const Font* _fonts;
+};
+#endif
+
+#ifdef _TFT_eSPIH_
+// TFT_eSPI panel or sprite; fonts are GLCD font 1 text sizes, y is the
+// text's middle (ML_DATUM, the vertical half of MC_DATUM)
+template <> class SceneBackend<TFT_eSPI> {
+public:
+  typedef uint8_t Font;
+
+  SceneBackend(TFT_eSPI& g, const Font* sizes, uint16_t background = 0x0000)
+    : _g(g), _sizes(sizes), _bg(background) {}
+
+  void clear(bool inverted) { _g.fillScreen(inverted ? SCENE_WHITE : _bg); }
+
+  int16_t textWidth(uint8_t font, const char* s) {
+    _g.setTextSize(_sizes[font]);
+    return (int16_t)_g.textWidth(s);
+  }
+
+  void text(uint8_t font, int16_t x, int16_t y, const char* s, uint16_t color, bool inverted) {
+    _g.setTextDatum(ML_DATUM);
+    _g.setTextSize(_sizes[font]);
+    _g.setTextColor(inverted ? _bg : color);
+    _g.drawString(s, x, y);
+  }
+
+private:
+  TFT_eSPI&   _g;
+  const Font* _sizes;
+  uint16_t    _bg;
+};
+#endif
+
+#ifdef _ADAFRUIT_GFX_H
+// Adafruit GFX canvases and GxEPD2 displays; fonts are GFXfonts (NULL =
+// built-in 6x8). ink / paper are the panel's colours for text / background.
+template <> class SceneBackend<Adafruit_GFX> {
+public:
+  typedef const GFXfont* Font;
+
+  SceneBackend(Adafruit_GFX& g, const Font* fonts, uint16_t ink, uint16_t paper)
+    : _g(g), _fonts(fonts), _ink(ink), _paper(paper) {}
+
+  void clear(bool inverted) { _g.fillScreen(inverted ? _ink : _paper); }
+
+  int16_t textWidth(uint8_t font, const char* s) {
+    int16_t  x1, y1;
+    uint16_t w, h;
+    _g.setFont(_fonts[font]);
+    _g.getTextBounds(s, 0, 0, &x1, &y1, &w, &h);
+    return (int16_t)w;
+  }
+
+  void text(uint8_t font, int16_t x, int16_t y, const char* s, uint16_t, bool inverted) {
+    _g.setFont(_fonts[font]);
+    _g.setTextColor(inverted ? _paper : _ink);
+    _g.setCursor(x, y);
+    _g.print(s);
+  }
+
+private:
+  Adafruit_GFX& _g;
+  const Font*   _fonts;
+  uint16_t      _ink, _paper;
+};
+#endif
+
+// ============================================================================
+// FRAMEBUFFER — headless panel for host benchmarks and golden images
+// ============================================================================
+// BPP 1: rows MSB first, padded to bytes, set bit = any nonzero colour.
+// BPP 16: RGB565, high byte first (the ST7789's wire order).
+template <int16_t W, int16_t H, uint8_t BPP>
+class FrameBuffer {
+public:
+  static const int16_t WIDTH  = W;
+  static const int16_t HEIGHT = H;
+  static const size_t  STRIDE = BPP == 1 ? (W + 7) / 8 : (size_t)W * 2;
+  static const size_t  BYTES  = STRIDE * H;
+
+  FrameBuffer() { memset(_buf, 0, sizeof(_buf)); }
+
+  void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > W) w = W - x;
+    if (y + h > H) h = H - y;
+    for (int16_t yy = y; yy < y + h; yy++)
+      for (int16_t xx = x; xx < x + w; xx++) put(xx, yy, color);
+  }
+
+  uint16_t get(int16_t x, int16_t y) const {
+    const uint8_t* row = &_buf[(size_t)y * STRIDE];
+    if (BPP == 1) return (row[x / 8] >> (7 - (x & 7))) & 1;
+    return (uint16_t)((row[x * 2] << 8) | row[x * 2 + 1]);
+  }
+
+  const uint8_t* data() const { return _buf; }
+
+  // FNV-1a over the frame, for golden image checks
+  uint32_t hash() const {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < BYTES; i++) h = (h ^ _buf[i]) * 16777619u;
+    return h;
+  }
+
+private:
+  void put(int16_t x, int16_t y, uint16_t color) {
+    uint8_t* row = &_buf[(size_t)y * STRIDE];
+    if (BPP == 1) {
+      if (color) row[x / 8] |= (uint8_t)(0x80 >> (x & 7));
+      else       row[x / 8] &= (uint8_t)~(0x80 >> (x & 7));
+    } else {
+      row[x * 2]     = (uint8_t)(color >> 8);
+      row[x * 2 + 1] = (uint8_t)color;
+    }
+  }
+
+  uint8_t _buf[BYTES];
+};
+
+// 5x7 glyphs for ' '..'_' (lower case folds to upper), one byte per
+// column, LSB on top; the GLCD font's shapes
+static const uint8_t SCENE_FONT_5X7[64][5] = {
+  {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},
+  {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x56,0x20,0x50}, {0x00,0x08,0x07,0x03,0x00},
+  {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x2A,0x1C,0x7F,0x1C,0x2A}, {0x08,0x08,0x3E,0x08,0x08},
+  {0x00,0x80,0x70,0x30,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x00,0x60,0x60,0x00}, {0x20,0x10,0x08,0x04,0x02},
+  {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x72,0x49,0x49,0x49,0x46}, {0x21,0x41,0x49,0x4D,0x33},
+  {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x31}, {0x41,0x21,0x11,0x09,0x07},
+  {0x36,0x49,0x49,0x49,0x36}, {0x46,0x49,0x49,0x29,0x1E}, {0x00,0x00,0x14,0x00,0x00}, {0x00,0x40,0x34,0x00,0x00},
+  {0x00,0x08,0x14,0x22,0x41}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x59,0x09,0x06},
+  {0x3E,0x41,0x5D,0x59,0x4E}, {0x7C,0x12,0x11,0x12,0x7C}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},
+  {0x7F,0x41,0x41,0x41,0x3E}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x41,0x51,0x73},
+  {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},
+  {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x1C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},
+  {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x26,0x49,0x49,0x49,0x32},
+  {0x03,0x01,0x7F,0x01,0x03}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},
+  {0x63,0x14,0x08,0x14,0x63}, {0x03,0x04,0x78,0x04,0x03}, {0x61,0x59,0x49,0x4D,0x43}, {0x00,0x7F,0x41,0x41,0x41},
+  {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x41,0x7F}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+};
+
+// Fonts are scales of the 6x8 cell. y is the baseline, or the middle of
+// the cell when laying out a TFT_eSPI (ML_DATUM) layout.
+template <int16_t W, int16_t H, uint8_t BPP>
+class SceneBackend<FrameBuffer<W, H, BPP> > {
+public:
+  typedef uint8_t Font;
+
+  SceneBackend(FrameBuffer<W, H, BPP>& fb, const Font* scales, bool middle = false,
+               uint16_t background = 0x0000)
+    : _fb(fb), _scales(scales), _middle(middle), _bg(background) {}
+
+  void clear(bool inverted) { _fb.fill(0, 0, W, H, inverted ? SCENE_WHITE : _bg); }
+
+  int16_t textWidth(uint8_t font, const char* s) {
+    return (int16_t)(strlen(s) * 6 * _scales[font]);
+  }
+
+  void text(uint8_t font, int16_t x, int16_t y, const char* s, uint16_t color, bool inverted) {
+    uint8_t k = _scales[font];
+    int16_t top = _middle ? (int16_t)(y - 4 * k) : (int16_t)(y - 7 * k);
+    uint16_t c = inverted ? _bg : color;
+    for (; *s; s++, x += 6 * k) {
+      uint8_t ch = (uint8_t)*s;
+      if (ch >= 'a' && ch <= 'z') ch -= 32;
+      if (ch < ' ' || ch > '_') ch = '?';
+      const uint8_t* g = SCENE_FONT_5X7[ch - ' '];
+      for (int16_t col = 0; col < 5; col++)
+        for (int16_t row = 0; row < 8; row++)
+          if ((g[col] >> row) & 1) _fb.fill(x + col * k, top + row * k, k, k, c);
+    }
+  }
+
+private:
+  FrameBuffer<W, H, BPP>& _fb;
+  const Font* _scales;
+  bool        _middle;
+  uint16_t    _bg;
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_SCENE_H
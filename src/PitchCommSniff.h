@@ -0,0 +1,137 @@
+/*
+ * ============================================================================
+ * PITCHCOMM SNIFF — RX duty cycle for the battery receivers
+ * ============================================================================
+ * In continuous RX the SX1262 draws about 6 mA all game, more than anything
+ * else on the HUD and armband. In sniff mode (SX126x SetRxDutyCycle) the
+ * radio listens for a window of SNIFF_RX_SYMBOLS symbols, sleeps, and
+ * repeats. A window that sees a preamble keeps the radio in RX for the
+ * packet. The coach sends a long preamble, so a whole window always falls
+ * inside it, wherever the cycle is when the packet starts:
+ *
+ *   coach     |<-------------------- preamble ------------------->|hdr|data|
+ *   receiver  ...[rx]|<---------- sleep ---------->|[rx]
+ *                    ^ worst case: window just missed
+ *
+ *   sleep = preamble - 2 * window
+ *
+ * The sleep includes SNIFF_WAKE_US of wake-up (RadioLib: TCXO delay + 1 ms).
+ * If the preamble is too short for that, the receiver stays in continuous RX.
+ *
+ * The trade-off is the length of the coach's preamble. Every coach frame
+ * carries it, so every frame ends (preamble - 8) symbols later than with
+ * today's 8 symbols. In return the radio listens window / (window + sleep)
+ * of the time. At SF7 (1.024 ms symbols):
+ *
+ *   preamble   added latency   sleep     listening   awake (+ wake-up)
+ *     32         25 ms          16 ms      33 %        58 %
+ *     64         57 ms          49 ms      14 %        25 %
+ *    128        123 ms         115 ms     6.7 %        12 %
+ *    256        254 ms         246 ms     3.2 %       5.6 %
+ *
+ * Everything is in symbols, so when link adaptation moves a receiver to a
+ * slower SF both columns scale with it (x8 at SF10). latency_budget --sniff
+ * adds the preamble to each call receiver's budget, with the radio's average
+ * current. Host_Bench sniff_sim runs the HUD and armband sketches in sniff
+ * mode and counts the frames they miss.
+ *
+ * Receivers still transmit ACKs and link reports with their own 8-symbol
+ * preamble, because the coach listens continuously. A receiver sniffing for
+ * a coach that sends short preambles hears almost nothing. The mode is off
+ * unless the receiver's RX_SNIFF_PREAMBLE matches the coach's.
+ *
+ * Receiver usage (see the HUD's initRadio()):
+ *   pitchcomm::SniffListener<SX1262> listener(radio, MODEM_CALL_SF7, RX_SNIFF_PREAMBLE);
+ *   listener.startReceive();                 // wherever radio.startReceive() was
+ *   tuneLink(listener, link);                // an SF step re-times the windows
+ *   sendCallAck(listener, ack, millis(), onReceive);
+ *
+ * Coach usage (the T-Deck TX source is not in this tree):
+ *   radio.setPreambleLength(SNIFF_PREAMBLE);               // every frame
+ *   CallArq arq(withPreamble(modem, SNIFF_PREAMBLE), ...); // deadlines
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_SNIFF_H
+#define PITCHCOMM_SNIFF_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <PitchCommAirtime.h>
+
+namespace pitchcomm {
+
+const uint8_t  SNIFF_RX_SYMBOLS = 8;       // one window: RadioLib's default minSymbols
+const uint32_t SNIFF_WAKE_US    = 6000;    // sleep -> RX: 5 ms TCXO delay + 1 ms
+
+constexpr uint32_t symbolUs(const LoRaModem& m) {
+  return symbolTimeNs(m.sf, m.bwHz) / 1000;
+}
+
+constexpr uint32_t sniffRxUs(const LoRaModem& m) {
+  return SNIFF_RX_SYMBOLS * symbolUs(m);
+}
+
+// Sleep (wake-up included) that still leaves a whole window inside a
+// preamble of that many symbols; 0 = too short to sniff
+constexpr uint32_t sniffSleepUs(const LoRaModem& m, uint16_t preamble) {
+  return (uint32_t)preamble * symbolUs(m) > 2 * sniffRxUs(m) + SNIFF_WAKE_US
+       ? (uint32_t)preamble * symbolUs(m) - 2 * sniffRxUs(m) : 0;
+}
+
+// Latency the sniff preamble adds to every coach frame
+constexpr uint32_t sniffExtraUs(const LoRaModem& m, uint16_t preamble) {
+  return preamble > m.preamble ? (uint32_t)(preamble - m.preamble) * symbolUs(m) : 0;
+}
+
+// The coach's modem with the sniff preamble, for airtime and deadlines
+constexpr LoRaModem withPreamble(const LoRaModem& m, uint16_t preamble) {
+  return LoRaModem{ m.sf, m.bwHz, m.cr, preamble, m.crc, m.implicitHeader };
+}
+
+static_assert(sniffSleepUs(MODEM_CALL_SF7, 64) == 49152, "SF7 sniff sleep, 64 symbols");
+static_assert(sniffSleepUs(MODEM_CALL_SF7, 16) == 0,     "no sniffing on a short preamble");
+static_assert(sniffExtraUs(MODEM_CALL_SF7, 64) == 57344, "SF7 sniff latency, 64 symbols");
+
+// ============================================================================
+// RECEIVER SIDE
+// ============================================================================
+// Stands in for the radio wherever the receiver re-arms RX, including the
+// shared tuneLink() / sendLinkReport() / sendCallAck() helpers.
+template <typename Radio>
+class SniffListener {
+public:
+  // preamble: the coach's preamble in symbols, 0 = continuous RX
+  SniffListener(Radio& radio, const LoRaModem& modem, uint16_t preamble)
+    : _radio(radio), _modem(modem), _preamble(preamble) {}
+
+  void setPreamble(uint16_t preamble) { _preamble = preamble; }
+  void setModem(const LoRaModem& modem) { _modem = modem; }
+
+  bool     sniffing() const { return _preamble && sniffSleepUs(_modem, _preamble) > 0; }
+  uint32_t rxUs() const     { return sniffRxUs(_modem); }
+  uint32_t sleepUs() const  { return sniffSleepUs(_modem, _preamble); }
+
+  int16_t startReceive() {
+    if (!sniffing()) return _radio.startReceive();
+    return _radio.startReceiveDutyCycle(rxUs(), sleepUs());
+  }
+
+  // The rest of what the shared helpers call
+  int16_t setSpreadingFactor(uint8_t sf) {
+    _modem.sf = sf;
+    return _radio.setSpreadingFactor(sf);
+  }
+  int16_t transmit(const uint8_t* data, size_t len) { return _radio.transmit(data, len); }
+  void    setDio1Action(void (*func)(void))         { _radio.setDio1Action(func); }
+  void    clearDio1Action()                         { _radio.clearDio1Action(); }
+
+private:
+  Radio&    _radio;
+  LoRaModem _modem;
+  uint16_t  _preamble;
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_SNIFF_H
@@ -0,0 +1,64 @@
+/*
+ * ============================================================================
+ * PITCHCOMM SPSC RING — lock-free single-producer / single-consumer queue
+ * ============================================================================
+ * Fixed-capacity ring for handing packets from the radio task to the UI
+ * task without a mutex. Exactly one task may push() and exactly one task may
+ * pop(); both are wait-free. Capacity N must be a power of two. Head and
+ * tail are free-running 32-bit counters, so the full ring holds N items.
+ *
+ * Safe between FreeRTOS tasks on different ESP32-S3 cores: the element is
+ * written before the release store of head and read after the acquire load
+ * of it. Not for use from an ISR on the consumer side.
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_SPSC_RING_H
+#define PITCHCOMM_SPSC_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+namespace pitchcomm {
+
+template <typename T, uint32_t N>
+class SpscRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+  SpscRing() : _head(0), _tail(0) {}
+
+  // Producer side. False when full (item not queued).
+  bool push(const T& item) {
+    uint32_t h = _head.load(std::memory_order_relaxed);
+    if (h - _tail.load(std::memory_order_acquire) == N) return false;
+    _items[h & (N - 1)] = item;
+    _head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side. False when empty.
+  bool pop(T& out) {
+    uint32_t t = _tail.load(std::memory_order_relaxed);
+    if (_head.load(std::memory_order_acquire) == t) return false;
+    out = _items[t & (N - 1)];
+    _tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Approximate when called from a third task
+  uint32_t size() const {
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+  }
+  bool empty() const { return size() == 0; }
+  static constexpr uint32_t capacity() { return N; }
+
+private:
+  std::atomic<uint32_t> _head;
+  std::atomic<uint32_t> _tail;
+  T                     _items[N];
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_SPSC_RING_H
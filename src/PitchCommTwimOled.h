@@ -0,0 +1,154 @@
+/*
+ * ============================================================================
+ * PITCHCOMM TWIM OLED — non-blocking SSD1306 frame push on nRF52840
+ * ============================================================================
+ * U8g2's SW_I2C backend bit-bangs every bit with the CPU, so a 64x32 frame
+ * keeps loop() away from the radio for the whole transfer. TwimOled pushes
+ * the same U8g2 full buffer through a hardware TWIM with EasyDMA instead:
+ * send() copies the frame into a RAM staging buffer, starts the transfer
+ * and returns; the TWIM clocks it out while loop() goes back to sleep.
+ *
+ * One I2C transaction per frame: the column/page window is set with
+ * Co=1 command bytes and followed by the data stream, so with the panel in
+ * horizontal addressing mode the whole frame is a single DMA transfer:
+ *
+ *   [0x80 0x21][0x80 c0][0x80 c1][0x80 0x22][0x80 0][0x80 p1][0x40 data...]
+ *
+ * Any two GPIOs can be routed to the TWIM, so the HUD keeps its D6/D7
+ * wiring. TWIM1 is used (the sketch does not use Wire1) and is polled,
+ * not interrupt driven, so no IRQ handler is claimed.
+ *
+ * U8g2 still owns begin() and the init sequence over its own SW I2C; call
+ * TwimOled::begin() afterwards and flush through send() from then on. On
+ * other platforms begin() returns false and callers keep sendBuffer().
+ *
+ * Frequencies: 100 / 250 / 400 kHz are the TWIM's specified rates. 1 MHz
+ * is accepted (FREQUENCY = 0x10000000) but is outside both the nRF52840
+ * and SSD1306 specs; use it only on short tethers that have been tested.
+ * ============================================================================
+ */
+
+#ifndef PITCHCOMM_TWIM_OLED_H
+#define PITCHCOMM_TWIM_OLED_H
+
+#include <Arduino.h>
+
+namespace pitchcomm {
+
+template <uint8_t WIDTH, uint8_t HEIGHT>
+class TwimOled {
+public:
+  static const uint16_t FRAME_BYTES = (uint16_t)WIDTH * HEIGHT / 8;
+  static const uint8_t  HEADER_BYTES = 13;
+
+  TwimOled() : _ready(false), _active(false), _errors(0) {}
+
+  // xOffset: first controller column of the panel (U8x8 x_offset)
+  bool begin(uint8_t sdaPin, uint8_t sclPin, uint32_t hz, uint8_t xOffset,
+             uint8_t address = 0x3C) {
+#if defined(NRF52840_XXAA)
+    uint32_t freq;
+    if (hz >= 1000000)     freq = 0x10000000UL;
+    else if (hz >= 400000) freq = TWIM_FREQUENCY_FREQUENCY_K400;
+    else if (hz >= 250000) freq = TWIM_FREQUENCY_FREQUENCY_K250;
+    else                   freq = TWIM_FREQUENCY_FREQUENCY_K100;
+
+    uint32_t sda = g_ADigitalPinMap[sdaPin];
+    uint32_t scl = g_ADigitalPinMap[sclPin];
+    nrf_gpio_cfg(scl, NRF_GPIO_PIN_DIR_INPUT, NRF_GPIO_PIN_INPUT_CONNECT,
+                 NRF_GPIO_PIN_PULLUP, NRF_GPIO_PIN_S0D1, NRF_GPIO_PIN_NOSENSE);
+    nrf_gpio_cfg(sda, NRF_GPIO_PIN_DIR_INPUT, NRF_GPIO_PIN_INPUT_CONNECT,
+                 NRF_GPIO_PIN_PULLUP, NRF_GPIO_PIN_S0D1, NRF_GPIO_PIN_NOSENSE);
+
+    NRF_TWIM_Type* t = NRF_TWIM1;
+    t->ENABLE    = TWIM_ENABLE_ENABLE_Disabled;
+    t->PSEL.SCL  = scl;
+    t->PSEL.SDA  = sda;
+    t->FREQUENCY = freq;
+    t->ADDRESS   = address;
+    t->INTENCLR  = 0xFFFFFFFFUL;
+    t->SHORTS    = TWIM_SHORTS_LASTTX_STOP_Msk;
+    t->ENABLE    = TWIM_ENABLE_ENABLE_Enabled;
+
+    // Horizontal addressing so one window write covers the whole frame
+    static const uint8_t mode[] = { 0x80, 0x20, 0x80, 0x00 };
+    memcpy(_tx, mode, sizeof(mode));
+    start(sizeof(mode));
+    wait();
+    if (_errors) {
+      t->ENABLE = TWIM_ENABLE_ENABLE_Disabled;
+      return false;
+    }
+
+    uint8_t c0 = xOffset, c1 = xOffset + WIDTH - 1, p1 = HEIGHT / 8 - 1;
+    const uint8_t header[HEADER_BYTES] = {
+      0x80, 0x21, 0x80, c0, 0x80, c1,
+      0x80, 0x22, 0x80, 0x00, 0x80, p1,
+      0x40
+    };
+    memcpy(_tx, header, HEADER_BYTES);
+    _ready = true;
+    return true;
+#else
+    (void)sdaPin; (void)sclPin; (void)hz; (void)xOffset; (void)address;
+    return false;
+#endif
+  }
+
+  bool ready() const { return _ready; }
+
+  // Queues one U8g2 full buffer; waits only if the previous frame is
+  // still on the wire
+  void send(const uint8_t* frame) {
+    if (!_ready) return;
+    wait();
+    memcpy(_tx + HEADER_BYTES, frame, FRAME_BYTES);
+    start(HEADER_BYTES + FRAME_BYTES);
+  }
+
+  bool busy() {
+#if defined(NRF52840_XXAA)
+    if (!_active) return false;
+    NRF_TWIM_Type* t = NRF_TWIM1;
+    if (t->EVENTS_ERROR) {
+      t->EVENTS_ERROR = 0;
+      t->ERRORSRC = t->ERRORSRC;       // write 1s to clear
+      t->TASKS_STOP = 1;
+      _errors++;
+    }
+    if (!t->EVENTS_STOPPED) return true;
+    _active = false;
+#endif
+    return false;
+  }
+
+  void wait() {
+    while (busy()) {}
+  }
+
+  uint32_t errors() const { return _errors; }
+
+private:
+  void start(uint16_t len) {
+#if defined(NRF52840_XXAA)
+    NRF_TWIM_Type* t = NRF_TWIM1;
+    t->EVENTS_STOPPED = 0;
+    t->EVENTS_ERROR   = 0;
+    t->TXD.PTR    = (uint32_t)_tx;
+    t->TXD.MAXCNT = len;
+    t->TASKS_STARTTX = 1;
+    _active = true;
+#else
+    (void)len;
+#endif
+  }
+
+  bool     _ready;
+  bool     _active;
+  uint32_t _errors;
+  uint8_t  _tx[HEADER_BYTES + FRAME_BYTES];   // EasyDMA reads RAM only
+};
+
+} // namespace pitchcomm
+
+#endif // PITCHCOMM_TWIM_OLED_H